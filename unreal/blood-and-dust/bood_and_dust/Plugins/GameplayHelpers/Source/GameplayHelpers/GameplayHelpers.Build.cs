@@ -17,7 +17,8 @@ public class GameplayHelpers : ModuleRules
 				"SlateCore",
 				"InputCore",
 				"Niagara",
-				"UMG"
+				"UMG",
+				"AssetRegistry"
 			}
 		);
 	}
@@ -0,0 +1,573 @@
+#include "CombatPoolSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/WidgetComponent.h"
+#include "Blueprint/UserWidget.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+
+namespace
+{
+	// Idle pooled objects are parked far below the playable area so a stray render/overlap never sees them.
+	const FVector kPoolParkLocation(0.f, 0.f, -100000.f);
+}
+
+UCombatPoolSubsystem* UCombatPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UCombatPoolSubsystem>() : nullptr;
+}
+
+bool UCombatPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!GetOrCreateHost())
+	{
+		return;
+	}
+
+	// Only debris pre-warms here. Blood FX needs the Niagara asset and health bars the widget class,
+	// so both warm on first use.
+	for (int32 i = DebrisPool.Entries.Num(); i < DebrisPoolSize; ++i)
+	{
+		AddEntry(DebrisPool, CreateDebris());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("CombatPool: pre-warmed %d debris (health bars/FX warm on first use)"),
+		DebrisPool.Entries.Num());
+}
+
+void UCombatPoolSubsystem::Deinitialize()
+{
+	LogPoolStats();
+
+	DebrisPool.Entries.Empty();
+	BloodFXPool.Entries.Empty();
+	HealthBarPool.Entries.Empty();
+	PoolHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+AActor* UCombatPoolSubsystem::GetOrCreateHost()
+{
+	if (PoolHost && IsValid(PoolHost))
+	{
+		return PoolHost;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags = RF_Transient;
+	SpawnParams.Name = TEXT("CombatPoolHost");
+	SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+
+	PoolHost = World->SpawnActor<AActor>(AActor::StaticClass(), kPoolParkLocation, FRotator::ZeroRotator, SpawnParams);
+	if (PoolHost)
+	{
+		USceneComponent* Root = NewObject<USceneComponent>(PoolHost, TEXT("PoolRoot"), RF_Transient);
+		PoolHost->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+	return PoolHost;
+}
+
+// ============================================
+// Factories (only hit on pre-warm or a pool miss)
+// ============================================
+
+AActor* UCombatPoolSubsystem::CreateDebris()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags = RF_Transient;
+
+	AActor* Debris = World->SpawnActor<AActor>(AActor::StaticClass(), kPoolParkLocation, FRotator::ZeroRotator, SpawnParams);
+	if (!Debris)
+	{
+		return nullptr;
+	}
+
+	UStaticMeshComponent* SMC = NewObject<UStaticMeshComponent>(Debris, NAME_None, RF_Transient);
+	Debris->SetRootComponent(SMC);
+	SMC->SetCollisionProfileName(TEXT("PhysicsActor"));
+	SMC->RegisterComponent();
+
+	DeactivateDebris(Debris);
+	return Debris;
+}
+
+UNiagaraComponent* UCombatPoolSubsystem::CreateBloodFX(UNiagaraSystem* System)
+{
+	AActor* Host = GetOrCreateHost();
+	if (!Host)
+	{
+		return nullptr;
+	}
+
+	UNiagaraComponent* NC = NewObject<UNiagaraComponent>(Host, NAME_None, RF_Transient);
+	NC->SetAutoActivate(false);
+	NC->SetAutoDestroy(false);
+	NC->SetUsingAbsoluteLocation(true);
+	NC->SetUsingAbsoluteRotation(true);
+	NC->SetupAttachment(Host->GetRootComponent());
+	NC->SetAsset(System);
+	NC->RegisterComponent();
+	return NC;
+}
+
+UWidgetComponent* UCombatPoolSubsystem::CreateHealthBar(UClass* WidgetClass)
+{
+	AActor* Host = GetOrCreateHost();
+	if (!Host)
+	{
+		return nullptr;
+	}
+
+	UWidgetComponent* WC = NewObject<UWidgetComponent>(Host, NAME_None, RF_Transient);
+	WC->SetupAttachment(Host->GetRootComponent());
+	WC->SetWidgetSpace(EWidgetSpace::Screen);
+	WC->SetDrawSize(FVector2D(120, 10));
+	WC->SetPivot(FVector2D(0.5f, 0.5f));
+	WC->SetWidgetClass(WidgetClass);
+	WC->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	WC->SetVisibility(false);
+	WC->RegisterComponent();
+	return WC;
+}
+
+// ============================================
+// Pool bookkeeping
+// ============================================
+
+void UCombatPoolSubsystem::DeactivateDebris(UObject* Object) const
+{
+	AActor* Debris = Cast<AActor>(Object);
+	if (!IsValid(Debris))
+	{
+		return;
+	}
+
+	if (UStaticMeshComponent* SMC = Cast<UStaticMeshComponent>(Debris->GetRootComponent()))
+	{
+		SMC->SetSimulatePhysics(false);
+		SMC->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+	Debris->SetActorHiddenInGame(true);
+	Debris->SetActorLocation(kPoolParkLocation, false, nullptr, ETeleportType::ResetPhysics);
+}
+
+void UCombatPoolSubsystem::DeactivateHealthBar(UObject* Object) const
+{
+	UWidgetComponent* WC = Cast<UWidgetComponent>(Object);
+	if (!IsValid(WC))
+	{
+		return;
+	}
+
+	WC->SetVisibility(false);
+	if (PoolHost && PoolHost->GetRootComponent())
+	{
+		WC->AttachToComponent(PoolHost->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	}
+}
+
+void UCombatPoolSubsystem::AddEntry(FCombatPool& Pool, UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	FCombatPoolEntry& Entry = Pool.Entries.AddDefaulted_GetRef();
+	Entry.Object = Object;
+	Pool.Stats.Capacity = Pool.Entries.Num();
+}
+
+void UCombatPoolSubsystem::MarkInUse(FCombatPool& Pool, int32 Index, AActor* Borrower, double ExpireTime)
+{
+	FCombatPoolEntry& Entry = Pool.Entries[Index];
+	if (!Entry.bInUse)
+	{
+		Pool.Stats.InUse++;
+		Pool.Stats.HighWater = FMath::Max(Pool.Stats.HighWater, Pool.Stats.InUse);
+	}
+	Entry.bInUse = true;
+	Entry.Borrower = Borrower;
+	Entry.ExpireTime = ExpireTime;
+}
+
+bool UCombatPoolSubsystem::MarkFree(FCombatPool& Pool, UObject* Object)
+{
+	for (FCombatPoolEntry& Entry : Pool.Entries)
+	{
+		if (Entry.Object == Object)
+		{
+			if (Entry.bInUse)
+			{
+				Entry.bInUse = false;
+				Entry.Borrower = nullptr;
+				Entry.ExpireTime = 0.0;
+				Pool.Stats.InUse--;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 UCombatPoolSubsystem::Sweep(FCombatPool& Pool, double Now, TFunctionRef<bool(UObject*)> IsFinished, TFunctionRef<void(UObject*)> Deactivate)
+{
+	int32 Freed = 0;
+	for (int32 i = Pool.Entries.Num() - 1; i >= 0; --i)
+	{
+		FCombatPoolEntry& Entry = Pool.Entries[i];
+
+		// Something outside the pool destroyed the object (level teardown, owner destroy cascade)
+		if (!IsValid(Entry.Object))
+		{
+			if (Entry.bInUse)
+			{
+				Pool.Stats.InUse--;
+			}
+			Pool.Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (!Entry.bInUse)
+		{
+			continue;
+		}
+
+		const bool bExpired = Entry.ExpireTime > 0.0 && Now >= Entry.ExpireTime;
+		const bool bOrphaned = Entry.Borrower.IsStale(true);
+		if (bExpired || bOrphaned || IsFinished(Entry.Object))
+		{
+			Deactivate(Entry.Object);
+			Entry.bInUse = false;
+			Entry.Borrower = nullptr;
+			Entry.ExpireTime = 0.0;
+			Pool.Stats.InUse--;
+			Pool.Stats.Expired++;
+			Freed++;
+		}
+	}
+	Pool.Stats.Capacity = Pool.Entries.Num();
+	return Freed;
+}
+
+int32 UCombatPoolSubsystem::FindOldestInUse(const FCombatPool& Pool, bool bSkipBorrowed) const
+{
+	int32 Oldest = INDEX_NONE;
+	for (int32 i = 0; i < Pool.Entries.Num(); ++i)
+	{
+		const FCombatPoolEntry& Entry = Pool.Entries[i];
+		if (bSkipBorrowed && Entry.Borrower.IsValid())
+		{
+			continue;
+		}
+		if (Entry.bInUse && (Oldest == INDEX_NONE || Entry.ExpireTime < Pool.Entries[Oldest].ExpireTime))
+		{
+			Oldest = i;
+		}
+	}
+	return Oldest;
+}
+
+// ============================================
+// Debris
+// ============================================
+
+AActor* UCombatPoolSubsystem::AcquireDebris(UStaticMesh* Mesh, const FTransform& Transform, float Lifetime, AActor* Owner)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Mesh)
+	{
+		return nullptr;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	FCombatPool& Pool = DebrisPool;
+	Pool.Stats.Requests++;
+
+	Sweep(Pool, Now,
+		[](UObject*) { return false; },
+		[this](UObject* Obj) { DeactivateDebris(Obj); });
+
+	int32 Index = Pool.Entries.IndexOfByPredicate([](const FCombatPoolEntry& E) { return !E.bInUse; });
+	if (Index != INDEX_NONE)
+	{
+		Pool.Stats.Hits++;
+	}
+	else if (Pool.Entries.Num() >= MaxDebris)
+	{
+		// Debris still listed by a live owner is not recycled; that owner would release it later
+		// from under its new borrower. With nothing evictable the burst just gets fewer rocks.
+		Index = FindOldestInUse(Pool, true);
+		if (Index != INDEX_NONE)
+		{
+			DeactivateDebris(Pool.Entries[Index].Object);
+			Pool.Stats.Hits++;
+			Pool.Stats.Evictions++;
+		}
+	}
+	else
+	{
+		AddEntry(Pool, CreateDebris());
+		Index = Pool.Entries.Num() - 1;
+		Pool.Stats.Misses++;
+	}
+
+	if (!Pool.Entries.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	AActor* Debris = Cast<AActor>(Pool.Entries[Index].Object);
+	UStaticMeshComponent* SMC = Debris ? Cast<UStaticMeshComponent>(Debris->GetRootComponent()) : nullptr;
+	if (!SMC)
+	{
+		return nullptr;
+	}
+
+	MarkInUse(Pool, Index, Owner, Lifetime > 0.f ? Now + Lifetime : 0.0);
+
+	if (SMC->GetStaticMesh() != Mesh)
+	{
+		SMC->SetStaticMesh(Mesh);
+	}
+	Debris->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Debris->SetActorHiddenInGame(false);
+	SMC->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	SMC->SetSimulatePhysics(true);
+	return Debris;
+}
+
+void UCombatPoolSubsystem::ReleaseDebris(AActor* Debris, AActor* Owner)
+{
+	if (!Debris)
+	{
+		return;
+	}
+
+	// Expired debris may already be lent to someone else; only the current borrower can release it
+	if (Owner)
+	{
+		const FCombatPoolEntry* Entry = DebrisPool.Entries.FindByPredicate(
+			[Debris](const FCombatPoolEntry& E) { return E.Object == Debris; });
+		if (!Entry || !Entry->bInUse || Entry->Borrower.Get() != Owner)
+		{
+			return;
+		}
+	}
+
+	if (MarkFree(DebrisPool, Debris))
+	{
+		DeactivateDebris(Debris);
+	}
+}
+
+// ============================================
+// Blood FX
+// ============================================
+
+UNiagaraComponent* UCombatPoolSubsystem::SpawnBloodFX(UNiagaraSystem* System, const FVector& Location)
+{
+	UWorld* World = GetWorld();
+	if (!World || !System)
+	{
+		return nullptr;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	FCombatPool& Pool = BloodFXPool;
+
+	// First hit of the world: warm the whole pool for this system in one go
+	if (Pool.Entries.Num() == 0)
+	{
+		for (int32 i = 0; i < BloodFXPoolSize; ++i)
+		{
+			AddEntry(Pool, CreateBloodFX(System));
+		}
+	}
+
+	Pool.Stats.Requests++;
+
+	Sweep(Pool, Now,
+		[](UObject* Obj)
+		{
+			const UNiagaraComponent* NC = Cast<UNiagaraComponent>(Obj);
+			return NC && !NC->IsActive();
+		},
+		[](UObject*) {});
+
+	int32 Index = Pool.Entries.IndexOfByPredicate([System](const FCombatPoolEntry& E)
+	{
+		const UNiagaraComponent* NC = Cast<UNiagaraComponent>(E.Object);
+		return !E.bInUse && NC && NC->GetAsset() == System;
+	});
+	if (Index == INDEX_NONE)
+	{
+		// Any idle component can be retargeted to this system
+		Index = Pool.Entries.IndexOfByPredicate([](const FCombatPoolEntry& E) { return !E.bInUse; });
+	}
+
+	if (Index != INDEX_NONE)
+	{
+		Pool.Stats.Hits++;
+	}
+	else if (Pool.Entries.Num() >= MaxBloodFX)
+	{
+		Index = FindOldestInUse(Pool);
+		if (Index != INDEX_NONE)
+		{
+			Pool.Stats.Hits++;
+			Pool.Stats.Evictions++;
+		}
+	}
+	else
+	{
+		AddEntry(Pool, CreateBloodFX(System));
+		Index = Pool.Entries.Num() - 1;
+		Pool.Stats.Misses++;
+	}
+
+	if (!Pool.Entries.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	UNiagaraComponent* NC = Cast<UNiagaraComponent>(Pool.Entries[Index].Object);
+	if (!NC)
+	{
+		return nullptr;
+	}
+
+	// Safety expiry in case a looping system slips in and never completes
+	constexpr float MaxBurstLifetime = 5.0f;
+	MarkInUse(Pool, Index, nullptr, Now + MaxBurstLifetime);
+
+	if (NC->GetAsset() != System)
+	{
+		NC->SetAsset(System);
+	}
+	NC->SetWorldLocationAndRotation(Location, FRotator::ZeroRotator);
+	NC->ActivateSystem(true);
+	return NC;
+}
+
+// ============================================
+// Health bars
+// ============================================
+
+UWidgetComponent* UCombatPoolSubsystem::AcquireHealthBar(AActor* Owner, TSubclassOf<UUserWidget> WidgetClass, float HeadZ)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Owner || !Owner->GetRootComponent() || !WidgetClass)
+	{
+		return nullptr;
+	}
+
+	FCombatPool& Pool = HealthBarPool;
+
+	// First request of the world: warm the whole pool with this widget class
+	if (Pool.Entries.Num() == 0)
+	{
+		for (int32 i = 0; i < HealthBarPoolSize; ++i)
+		{
+			AddEntry(Pool, CreateHealthBar(WidgetClass));
+		}
+	}
+
+	Pool.Stats.Requests++;
+
+	Sweep(Pool, World->GetTimeSeconds(),
+		[](UObject*) { return false; },
+		[this](UObject* Obj) { DeactivateHealthBar(Obj); });
+
+	UClass* Class = WidgetClass.Get();
+	int32 Index = Pool.Entries.IndexOfByPredicate([Class](const FCombatPoolEntry& E)
+	{
+		const UWidgetComponent* WC = Cast<UWidgetComponent>(E.Object);
+		return !E.bInUse && WC && WC->GetWidgetClass() == Class;
+	});
+
+	// Every live enemy needs its own bar, so this pool grows instead of evicting
+	if (Index != INDEX_NONE)
+	{
+		Pool.Stats.Hits++;
+	}
+	else
+	{
+		AddEntry(Pool, CreateHealthBar(Class));
+		Index = Pool.Entries.Num() - 1;
+		Pool.Stats.Misses++;
+	}
+
+	UWidgetComponent* WC = Pool.Entries.IsValidIndex(Index) ? Cast<UWidgetComponent>(Pool.Entries[Index].Object) : nullptr;
+	if (!WC)
+	{
+		return nullptr;
+	}
+
+	MarkInUse(Pool, Index, Owner, 0.0);
+
+	WC->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	WC->SetRelativeLocation(FVector(0, 0, HeadZ));
+	WC->SetVisibility(false); // Hidden until damaged
+	return WC;
+}
+
+void UCombatPoolSubsystem::ReleaseHealthBar(UWidgetComponent* HealthBar)
+{
+	if (HealthBar && MarkFree(HealthBarPool, HealthBar))
+	{
+		DeactivateHealthBar(HealthBar);
+	}
+}
+
+// ============================================
+// Stats
+// ============================================
+
+const FCombatPoolStats& UCombatPoolSubsystem::GetStats(ECombatPoolType Type) const
+{
+	switch (Type)
+	{
+	case ECombatPoolType::BloodFX: return BloodFXPool.Stats;
+	case ECombatPoolType::HealthBar: return HealthBarPool.Stats;
+	default: return DebrisPool.Stats;
+	}
+}
+
+void UCombatPoolSubsystem::LogPoolStats() const
+{
+	auto LogOne = [](const TCHAR* Name, const FCombatPoolStats& S)
+	{
+		UE_LOG(LogTemp, Log, TEXT("CombatPool[%s]: requests=%d hit=%.0f%% miss=%d evict=%d expired=%d inuse=%d highwater=%d capacity=%d"),
+			Name, S.Requests, S.GetHitRate() * 100.f, S.Misses, S.Evictions, S.Expired, S.InUse, S.HighWater, S.Capacity);
+	};
+	LogOne(TEXT("Debris"), DebrisPool.Stats);
+	LogOne(TEXT("BloodFX"), BloodFXPool.Stats);
+	LogOne(TEXT("HealthBar"), HealthBarPool.Stats);
+}
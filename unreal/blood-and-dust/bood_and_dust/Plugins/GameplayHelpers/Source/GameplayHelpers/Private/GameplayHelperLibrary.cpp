@@ -1,5 +1,7 @@
 #include "GameplayHelperLibrary.h"
 #include "IntroSequenceComponent.h"
+#include "CombatPoolSubsystem.h"
+#include "GameplayPreloadSubsystem.h"
 #include "EnemyAnimInstance.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -41,8 +43,9 @@
 #include "Animation/AnimNotifies/AnimNotify_PlaySound.h"
 #include "Animation/Skeleton.h"
 #include "Engine/SkeletalMesh.h"
-#include "Brushes/SlateRoundedBoxBrush.h"
 #include "InputCoreTypes.h"
+#include "Widgets/SInvalidationPanel.h"
+#include "Rendering/DrawElements.h"
 
 namespace
 {
@@ -55,6 +58,14 @@ namespace
 	constexpr float kUiSfxVolume = 0.75f;
 }
 
+// HUD work counters: `stat GameplayHUD` shows how many Slate pushes/repaints the HUD issued this frame.
+DECLARE_STATS_GROUP(TEXT("GameplayHUD"), STATGROUP_GameplayHUD, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Widget pushes"), STAT_GameplayHUD_WidgetPushes, STATGROUP_GameplayHUD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Minimap repaints"), STAT_GameplayHUD_MinimapRepaints, STATGROUP_GameplayHUD);
+DECLARE_CYCLE_STAT(TEXT("ManagePlayerHUD"), STAT_GameplayHUD_PlayerHUD, STATGROUP_GameplayHUD);
+DECLARE_CYCLE_STAT(TEXT("ManageGameFlow"), STAT_GameplayHUD_GameFlow, STATGROUP_GameplayHUD);
+DECLARE_CYCLE_STAT(TEXT("ManageMinimap"), STAT_GameplayHUD_Minimap, STATGROUP_GameplayHUD);
+
 void UGameplayHelperLibrary::SetCharacterWalkSpeed(ACharacter* Character, float NewSpeed)
 {
 	if (!Character)
@@ -213,6 +224,14 @@ struct FPlayerHUDState
 	TSharedPtr<SWidget> VictoryOverlay;
 	TSharedPtr<STextBlock> VictoryCheckpointText;
 	TSharedPtr<STextBlock> VictoryActionText;
+
+	// Retained-mode cache: last values pushed to Slate (-1 = never pushed)
+	int8 PushedRootVisible = -1;
+	float PushedClipWidth = -1.f;
+	float PushedDamageFlashAlpha = -1.f;
+	float PushedGoldenFlashAlpha = -1.f;
+	float PushedCheckpointTextAlpha = -1.f;
+	FString PushedCheckpointText;
 };
 static FPlayerHUDState PlayerHUD;
 
@@ -262,20 +281,26 @@ static FGameFlowState GameFlow;
 
 // --- Minimap ---
 
-// Custom Slate widget that draws markers directly via OnPaint.
-// No RenderTransform, no layout-based positioning — just direct draw calls.
-// This guarantees markers stay within the widget's painted geometry.
-class SMinimapMarkerLayer : public SLeafWidget
+// One packed minimap marker: a tinted disc quad. 16 bytes, so hundreds of markers stay cache-friendly.
+struct FMinimapMarker
 {
-public:
-	struct FMarkerData
+	FVector2f Position; // top-left pixel position within widget
+	float Size;
+	FColor Color;
+
+	bool operator==(const FMinimapMarker& Other) const
 	{
-		FVector2D Position; // pixel position within widget
-		float Size;
-		const FSlateBrush* Brush;
-		bool bVisible;
-	};
+		return Position == Other.Position && Size == Other.Size && Color == Other.Color;
+	}
+};
 
+// Custom Slate widget that draws an arbitrary-length marker buffer via OnPaint.
+// No RenderTransform, no layout-based positioning — every marker is a quad in one
+// custom-verts batch sharing the disc texture, so marker count doesn't add draw elements.
+// Quads outside the clip rect (the inner map area) are culled before they reach the batch.
+class SMinimapMarkerLayer : public SLeafWidget
+{
+public:
 	SLATE_BEGIN_ARGS(SMinimapMarkerLayer) {}
 	SLATE_END_ARGS()
 
@@ -293,35 +318,61 @@ public:
 		const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
 		int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
 	{
-		for (const FMarkerData& M : Markers)
+		if (!DiscBrush || Markers.Num() == 0) return LayerId;
+
+		const FSlateResourceHandle& Handle = DiscBrush->GetRenderingResource();
+		if (!Handle.IsValid()) return LayerId;
+
+		// Scratch buffers keep their capacity between paints — no per-marker allocation
+		Verts.Reset();
+		Indices.Reset();
+
+		const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+		for (const FMinimapMarker& M : Markers)
 		{
-			if (!M.bVisible || !M.Brush) continue;
+			if (M.Position.X + M.Size < ClipRect.Left || M.Position.X > ClipRect.Right ||
+				M.Position.Y + M.Size < ClipRect.Top || M.Position.Y > ClipRect.Bottom)
+			{
+				continue;
+			}
 
-			FSlateDrawElement::MakeBox(
-				OutDrawElements,
-				LayerId,
-				AllottedGeometry.ToPaintGeometry(
-					FVector2D(M.Size, M.Size),
-					FSlateLayoutTransform(M.Position)),
-				M.Brush,
-				ESlateDrawEffect::None,
-				FLinearColor::White
-			);
+			const SlateIndex Base = (SlateIndex)Verts.Num();
+			const FVector2f TL = M.Position;
+			const FVector2f BR = M.Position + FVector2f(M.Size, M.Size);
+			Verts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(TL.X, TL.Y), FVector2f(0.f, 0.f), M.Color));
+			Verts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(BR.X, TL.Y), FVector2f(1.f, 0.f), M.Color));
+			Verts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(TL.X, BR.Y), FVector2f(0.f, 1.f), M.Color));
+			Verts.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(RenderTransform, FVector2f(BR.X, BR.Y), FVector2f(1.f, 1.f), M.Color));
+			Indices.Append({ Base, (SlateIndex)(Base + 1), (SlateIndex)(Base + 2),
+				(SlateIndex)(Base + 2), (SlateIndex)(Base + 1), (SlateIndex)(Base + 3) });
+		}
+
+		if (Indices.Num() > 0)
+		{
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, Verts, Indices, nullptr, 0, 0);
 		}
 		return LayerId;
 	}
 
-	void SetMarkerCount(int32 Count)
+	void SetDiscBrush(const FSlateBrush* InBrush)
 	{
-		Markers.SetNum(Count);
+		DiscBrush = InBrush;
 	}
 
-	void SetMarker(int32 Index, const FVector2D& Pos, float Size, const FSlateBrush* Brush, bool bVisible)
+	void SetClipRect(const FSlateRect& InRect)
 	{
-		if (Index < Markers.Num())
-		{
-			Markers[Index] = { Pos, Size, Brush, bVisible };
-		}
+		ClipRect = InRect;
+	}
+
+	const TArray<FMinimapMarker>& GetMarkers() const
+	{
+		return Markers;
+	}
+
+	// Swaps in a freshly packed buffer; the caller gets the old one back to refill next frame
+	void SwapMarkers(TArray<FMinimapMarker>& InOutMarkers)
+	{
+		Swap(Markers, InOutMarkers);
 	}
 
 	void RequestRepaint()
@@ -330,7 +381,11 @@ public:
 	}
 
 private:
-	TArray<FMarkerData> Markers;
+	TArray<FMinimapMarker> Markers;
+	const FSlateBrush* DiscBrush = nullptr;
+	FSlateRect ClipRect = FSlateRect(0.f, 0.f, 0.f, 0.f);
+	mutable TArray<FSlateVertex> Verts;
+	mutable TArray<SlateIndex> Indices;
 };
 
 struct FMinimapState
@@ -342,28 +397,51 @@ struct FMinimapState
 	TStrongObjectPtr<UTexture2D> MapTexture;
 	FSlateBrush MapBrush;
 
-	// Dot brushes (rounded circles)
-	FSlateBrush PlayerGlowBrush;    // large semi-transparent orange halo
-	FSlateBrush PlayerDotBrush;     // solid bright orange center
-	FSlateBrush CheckpointActiveBrush;
-	FSlateBrush CheckpointCollectedBrush;
+	// Anti-aliased white disc shared by every marker (tinted per vertex)
+	TStrongObjectPtr<UTexture2D> DiscTexture;
+	FSlateBrush DiscBrush;
 
 	// Widget references
 	TSharedPtr<SOverlay> RootWidget;
 	TSharedPtr<SMinimapMarkerLayer> MarkerLayer;
 
-	// Marker slot layout: [checkpoints 0..15] [player glow 16] [player dot 17]
-	static constexpr int32 MaxCheckpointMarkers = 16;
-	static constexpr int32 PlayerGlowSlot = MaxCheckpointMarkers;     // 16
-	static constexpr int32 PlayerDotSlot = MaxCheckpointMarkers + 1;  // 17
-	static constexpr int32 TotalMarkers = PlayerDotSlot + 1;          // 18
+	// Marker draw order: [checkpoints] [enemies] [player glow] [player dot]
+	// Packed into PendingMarkers each tick and swapped into the layer only when it differs.
+	TArray<FMinimapMarker> PendingMarkers;
 
 	// World bounds for coordinate mapping (auto-detected from landscape)
 	FVector2D WorldMin = FVector2D(-15000, -15000);
 	FVector2D WorldMax = FVector2D(15000, 15000);
+
+	// Retained-mode cache
+	int8 PushedRootVisible = -1;
 };
 static FMinimapState MinimapState;
 
+// --- Retained-mode HUD pushes ---
+// The Manage* HUD functions run from the player's tick but only touch Slate when a value
+// actually changed, so a static HUD does no widget work and its SInvalidationPanel keeps
+// the cached draw (also plays well with Slate.EnableGlobalInvalidation).
+
+static bool HUDPushVisibility(const TSharedPtr<SWidget>& Widget, int8& Pushed, bool bVisible)
+{
+	const int8 Want = bVisible ? 1 : 0;
+	if (!Widget.IsValid() || Pushed == Want) return false;
+	Widget->SetVisibility(bVisible ? EVisibility::Visible : EVisibility::Collapsed);
+	Pushed = Want;
+	INC_DWORD_STAT(STAT_GameplayHUD_WidgetPushes);
+	return true;
+}
+
+// Widths/alphas are compared at display precision so sub-pixel noise never invalidates
+static bool HUDValueChanged(float& Pushed, float Value, float Tolerance)
+{
+	if (Pushed >= 0.f && FMath::Abs(Pushed - Value) < Tolerance) return false;
+	Pushed = Value;
+	INC_DWORD_STAT(STAT_GameplayHUD_WidgetPushes);
+	return true;
+}
+
 static bool IsIntroSequenceRunning(ACharacter* Player)
 {
 	if (!Player)
@@ -380,6 +458,16 @@ static constexpr float MinimapHeight = 436.0f;  // 700 * (637/1024) preserving a
 static constexpr float MinimapPlayerGlowSize = 36.0f;  // glow halo behind player
 static constexpr float MinimapPlayerMarkerSize = 14.0f;
 static constexpr float MinimapCheckpointMarkerSize = 12.0f;
+static constexpr float MinimapEnemyMarkerSize = 8.0f;
+static constexpr int32 MinimapDiscTextureSize = 64;
+
+// Marker tints (vertex colors on the shared disc)
+static const FLinearColor MinimapPlayerGlowColor(1.0f, 0.50f, 0.05f, 0.35f);   // large semi-transparent orange halo
+static const FLinearColor MinimapPlayerDotColor(1.0f, 0.55f, 0.05f, 1.0f);     // solid bright orange center
+static const FLinearColor MinimapCheckpointOutlineColor(0.80f, 0.65f, 0.20f, 1.0f); // gold outline
+static const FLinearColor MinimapCheckpointActiveColor(1.0f, 1.0f, 0.85f, 0.9f);
+static const FLinearColor MinimapCheckpointCollectedColor(0.25f, 0.20f, 0.10f, 0.3f);
+static const FLinearColor MinimapEnemyColor(0.70f, 0.06f, 0.04f, 0.9f);
 
 // Inner map area (fraction of widget where markers move, inside the ornate frame)
 // Tightened inward to keep markers well within the painted map, off the frame border
@@ -425,6 +513,59 @@ static FVector2D WorldToMinimapPos(const FVector& WorldPos, float MarkerSize)
 	return FVector2D(PixelX, PixelY);
 }
 
+// Packs a marker snapped to whole pixels, so sub-pixel movement never changes the buffer.
+static void AddMinimapMarker(TArray<FMinimapMarker>& Out, const FVector2D& TopLeft, float Size, const FLinearColor& Color)
+{
+	Out.Add({ FVector2f(FMath::RoundToFloat((float)TopLeft.X), FMath::RoundToFloat((float)TopLeft.Y)),
+		Size, Color.ToFColor(true) });
+}
+
+// Unclamped variant for actors that may leave the map (enemies): off-map markers are culled by the layer
+static FVector2D WorldToMinimapPosUnclamped(const FVector& WorldPos, float MarkerSize)
+{
+	float NormX = (WorldPos.X - MinimapState.WorldMin.X) /
+		FMath::Max(MinimapState.WorldMax.X - MinimapState.WorldMin.X, 1.0);
+	float NormY = (WorldPos.Y - MinimapState.WorldMin.Y) /
+		FMath::Max(MinimapState.WorldMax.Y - MinimapState.WorldMin.Y, 1.0);
+
+	if (bMinimapSwapXY) Swap(NormX, NormY);
+	if (bMinimapFlipX) NormX = 1.0f - NormX;
+	if (bMinimapFlipY) NormY = 1.0f - NormY;
+
+	float FrameL = MinimapWidth * MinimapInnerLeft;
+	float FrameT = MinimapHeight * MinimapInnerTop;
+	float InnerW = MinimapWidth * MinimapInnerRight - FrameL;
+	float InnerH = MinimapHeight * MinimapInnerBottom - FrameT;
+
+	return FVector2D(FrameL + NormX * InnerW - MarkerSize * 0.5f, FrameT + NormY * InnerH - MarkerSize * 0.5f);
+}
+
+// Anti-aliased white disc, generated once per world instead of shipping a texture asset
+static UTexture2D* CreateMinimapDiscTexture()
+{
+	const int32 N = MinimapDiscTextureSize;
+	UTexture2D* Tex = UTexture2D::CreateTransient(N, N, PF_B8G8R8A8);
+	if (!Tex) return nullptr;
+
+	Tex->Filter = TF_Bilinear;
+	Tex->SRGB = true;
+	FColor* Pixels = static_cast<FColor*>(Tex->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE));
+	const float Center = N * 0.5f;
+	const float Radius = Center - 1.0f;
+	for (int32 Y = 0; Y < N; Y++)
+	{
+		for (int32 X = 0; X < N; X++)
+		{
+			const float Dist = FVector2f(X + 0.5f - Center, Y + 0.5f - Center).Size();
+			const float Alpha = FMath::Clamp(Radius - Dist + 0.5f, 0.f, 1.f);
+			Pixels[Y * N + X] = FColor(255, 255, 255, (uint8)FMath::RoundToInt(Alpha * 255.f));
+		}
+	}
+	Tex->GetPlatformData()->Mips[0].BulkData.Unlock();
+	Tex->UpdateResource();
+	return Tex;
+}
+
 // --- Enemy AI State Machine ---
 
 enum class EEnemyAIState : uint8
@@ -551,53 +692,53 @@ static FString GetEnemyTypeKey(AActor* Actor)
 
 enum class EEnemySoundType : uint8 { Hit, GettingHit, Steps };
 
-static void AddSoundIfExists(TArray<USoundBase*>& OutArray, const TCHAR* ObjectPath)
+static void AddSoundIfExists(const UObject* WorldContext, TArray<USoundBase*>& OutArray, const TCHAR* ObjectPath)
 {
-	USoundBase* Sound = Cast<USoundBase>(StaticLoadObject(USoundBase::StaticClass(), nullptr, ObjectPath));
+	USoundBase* Sound = UGameplayPreloadSubsystem::Resolve<USoundBase>(WorldContext, ObjectPath);
 	if (Sound)
 	{
 		OutArray.Add(Sound);
 	}
 }
 
-static void LoadNoamTrimEnemySounds(FEnemyTypeSounds& OutSounds, const FString& TypeKey)
+static void LoadNoamTrimEnemySounds(const UObject* WorldContext, FEnemyTypeSounds& OutSounds, const FString& TypeKey)
 {
 	// Policy: enemy SFX must come from the noam-trim set.
 	// In Content, those correspond to the numbered variants in each enemy folder.
 	if (TypeKey == TEXT("Bell"))
 	{
-		AddSoundIfExists(OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_Hit_1.S_Bell_Hit_1"));
-		AddSoundIfExists(OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_1.S_Bell_GettingHit_1"));
-		AddSoundIfExists(OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_2.S_Bell_GettingHit_2"));
-		AddSoundIfExists(OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_Steps_1.S_Bell_Steps_1"));
+		AddSoundIfExists(WorldContext, OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_Hit_1.S_Bell_Hit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_1.S_Bell_GettingHit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_2.S_Bell_GettingHit_2"));
+		AddSoundIfExists(WorldContext, OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Bell/S_Bell_Steps_1.S_Bell_Steps_1"));
 		return;
 	}
 
 	if (TypeKey == TEXT("KingBot"))
 	{
-		AddSoundIfExists(OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Hit_1.S_Kingbot_Hit_1"));
-		AddSoundIfExists(OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_GettingHit_1.S_Kingbot_GettingHit_1"));
-		AddSoundIfExists(OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Steps_1.S_Kingbot_Steps_1"));
+		AddSoundIfExists(WorldContext, OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Hit_1.S_Kingbot_Hit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_GettingHit_1.S_Kingbot_GettingHit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Steps_1.S_Kingbot_Steps_1"));
 		return;
 	}
 
 	if (TypeKey == TEXT("Gigantus"))
 	{
-		AddSoundIfExists(OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Hit_1.S_Gigantus_Hit_1"));
-		AddSoundIfExists(OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_GettingHit_1.S_Gigantus_GettingHit_1"));
-		AddSoundIfExists(OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Steps_1.S_Gigantus_Steps_1"));
+		AddSoundIfExists(WorldContext, OutSounds.HitSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Hit_1.S_Gigantus_Hit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.GettingHitSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_GettingHit_1.S_Gigantus_GettingHit_1"));
+		AddSoundIfExists(WorldContext, OutSounds.StepsSounds, TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Steps_1.S_Gigantus_Steps_1"));
 		return;
 	}
 }
 
-static FEnemyTypeSounds* GetOrLoadEnemyTypeSounds(const FString& TypeKey)
+static FEnemyTypeSounds* GetOrLoadEnemyTypeSounds(const UObject* WorldContext, const FString& TypeKey)
 {
 	if (TypeKey.IsEmpty()) return nullptr;
 	if (FEnemyTypeSounds* Existing = EnemyTypeSoundCache.Find(TypeKey))
 		return Existing;
 
 	FEnemyTypeSounds NewSounds;
-	LoadNoamTrimEnemySounds(NewSounds, TypeKey);
+	LoadNoamTrimEnemySounds(WorldContext, NewSounds, TypeKey);
 
 	UE_LOG(LogTemp, Log, TEXT("EnemyTypeSounds: Loaded '%s' — Hit=%d GettingHit=%d Steps=%d"),
 		*TypeKey, NewSounds.HitSounds.Num(), NewSounds.GettingHitSounds.Num(), NewSounds.StepsSounds.Num());
@@ -618,7 +759,7 @@ static void PlayEnemyTypeSound(UWorld* World, AActor* EnemyActor, EEnemySoundTyp
 	if (!kEnableEnemySfx) return;
 	if (!World || !EnemyActor) return;
 	FString TypeKey = GetEnemyTypeKey(EnemyActor);
-	FEnemyTypeSounds* Sounds = GetOrLoadEnemyTypeSounds(TypeKey);
+	FEnemyTypeSounds* Sounds = GetOrLoadEnemyTypeSounds(World, TypeKey);
 	if (!Sounds) return;
 
 	USoundBase* Sound = nullptr;
@@ -672,10 +813,10 @@ static void UpdateMusicCrossfade(UWorld* World)
 	if (!MusicSystem.bSoundsLoaded)
 	{
 		MusicSystem.bSoundsLoaded = true;
-		MusicSystem.ExplorationMusic = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr, TEXT("/Game/Audio/Music/S_Main_Theme.S_Main_Theme")));
-		MusicSystem.CombatMusic = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr, TEXT("/Game/Audio/Music/S_Action_1.S_Action_1")));
+		MusicSystem.ExplorationMusic = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/Music/S_Main_Theme.S_Main_Theme"));
+		MusicSystem.CombatMusic = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/Music/S_Action_1.S_Action_1"));
 	}
 
 	if (!MusicSystem.bInitialized)
@@ -782,21 +923,16 @@ static void UpdatePlayerFootsteps(ACharacter* Player)
 	if (!PlayerFootsteps.bSoundsLoaded)
 	{
 		PlayerFootsteps.bSoundsLoaded = true;
-		PlayerFootsteps.WalkL = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_L.S_Hero_Walk_L")));
-		PlayerFootsteps.WalkR = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_R.S_Hero_Walk_R")));
-		PlayerFootsteps.HitSound1 = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_1.S_Hero_Hit_1")));
-		PlayerFootsteps.HitSound2 = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_2.S_Hero_Hit_2")));
-		PlayerFootsteps.DeathSound = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Hero_Death.S_Hero_Death")));
+		PlayerFootsteps.WalkL = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_L.S_Hero_Walk_L"));
+		PlayerFootsteps.WalkR = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_R.S_Hero_Walk_R"));
+		PlayerFootsteps.HitSound1 = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_1.S_Hero_Hit_1"));
+		PlayerFootsteps.HitSound2 = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_2.S_Hero_Hit_2"));
+		PlayerFootsteps.DeathSound = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			World, TEXT("/Game/Audio/SFX/Hero/S_Hero_Death.S_Hero_Death"));
 
 		UE_LOG(LogTemp, Log, TEXT("PlayerFootsteps: WalkL=%s WalkR=%s Hit1=%s Hit2=%s Death=%s"),
 			PlayerFootsteps.WalkL ? TEXT("OK") : TEXT("MISSING"),
@@ -867,319 +1003,510 @@ static void UpdatePlayerFootsteps(ACharacter* Player)
 	}
 }
 
-void UGameplayHelperLibrary::ApplyMeleeDamage(ACharacter* Attacker, float Damage, float Radius, float KnockbackImpulse)
+// --- Batched Melee Resolution ---
+// ApplyMeleeDamage only queues a request. Once per frame, after all actors have ticked, the queue
+// is resolved against a shared broadphase: requests are clustered by proximity and each cluster
+// issues a single pawn overlap (a swarm around the player is one query, not one per attacker).
+// Every request then filters that candidate list (capsule distance, forward cone, single target
+// for the player) and all hits are applied in one pass. Inline capacities plus a reused overlap
+// buffer keep the steady state allocation-free.
+
+struct FMeleeAttackRequest
 {
-	if (!Attacker)
+	TWeakObjectPtr<ACharacter> Attacker;
+	FVector Origin = FVector::ZeroVector;
+	FVector Forward = FVector::ZeroVector; // flattened + normalized; zero = no cone filter
+	float Damage = 0.f;
+	float Radius = 0.f;
+	float KnockbackImpulse = 0.f;
+};
+
+struct FMeleeCandidate
+{
+	ACharacter* Character = nullptr;
+	FVector Location = FVector::ZeroVector;
+	float CapsuleRadius = 0.f;
+	float CapsuleHalfHeight = 0.f;
+};
+
+struct FMeleeHit
+{
+	ACharacter* Attacker = nullptr;
+	ACharacter* Victim = nullptr;
+	FVector Origin = FVector::ZeroVector;
+	float Damage = 0.f;
+	float KnockbackImpulse = 0.f;
+	bool bAttackerIsPlayer = false;
+};
+
+static constexpr int32 MeleeInlineRequests = 32;
+static constexpr int32 MeleeInlineCandidates = 64;
+static constexpr int32 MeleeInlineHits = 64;
+static constexpr float MeleeClusterRadius = 1500.f; // requests whose origins are this close share one overlap
+
+using FMeleeRequestList = TArray<FMeleeAttackRequest, TInlineAllocator<MeleeInlineRequests>>;
+
+struct FMeleeResolveQueue
+{
+	// Keyed per world so PIE clients / multiple game worlds each drain their own attacks on their own tick
+	TMap<TWeakObjectPtr<UWorld>, FMeleeRequestList> Requests;
+	FDelegateHandle PostTickHandle;
+	FDelegateHandle CleanupHandle;
+};
+static FMeleeResolveQueue MeleeQueue;
+
+// Reflection lookup of the Blueprint "Health" variable, cached per class
+static FProperty* FindHealthProperty(UClass* Class)
+{
+	static TMap<TWeakObjectPtr<UClass>, FProperty*> HealthPropertyCache;
+	if (!Class) return nullptr;
+	if (FProperty** Cached = HealthPropertyCache.Find(Class))
+	{
+		return *Cached;
+	}
+	FProperty* Prop = Class->FindPropertyByName(FName("Health"));
+	HealthPropertyCache.Add(Class, Prop);
+	return Prop;
+}
+
+// Sphere vs character capsule (vertical segment), matching what the old per-attack overlap accepted
+static bool IsCandidateInMeleeRange(const FMeleeCandidate& Candidate, const FVector& Origin, float Radius)
+{
+	const float SegHalf = FMath::Max(0.f, Candidate.CapsuleHalfHeight - Candidate.CapsuleRadius);
+	FVector Closest = Candidate.Location;
+	Closest.Z = FMath::Clamp(Origin.Z, Candidate.Location.Z - SegHalf, Candidate.Location.Z + SegHalf);
+	const float Reach = Radius + Candidate.CapsuleRadius;
+	return FVector::DistSquared(Origin, Closest) <= Reach * Reach;
+}
+
+static void ResolveMeleeHit(UWorld* World, ACharacter* Attacker, ACharacter* Victim, float Damage,
+	float KnockbackImpulse, const FVector& Origin, bool bAttackerIsPlayer, ACharacter* PlayerCharDmg)
+{
+	if (!IsValid(Victim))
 	{
 		return;
 	}
 
-	UWorld* World = Attacker->GetWorld();
-	if (!World)
+	// Prevent enemy-to-enemy friendly fire: AI enemies should only damage the player
+	bool bVictimIsPlayer = (Victim == PlayerCharDmg);
+	if (!bAttackerIsPlayer && !bVictimIsPlayer)
 	{
 		return;
 	}
 
-	// Sphere overlap to find nearby pawns
-	FVector Origin = Attacker->GetActorLocation();
-	TArray<FOverlapResult> Overlaps;
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(Attacker);
+	// Find "Health" property via reflection (supports both float and double BP variables)
+	FProperty* HealthProp = FindHealthProperty(Victim->GetClass());
+	if (!HealthProp)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ApplyMeleeDamage: %s has no 'Health' variable, skipping"), *Victim->GetName());
+		return;
+	}
+
+	void* ValuePtr = HealthProp->ContainerPtrToValuePtr<void>(Victim);
+	float CurrentHealth = 0.0f;
+
+	if (FFloatProperty* FloatProp = CastField<FFloatProperty>(HealthProp))
+	{
+		CurrentHealth = FloatProp->GetPropertyValue(ValuePtr);
+	}
+	else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(HealthProp))
+	{
+		CurrentHealth = (float)DoubleProp->GetPropertyValue(ValuePtr);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ApplyMeleeDamage: %s 'Health' is not float/double, skipping"), *Victim->GetName());
+		return;
+	}
 
-	World->OverlapMultiByChannel(Overlaps, Origin, FQuat::Identity, ECC_Pawn, Sphere, Params);
+	// Already dead
+	if (CurrentHealth <= 0.0f)
+	{
+		return;
+	}
 
-	// Deduplicate actors (multiple components can overlap)
-	TSet<ACharacter*> HitCharacters;
-	for (const FOverlapResult& Overlap : Overlaps)
+	// Apply damage
+	// Check blocking (75% damage reduction)
+	float EffectiveDamage = Damage;
+	if (BlockingActors.Contains(TWeakObjectPtr<AActor>(Victim)))
+	{
+		EffectiveDamage = Damage * 0.25f;
+		UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s blocked! %.0f -> %.0f"),
+			*Victim->GetName(), Damage, EffectiveDamage);
+	}
+	// Enemy durability tuning for player attacks
+	if (bAttackerIsPlayer && !bVictimIsPlayer)
 	{
-		AActor* HitActor = Overlap.GetActor();
-		if (!HitActor || HitActor == Attacker)
+		const FString VictimClass = Victim->GetClass()->GetName();
+		if (VictimClass.Contains(TEXT("Bell"), ESearchCase::IgnoreCase))
 		{
-			continue;
+			EffectiveDamage *= 0.60f;
 		}
-		ACharacter* HitChar = Cast<ACharacter>(HitActor);
-		if (HitChar)
+		else if (VictimClass.Contains(TEXT("KingBot"), ESearchCase::IgnoreCase))
 		{
-			HitCharacters.Add(HitChar);
+			EffectiveDamage *= 0.85f;
+		}
+		else if (VictimClass.Contains(TEXT("Giganto"), ESearchCase::IgnoreCase)
+			|| VictimClass.Contains(TEXT("Gigantus"), ESearchCase::IgnoreCase))
+		{
+			EffectiveDamage *= 0.80f;
 		}
 	}
+	CurrentHealth -= EffectiveDamage;
 
-	// --- FORWARD CONE FILTER ---
-	// Melee attacks are directional: only hit targets roughly in front of the attacker.
-	// This prevents hitting enemies behind or beside the attacker.
+	// Enemy attack-hit SFX: play only on confirmed damage to player.
+	// This keeps timing tied to real hits and prevents random far-away punch sounds.
+	if (!bAttackerIsPlayer && bVictimIsPlayer)
 	{
-		FVector Fwd = Attacker->GetActorForwardVector();
-		Fwd.Z = 0.f;
-		if (!Fwd.IsNearlyZero())
+		static TMap<TWeakObjectPtr<AActor>, double> LastEnemyHitSfxTime;
+		const TWeakObjectPtr<AActor> AttackerKey(Attacker);
+		const double Now = World->GetTimeSeconds();
+		double& LastTime = LastEnemyHitSfxTime.FindOrAdd(AttackerKey);
+		if ((Now - LastTime) >= 0.40)
 		{
-			Fwd.Normalize();
-			TSet<ACharacter*> InCone;
-			for (ACharacter* HC : HitCharacters)
-			{
-				FVector ToTarget = HC->GetActorLocation() - Origin;
-				ToTarget.Z = 0.f;
-				float Dist = ToTarget.Size();
-				if (Dist < 1.f) { InCone.Add(HC); continue; } // Overlapping = always hit
-				FVector Dir = ToTarget / Dist;
-				// cos(80°) ≈ 0.17 → ~160° cone in front of attacker
-				if (FVector::DotProduct(Fwd, Dir) > 0.17f)
-				{
-					InCone.Add(HC);
-				}
-			}
-			HitCharacters = InCone;
+			PlayEnemyTypeSound(World, Attacker, EEnemySoundType::Hit);
+			LastTime = Now;
 		}
 	}
 
-	// Determine if attacker is the player (for friendly-fire prevention)
-	ACharacter* PlayerCharDmg = UGameplayStatics::GetPlayerCharacter(World, 0);
-	bool bAttackerIsPlayer = (Attacker == PlayerCharDmg);
+	// NOTE: Attack SFX removed from here — will be added via AnimNotify later
+	// for proper animation-synced timing.
 
-	// --- SINGLE TARGET for player melee ---
-	// Player attacks hit only the closest enemy in the cone.
-	// This prevents AoE splash damage on grouped enemies.
-	if (bAttackerIsPlayer && HitCharacters.Num() > 1)
+	// Write back
+	if (FFloatProperty* FloatProp = CastField<FFloatProperty>(HealthProp))
 	{
-		ACharacter* Closest = nullptr;
-		float ClosestDistSq = FLT_MAX;
-		for (ACharacter* HC : HitCharacters)
-		{
-			float DSq = FVector::DistSquared(Origin, HC->GetActorLocation());
-			if (DSq < ClosestDistSq)
-			{
-				ClosestDistSq = DSq;
-				Closest = HC;
-			}
-		}
-		HitCharacters.Empty();
-		if (Closest) HitCharacters.Add(Closest);
+		FloatProp->SetPropertyValue(ValuePtr, CurrentHealth);
+	}
+	else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(HealthProp))
+	{
+		DoubleProp->SetPropertyValue(ValuePtr, (double)CurrentHealth);
 	}
 
-	for (ACharacter* Victim : HitCharacters)
+	UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s took %.0f damage, health now %.0f"), *Victim->GetName(), Damage, CurrentHealth);
+
+	// Trigger red flash if victim is player
+	ACharacter* PlayerCharFlash = UGameplayStatics::GetPlayerCharacter(World, 0);
+	if (Victim == PlayerCharFlash && CurrentHealth > 0.f)
 	{
-		if (!IsValid(Victim))
-		{
-			continue;
-		}
+		PlayerHUD.DamageFlashStartTime = World->GetTimeSeconds();
 
-		// Prevent enemy-to-enemy friendly fire: AI enemies should only damage the player
-		bool bVictimIsPlayer = (Victim == PlayerCharDmg);
-		if (!bAttackerIsPlayer && !bVictimIsPlayer)
+		// Player hit reaction animation (non-lethal only)
+		static UAnimSequence* PlayerHitAnim = nullptr;
+		static bool bPlayerHitAnimTried = false;
+		if (!bPlayerHitAnimTried)
 		{
-			continue;
+			bPlayerHitAnimTried = true;
+			PlayerHitAnim = UGameplayPreloadSubsystem::Resolve<UAnimSequence>(
+				World, TEXT("/Game/Characters/Robot/Animations/getting-hit.getting-hit"));
 		}
-
-		// Find "Health" property via reflection (supports both float and double BP variables)
-		FProperty* HealthProp = Victim->GetClass()->FindPropertyByName(FName("Health"));
-		if (!HealthProp)
+		if (PlayerHitAnim)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ApplyMeleeDamage: %s has no 'Health' variable, skipping"), *Victim->GetName());
-			continue;
+			PlayAnimationOneShot(PlayerCharFlash, PlayerHitAnim, 1.0f, 0.06f, 0.12f, false, true);
 		}
+	}
 
-		void* ValuePtr = HealthProp->ContainerPtrToValuePtr<void>(Victim);
-		float CurrentHealth = 0.0f;
-
-		if (FFloatProperty* FloatProp = CastField<FFloatProperty>(HealthProp))
-		{
-			CurrentHealth = FloatProp->GetPropertyValue(ValuePtr);
-		}
-		else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(HealthProp))
+	// Blood VFX (graceful null if asset missing)
+	static UNiagaraSystem* BloodFX = nullptr;
+	static bool bBloodLoadAttempted = false;
+	if (!bBloodLoadAttempted)
+	{
+		bBloodLoadAttempted = true;
+		BloodFX = UGameplayPreloadSubsystem::Resolve<UNiagaraSystem>(
+			World, TEXT("/Game/FX/NS_BloodBurst.NS_BloodBurst"));
+	}
+	if (BloodFX)
+	{
+		FVector HitLoc = Victim->GetActorLocation();
+		HitLoc.Z += 80.f;
+		if (UCombatPoolSubsystem* Pool = UCombatPoolSubsystem::Get(World))
 		{
-			CurrentHealth = (float)DoubleProp->GetPropertyValue(ValuePtr);
+			Pool->SpawnBloodFX(BloodFX, HitLoc);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ApplyMeleeDamage: %s 'Health' is not float/double, skipping"), *Victim->GetName());
-			continue;
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+				World, BloodFX, HitLoc, FRotator::ZeroRotator,
+				FVector(1.f), true, true, ENCPoolMethod::AutoRelease, true);
 		}
+	}
 
-		// Already dead
-		if (CurrentHealth <= 0.0f)
-		{
-			continue;
-		}
+	if (CurrentHealth <= 0.0f)
+	{
+		// --- DEATH ---
+		UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s died!"), *Victim->GetName());
+
+		// Check if this enemy is managed by UpdateEnemyAI (has state entry)
+		TWeakObjectPtr<AActor> VictimKey(Victim);
+		bool bManagedByAI = EnemyAIStates.Contains(VictimKey);
 
-		// Apply damage
-		// Check blocking (75% damage reduction)
-		float EffectiveDamage = Damage;
-		if (BlockingActors.Contains(TWeakObjectPtr<AActor>(Victim)))
+		if (bManagedByAI)
 		{
-			EffectiveDamage = Damage * 0.25f;
-			UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s blocked! %.0f -> %.0f"),
-				*Victim->GetName(), Damage, EffectiveDamage);
+			// Let UpdateEnemyAI handle death animation + cleanup on next tick
+			// Don't fully disable capsule — enemy needs floor support during death anim
+			// Just ignore pawns so the dead enemy doesn't block player movement
+			UCapsuleComponent* Capsule = Victim->GetCapsuleComponent();
+			if (Capsule)
+			{
+				Capsule->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+			}
 		}
-		// Enemy durability tuning for player attacks
-		if (bAttackerIsPlayer && !bVictimIsPlayer)
+		else
 		{
-			const FString VictimClass = Victim->GetClass()->GetName();
-			if (VictimClass.Contains(TEXT("Bell"), ESearchCase::IgnoreCase))
+			// Non-AI enemy or player: use ragdoll path
+			USkeletalMeshComponent* MeshComp = Victim->GetMesh();
+			if (MeshComp)
 			{
-				EffectiveDamage *= 0.60f;
+				MeshComp->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
+				MeshComp->SetSimulatePhysics(true);
+
+				// Knockback impulse away from attacker
+				FVector KnockDir = (Victim->GetActorLocation() - Origin).GetSafeNormal();
+				KnockDir.Z = 0.3f; // Slight upward arc
+				KnockDir.Normalize();
+				MeshComp->AddImpulse(KnockDir * KnockbackImpulse);
 			}
-			else if (VictimClass.Contains(TEXT("KingBot"), ESearchCase::IgnoreCase))
+
+			// Disable capsule collision so ragdoll doesn't fight it
+			UCapsuleComponent* Capsule = Victim->GetCapsuleComponent();
+			if (Capsule)
 			{
-				EffectiveDamage *= 0.85f;
+				Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 			}
-			else if (VictimClass.Contains(TEXT("Giganto"), ESearchCase::IgnoreCase)
-				|| VictimClass.Contains(TEXT("Gigantus"), ESearchCase::IgnoreCase))
+
+			// Stop movement
+			Victim->GetCharacterMovement()->DisableMovement();
+
+			// Check if victim is the player — don't destroy, let ManagePlayerHUD handle death screen
+			ACharacter* PlayerChar = UGameplayStatics::GetPlayerCharacter(World, 0);
+			if (Victim == PlayerChar)
 			{
-				EffectiveDamage *= 0.80f;
+				// Disable player input
+				APlayerController* PC = Cast<APlayerController>(Victim->GetController());
+				if (PC)
+				{
+					PC->DisableInput(PC);
+				}
+				// ManagePlayerHUD will detect HP<=0 on next tick and show death screen
 			}
-		}
-		CurrentHealth -= EffectiveDamage;
-
-		// Enemy attack-hit SFX: play only on confirmed damage to player.
-		// This keeps timing tied to real hits and prevents random far-away punch sounds.
-		if (!bAttackerIsPlayer && bVictimIsPlayer)
-		{
-			static TMap<TWeakObjectPtr<AActor>, double> LastEnemyHitSfxTime;
-			const TWeakObjectPtr<AActor> AttackerKey(Attacker);
-			const double Now = World->GetTimeSeconds();
-			double& LastTime = LastEnemyHitSfxTime.FindOrAdd(AttackerKey);
-			if ((Now - LastTime) >= 0.40)
+			else
 			{
-				PlayEnemyTypeSound(World, Attacker, EEnemySoundType::Hit);
-				LastTime = Now;
+				// Enemy: delayed destroy (1.5 seconds for ragdoll to settle)
+				TWeakObjectPtr<ACharacter> WeakVictim(Victim);
+				FTimerHandle DestroyTimer;
+				World->GetTimerManager().SetTimer(
+					DestroyTimer,
+					[WeakVictim]()
+					{
+						if (WeakVictim.IsValid())
+						{
+							WeakVictim->Destroy();
+						}
+					},
+					1.5f,
+					false
+				);
 			}
 		}
+	}
+}
+
+static void ResolveQueuedMeleeAttacks(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	FMeleeRequestList* WorldRequests = MeleeQueue.Requests.Find(World);
+	if (!WorldRequests || WorldRequests->Num() == 0)
+	{
+		return;
+	}
 
-		// NOTE: Attack SFX removed from here — will be added via AnimNotify later
-		// for proper animation-synced timing.
+	FMeleeRequestList Pending = MoveTemp(*WorldRequests);
+	WorldRequests->Reset();
 
-		// Write back
-		if (FFloatProperty* FloatProp = CastField<FFloatProperty>(HealthProp))
+	ACharacter* PlayerCharDmg = UGameplayStatics::GetPlayerCharacter(World, 0);
+
+	static TArray<FOverlapResult> SharedOverlaps; // reused: keeps its capacity between frames
+	TArray<FMeleeCandidate, TInlineAllocator<MeleeInlineCandidates>> Candidates;
+	TArray<FMeleeHit, TInlineAllocator<MeleeInlineHits>> Hits;
+	TArray<int32, TInlineAllocator<MeleeInlineRequests>> Cluster;
+	TBitArray<TInlineAllocator<(MeleeInlineRequests + 31) / 32>> Resolved(false, Pending.Num());
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(BatchedMeleeOverlap), false);
+
+	for (int32 Seed = 0; Seed < Pending.Num(); ++Seed)
+	{
+		if (Resolved[Seed])
 		{
-			FloatProp->SetPropertyValue(ValuePtr, CurrentHealth);
+			continue;
 		}
-		else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(HealthProp))
+
+		// Gather the cluster and the sphere that contains every request sphere in it
+		Cluster.Reset();
+		const FVector Center = Pending[Seed].Origin;
+		float QueryRadius = 0.f;
+		for (int32 i = Seed; i < Pending.Num(); ++i)
 		{
-			DoubleProp->SetPropertyValue(ValuePtr, (double)CurrentHealth);
+			if (Resolved[i]) continue;
+			const float Dist = FVector::Dist(Center, Pending[i].Origin);
+			if (i == Seed || Dist <= MeleeClusterRadius)
+			{
+				Resolved[i] = true;
+				Cluster.Add(i);
+				QueryRadius = FMath::Max(QueryRadius, Dist + Pending[i].Radius);
+			}
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s took %.0f damage, health now %.0f"), *Victim->GetName(), Damage, CurrentHealth);
+		// One broadphase query for the whole cluster
+		SharedOverlaps.Reset();
+		World->OverlapMultiByChannel(SharedOverlaps, Center, FQuat::Identity, ECC_Pawn,
+			FCollisionShape::MakeSphere(QueryRadius), Params);
 
-		// Trigger red flash if victim is player
-		ACharacter* PlayerCharFlash = UGameplayStatics::GetPlayerCharacter(World, 0);
-		if (Victim == PlayerCharFlash && CurrentHealth > 0.f)
+		// Deduplicate actors (multiple components can overlap)
+		Candidates.Reset();
+		for (const FOverlapResult& Overlap : SharedOverlaps)
 		{
-			PlayerHUD.DamageFlashStartTime = World->GetTimeSeconds();
-
-			// Player hit reaction animation (non-lethal only)
-			static UAnimSequence* PlayerHitAnim = nullptr;
-			static bool bPlayerHitAnimTried = false;
-			if (!bPlayerHitAnimTried)
+			ACharacter* HitChar = Cast<ACharacter>(Overlap.GetActor());
+			if (!HitChar || Candidates.ContainsByPredicate([HitChar](const FMeleeCandidate& C) { return C.Character == HitChar; }))
 			{
-				bPlayerHitAnimTried = true;
-				PlayerHitAnim = Cast<UAnimSequence>(StaticLoadObject(
-					UAnimSequence::StaticClass(), nullptr,
-					TEXT("/Game/Characters/Robot/Animations/getting-hit.getting-hit")));
+				continue;
 			}
-			if (PlayerHitAnim)
+			FMeleeCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+			Candidate.Character = HitChar;
+			Candidate.Location = HitChar->GetActorLocation();
+			if (const UCapsuleComponent* Cap = HitChar->GetCapsuleComponent())
 			{
-				PlayAnimationOneShot(PlayerCharFlash, PlayerHitAnim, 1.0f, 0.06f, 0.12f, false, true);
+				Candidate.CapsuleRadius = Cap->GetScaledCapsuleRadius();
+				Candidate.CapsuleHalfHeight = Cap->GetScaledCapsuleHalfHeight();
 			}
 		}
 
-		// Blood VFX (graceful null if asset missing)
-		static UNiagaraSystem* BloodFX = nullptr;
-		static bool bBloodLoadAttempted = false;
-		if (!bBloodLoadAttempted)
-		{
-			bBloodLoadAttempted = true;
-			BloodFX = Cast<UNiagaraSystem>(StaticLoadObject(
-				UNiagaraSystem::StaticClass(), nullptr,
-				TEXT("/Game/FX/NS_BloodBurst.NS_BloodBurst")));
-		}
-		if (BloodFX)
+		for (int32 RequestIndex : Cluster)
 		{
-			FVector HitLoc = Victim->GetActorLocation();
-			HitLoc.Z += 80.f;
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				World, BloodFX, HitLoc, FRotator::ZeroRotator,
-				FVector(1.f), true, true, ENCPoolMethod::None, true);
-		}
-
-		if (CurrentHealth <= 0.0f)
-		{
-			// --- DEATH ---
-			UE_LOG(LogTemp, Log, TEXT("ApplyMeleeDamage: %s died!"), *Victim->GetName());
-
-			// Check if this enemy is managed by UpdateEnemyAI (has state entry)
-			TWeakObjectPtr<AActor> VictimKey(Victim);
-			bool bManagedByAI = EnemyAIStates.Contains(VictimKey);
-
-			if (bManagedByAI)
+			const FMeleeAttackRequest& Request = Pending[RequestIndex];
+			ACharacter* Attacker = Request.Attacker.Get();
+			if (!IsValid(Attacker))
 			{
-				// Let UpdateEnemyAI handle death animation + cleanup on next tick
-				// Don't fully disable capsule — enemy needs floor support during death anim
-				// Just ignore pawns so the dead enemy doesn't block player movement
-				UCapsuleComponent* Capsule = Victim->GetCapsuleComponent();
-				if (Capsule)
-				{
-					Capsule->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-				}
+				continue;
 			}
-			else
+			const bool bAttackerIsPlayer = (Attacker == PlayerCharDmg);
+
+			const int32 FirstHit = Hits.Num();
+			for (const FMeleeCandidate& Candidate : Candidates)
 			{
-				// Non-AI enemy or player: use ragdoll path
-				USkeletalMeshComponent* MeshComp = Victim->GetMesh();
-				if (MeshComp)
+				if (Candidate.Character == Attacker || !IsCandidateInMeleeRange(Candidate, Request.Origin, Request.Radius))
 				{
-					MeshComp->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-					MeshComp->SetSimulatePhysics(true);
-
-					// Knockback impulse away from attacker
-					FVector KnockDir = (Victim->GetActorLocation() - Origin).GetSafeNormal();
-					KnockDir.Z = 0.3f; // Slight upward arc
-					KnockDir.Normalize();
-					MeshComp->AddImpulse(KnockDir * KnockbackImpulse);
+					continue;
 				}
 
-				// Disable capsule collision so ragdoll doesn't fight it
-				UCapsuleComponent* Capsule = Victim->GetCapsuleComponent();
-				if (Capsule)
+				// --- FORWARD CONE FILTER ---
+				// Melee attacks are directional: only hit targets roughly in front of the attacker.
+				if (!Request.Forward.IsZero())
 				{
-					Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+					FVector ToTarget = Candidate.Location - Request.Origin;
+					ToTarget.Z = 0.f;
+					const float Dist = ToTarget.Size();
+					// cos(80°) ≈ 0.17 → ~160° cone in front of attacker; overlapping = always hit
+					if (Dist >= 1.f && FVector::DotProduct(Request.Forward, ToTarget / Dist) <= 0.17f)
+					{
+						continue;
+					}
 				}
 
-				// Stop movement
-				Victim->GetCharacterMovement()->DisableMovement();
+				FMeleeHit& Hit = Hits.AddDefaulted_GetRef();
+				Hit.Attacker = Attacker;
+				Hit.Victim = Candidate.Character;
+				Hit.Origin = Request.Origin;
+				Hit.Damage = Request.Damage;
+				Hit.KnockbackImpulse = Request.KnockbackImpulse;
+				Hit.bAttackerIsPlayer = bAttackerIsPlayer;
+			}
 
-				// Check if victim is the player — don't destroy, let ManagePlayerHUD handle death screen
-				ACharacter* PlayerChar = UGameplayStatics::GetPlayerCharacter(World, 0);
-				if (Victim == PlayerChar)
+			// --- SINGLE TARGET for player melee ---
+			// Player attacks hit only the closest enemy in the cone (no AoE splash on grouped enemies).
+			if (bAttackerIsPlayer && Hits.Num() - FirstHit > 1)
+			{
+				int32 Closest = FirstHit;
+				float ClosestDistSq = FLT_MAX;
+				for (int32 h = FirstHit; h < Hits.Num(); ++h)
 				{
-					// Disable player input
-					APlayerController* PC = Cast<APlayerController>(Victim->GetController());
-					if (PC)
+					const float DSq = FVector::DistSquared(Request.Origin, Hits[h].Victim->GetActorLocation());
+					if (DSq < ClosestDistSq)
 					{
-						PC->DisableInput(PC);
+						ClosestDistSq = DSq;
+						Closest = h;
 					}
-					// ManagePlayerHUD will detect HP<=0 on next tick and show death screen
-				}
-				else
-				{
-					// Enemy: delayed destroy (1.5 seconds for ragdoll to settle)
-					TWeakObjectPtr<ACharacter> WeakVictim(Victim);
-					FTimerHandle DestroyTimer;
-					World->GetTimerManager().SetTimer(
-						DestroyTimer,
-						[WeakVictim]()
-						{
-							if (WeakVictim.IsValid())
-							{
-								WeakVictim->Destroy();
-							}
-						},
-						1.5f,
-						false
-					);
 				}
+				const FMeleeHit Keep = Hits[Closest];
+				Hits.SetNum(FirstHit, EAllowShrinking::No);
+				Hits.Add(Keep);
 			}
 		}
 	}
+
+	// Apply damage, knockback and FX for the whole frame in one pass
+	for (const FMeleeHit& Hit : Hits)
+	{
+		if (IsValid(Hit.Attacker))
+		{
+			ResolveMeleeHit(World, Hit.Attacker, Hit.Victim, Hit.Damage, Hit.KnockbackImpulse,
+				Hit.Origin, Hit.bAttackerIsPlayer, PlayerCharDmg);
+		}
+	}
+}
+
+void UGameplayHelperLibrary::ShutdownMeleeQueue()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(MeleeQueue.PostTickHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(MeleeQueue.CleanupHandle);
+	MeleeQueue.PostTickHandle.Reset();
+	MeleeQueue.CleanupHandle.Reset();
+	MeleeQueue.Requests.Empty();
+}
+
+// Drop a world's attacks when it goes away; unbind once no world has a queue left
+static void OnMeleeWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	MeleeQueue.Requests.Remove(World);
+	for (auto It = MeleeQueue.Requests.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	if (MeleeQueue.Requests.Num() == 0)
+	{
+		UGameplayHelperLibrary::ShutdownMeleeQueue();
+	}
+}
+
+void UGameplayHelperLibrary::ApplyMeleeDamage(ACharacter* Attacker, float Damage, float Radius, float KnockbackImpulse)
+{
+	if (!Attacker)
+	{
+		return;
+	}
+
+	UWorld* World = Attacker->GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (!MeleeQueue.PostTickHandle.IsValid())
+	{
+		MeleeQueue.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&ResolveQueuedMeleeAttacks);
+		MeleeQueue.CleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnMeleeWorldCleanup);
+	}
+
+	FMeleeAttackRequest& Request = MeleeQueue.Requests.FindOrAdd(World).AddDefaulted_GetRef();
+	Request.Attacker = Attacker;
+	Request.Origin = Attacker->GetActorLocation();
+	Request.Damage = Damage;
+	Request.Radius = Radius;
+	Request.KnockbackImpulse = KnockbackImpulse;
+
+	FVector Fwd = Attacker->GetActorForwardVector();
+	Fwd.Z = 0.f;
+	Request.Forward = Fwd.GetSafeNormal();
 }
 
 void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange, float AttackRange,
@@ -1196,6 +1523,14 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 
 	// Get/init state
 	TWeakObjectPtr<AActor> Key(Enemy);
+
+	// Preload gate: new enemies stay idle until the level's asset manifest is resident,
+	// so init (anim discovery, AnimBP, skeleton fix-up) never loads from disk mid-combat.
+	if (!EnemyAIStates.Contains(Key) && !UGameplayPreloadSubsystem::IsPreloadComplete(Enemy))
+	{
+		return;
+	}
+
 	FEnemyAIStateData& State = EnemyAIStates.FindOrAdd(Key);
 	if (!State.bInitialized)
 	{
@@ -1322,18 +1657,18 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 					// 1. Standard: {Type}/Animations/{Type}_{Suffix}
 					FString Name1 = AnimEnemyType + TEXT("_") + AnimSuffix;
 					FString Path1 = AnimSubPath + Name1 + TEXT(".") + Name1;
-					UAnimSequence* Anim = LoadObject<UAnimSequence>(nullptr, *Path1);
+					UAnimSequence* Anim = UGameplayPreloadSubsystem::Resolve<UAnimSequence>(Enemy, *Path1);
 					if (Anim) return Anim;
 
 					// 2. Giganto-style: {Type}/Anim_{Suffix}
 					FString Name2 = TEXT("Anim_") + AnimSuffix;
 					FString Path2 = AnimRootPath + Name2 + TEXT(".") + Name2;
-					Anim = LoadObject<UAnimSequence>(nullptr, *Path2);
+					Anim = UGameplayPreloadSubsystem::Resolve<UAnimSequence>(Enemy, *Path2);
 					if (Anim) return Anim;
 
 					// 3. Root folder with Type prefix: {Type}/{Type}_{Suffix}
 					FString Path3 = AnimRootPath + Name1 + TEXT(".") + Name1;
-					Anim = LoadObject<UAnimSequence>(nullptr, *Path3);
+					Anim = UGameplayPreloadSubsystem::Resolve<UAnimSequence>(Enemy, *Path3);
 					return Anim;
 				};
 
@@ -1471,8 +1806,8 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 			// never run Bell with the deprecated SK_Bell_New_Skeleton.
 			if (EnemyType == TEXT("Bell"))
 			{
-				USkeleton* TargetBellSkeleton = LoadObject<USkeleton>(
-					nullptr,
+				USkeleton* TargetBellSkeleton = UGameplayPreloadSubsystem::Resolve<USkeleton>(
+					Enemy,
 					TEXT("/Game/Characters/Enemies/Bell/SK_Bell_Skeleton.SK_Bell_Skeleton"));
 
 				if (TargetBellSkeleton)
@@ -1491,7 +1826,7 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 
 						for (const TCHAR* Path : BellMeshCandidates)
 						{
-							if (USkeletalMesh* Candidate = LoadObject<USkeletalMesh>(nullptr, Path))
+							if (USkeletalMesh* Candidate = UGameplayPreloadSubsystem::Resolve<USkeletalMesh>(Enemy, Path))
 							{
 								if (Candidate->GetSkeleton() == TargetBellSkeleton)
 								{
@@ -1524,7 +1859,7 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 				*EnemyType, *EnemyType, *EnemyType
 			);
 
-			UClass* AnimBPClass = LoadObject<UClass>(nullptr, *AnimBPPath);
+			UClass* AnimBPClass = UGameplayPreloadSubsystem::Resolve<UClass>(Enemy, *AnimBPPath);
 			if (AnimBPClass)
 			{
 				// Always force-assign — don't trust CDO propagation
@@ -1659,7 +1994,7 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 	}
 
 	// --- FLOATING HEALTH BAR ---
-	// Create UWidgetComponent on first tick (after health property is found)
+	// Acquire pooled UWidgetComponent on first tick (after health property is found)
 	if (!State.HealthBarComponent.IsValid() && HP > 0.f && HealthProp)
 	{
 		static TWeakObjectPtr<UClass> CachedWidgetClass;
@@ -1667,7 +2002,7 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 		if (!bWidgetClassLoadAttempted)
 		{
 			bWidgetClassLoadAttempted = true;
-			CachedWidgetClass = LoadClass<UUserWidget>(nullptr,
+			CachedWidgetClass = UGameplayPreloadSubsystem::ResolveClass<UUserWidget>(Enemy,
 				TEXT("/Game/UI/WBP_EnemyHealthBar.WBP_EnemyHealthBar_C"));
 			if (!CachedWidgetClass.IsValid())
 			{
@@ -1675,29 +2010,22 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 			}
 		}
 
-		if (CachedWidgetClass.IsValid())
+		UCombatPoolSubsystem* Pool = UCombatPoolSubsystem::Get(Enemy);
+		if (CachedWidgetClass.IsValid() && Pool)
 		{
-			UWidgetComponent* WC = NewObject<UWidgetComponent>(Enemy, NAME_None);
-			WC->SetupAttachment(Enemy->GetRootComponent());
-
 			// Position above head: capsule half-height + offset
 			UCapsuleComponent* Cap = Enemy->GetCapsuleComponent();
 			float HeadZ = Cap ? Cap->GetScaledCapsuleHalfHeight() + 30.f : 120.f;
-			WC->SetRelativeLocation(FVector(0, 0, HeadZ));
-
-			WC->SetWidgetSpace(EWidgetSpace::Screen);
-			WC->SetDrawSize(FVector2D(120, 10));
-			WC->SetPivot(FVector2D(0.5f, 0.5f));
-			WC->SetWidgetClass(CachedWidgetClass.Get());
-			WC->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-			WC->SetVisibility(false); // Hidden until damaged
-			WC->RegisterComponent();
 
-			State.HealthBarComponent = WC;
-			State.MaxHealth = HP;
+			UWidgetComponent* WC = Pool->AcquireHealthBar(Enemy, CachedWidgetClass.Get(), HeadZ);
+			if (WC)
+			{
+				State.HealthBarComponent = WC;
+				State.MaxHealth = HP;
 
-			UE_LOG(LogTemp, Log, TEXT("UpdateEnemyAI: Created health bar for %s (MaxHP=%.0f, HeadZ=%.0f)"),
-				*Enemy->GetName(), State.MaxHealth, HeadZ);
+				UE_LOG(LogTemp, Log, TEXT("UpdateEnemyAI: Acquired health bar for %s (MaxHP=%.0f, HeadZ=%.0f)"),
+					*Enemy->GetName(), State.MaxHealth, HeadZ);
+			}
 		}
 	}
 
@@ -1734,11 +2062,17 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 	{
 		if (!State.bDeathAnimStarted)
 		{
-			// Hide + destroy health bar on death
+			// Hide health bar on death and hand it back to the pool
 			if (State.HealthBarComponent.IsValid())
 			{
-				State.HealthBarComponent->SetVisibility(false);
-				State.HealthBarComponent->DestroyComponent();
+				if (UCombatPoolSubsystem* Pool = UCombatPoolSubsystem::Get(Enemy))
+				{
+					Pool->ReleaseHealthBar(State.HealthBarComponent.Get());
+				}
+				else
+				{
+					State.HealthBarComponent->SetVisibility(false);
+				}
 				State.HealthBarComponent = nullptr;
 			}
 
@@ -1842,7 +2176,7 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 					};
 					for (const TCHAR* Path : MeshPaths)
 					{
-						UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, Path);
+						UStaticMesh* Mesh = UGameplayPreloadSubsystem::Resolve<UStaticMesh>(Enemy, Path);
 						if (Mesh)
 						{
 							DebrisRockMeshes.Add(Mesh);
@@ -1850,12 +2184,14 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 					}
 				}
 
-				// Spawn 5 debris rock chunks at chest height
-				if (DebrisRockMeshes.Num() > 0)
+				// Burst 5 debris rock chunks at chest height (pooled actors, no spawn at steady state)
+				UCombatPoolSubsystem* Pool = UCombatPoolSubsystem::Get(Enemy);
+				if (DebrisRockMeshes.Num() > 0 && Pool)
 				{
 					FVector EnemyLoc = Enemy->GetActorLocation();
 					EnemyLoc.Z += 50.f;
 
+					constexpr float DebrisLifetime = 3.5f; // backstop; cleanup below releases at 3s
 					for (int32 i = 0; i < 5; i++)
 					{
 						FVector SpawnOffset(
@@ -1869,26 +2205,17 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 							FMath::FRandRange(0.f, 360.f),
 							FMath::FRandRange(0.f, 360.f)
 						);
-
-						FActorSpawnParameters SpawnParams;
-						SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-						SpawnParams.ObjectFlags = RF_Transient;
-
-						AActor* Debris = World->SpawnActor<AActor>(AActor::StaticClass(), SpawnLoc, SpawnRot, SpawnParams);
-						if (!Debris) continue;
-
-						UStaticMeshComponent* SMC = NewObject<UStaticMeshComponent>(Debris, NAME_None, RF_Transient);
-						SMC->SetStaticMesh(DebrisRockMeshes[FMath::RandRange(0, DebrisRockMeshes.Num() - 1)]);
-
 						float DebrisScale = FMath::FRandRange(0.15f, 0.5f);
-						SMC->SetRelativeScale3D(FVector(DebrisScale));
 
-						Debris->SetRootComponent(SMC);
-						SMC->RegisterComponent();
+						AActor* Debris = Pool->AcquireDebris(
+							DebrisRockMeshes[FMath::RandRange(0, DebrisRockMeshes.Num() - 1)],
+							FTransform(SpawnRot, SpawnLoc, FVector(DebrisScale)),
+							DebrisLifetime,
+							Enemy);
+						if (!Debris) continue;
 
-						// Physics setup
-						SMC->SetCollisionProfileName(TEXT("PhysicsActor"));
-						SMC->SetSimulatePhysics(true);
+						UStaticMeshComponent* SMC = Cast<UStaticMeshComponent>(Debris->GetRootComponent());
+						if (!SMC) continue;
 
 						// Outward + upward impulse for burst scatter
 						FVector ImpulseDir = FVector(
@@ -1912,11 +2239,12 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 
 				if (TimeSinceBreak >= BreakCleanupDelay)
 				{
+					UCombatPoolSubsystem* Pool = UCombatPoolSubsystem::Get(Enemy);
 					for (auto& WeakDebris : State.DebrisActors)
 					{
-						if (WeakDebris.IsValid())
+						if (WeakDebris.IsValid() && Pool)
 						{
-							WeakDebris->Destroy();
+							Pool->ReleaseDebris(WeakDebris.Get(), Enemy);
 						}
 					}
 					State.DebrisActors.Empty();
@@ -2439,6 +2767,8 @@ void UGameplayHelperLibrary::UpdateEnemyAI(ACharacter* Enemy, float AggroRange,
 
 void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameplayHUD_PlayerHUD);
+
 	if (!Player) return;
 	UWorld* World = Player->GetWorld();
 	if (!World) return;
@@ -2446,16 +2776,10 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 	// During intro cinematic, suppress gameplay HUD layers.
 	if (IsIntroSequenceRunning(Player))
 	{
-		if (PlayerHUD.RootWidget.IsValid())
-		{
-			PlayerHUD.RootWidget->SetVisibility(EVisibility::Collapsed);
-		}
+		HUDPushVisibility(PlayerHUD.RootWidget, PlayerHUD.PushedRootVisible, false);
 		return;
 	}
-	if (PlayerHUD.RootWidget.IsValid())
-	{
-		PlayerHUD.RootWidget->SetVisibility(EVisibility::Visible);
-	}
+	HUDPushVisibility(PlayerHUD.RootWidget, PlayerHUD.PushedRootVisible, true);
 
 	// Reset if world changed (level restart)
 	if (PlayerHUD.bCreated && (!PlayerHUD.OwnerWorld.IsValid() || PlayerHUD.OwnerWorld.Get() != World))
@@ -2513,9 +2837,9 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 			FVector2f(ContentL / SrcW, ContentT / SrcH),   // top-left  (0.0426, 0.0755)
 			FVector2f(ContentR / SrcW, ContentB / SrcH));   // bot-right (0.9751, 0.8066)
 
-		UTexture2D* BaseTex = LoadObject<UTexture2D>(nullptr, TEXT("/Game/UI/Textures/T_HB_Base.T_HB_Base"));
-		UTexture2D* FillTex = LoadObject<UTexture2D>(nullptr, TEXT("/Game/UI/Textures/T_HB_Fill.T_HB_Fill"));
-		UTexture2D* FrameTex = LoadObject<UTexture2D>(nullptr, TEXT("/Game/UI/Textures/T_HB_Frame.T_HB_Frame"));
+		UTexture2D* BaseTex = UGameplayPreloadSubsystem::Resolve<UTexture2D>(World, TEXT("/Game/UI/Textures/T_HB_Base.T_HB_Base"));
+		UTexture2D* FillTex = UGameplayPreloadSubsystem::Resolve<UTexture2D>(World, TEXT("/Game/UI/Textures/T_HB_Fill.T_HB_Fill"));
+		UTexture2D* FrameTex = UGameplayPreloadSubsystem::Resolve<UTexture2D>(World, TEXT("/Game/UI/Textures/T_HB_Frame.T_HB_Frame"));
 
 		if (BaseTex && FillTex && FrameTex)
 		{
@@ -2808,7 +3132,9 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 			];
 
 		PlayerHUD.RootWidget = Root;
-		GVC->AddViewportWidgetContent(TSharedRef<SWidget>(Root));
+		PlayerHUD.PushedRootVisible = 1;
+		// Invalidation panel caches the HUD draw; it only re-paints when a push below invalidates it
+		GVC->AddViewportWidgetContent(SNew(SInvalidationPanel)[Root]);
 		PlayerHUD.bCreated = true;
 	}
 
@@ -2816,7 +3142,7 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 	if (PlayerHUD.bDead) return;
 
 	// Read current health
-	FProperty* HealthProp = Player->GetClass()->FindPropertyByName(FName("Health"));
+	FProperty* HealthProp = FindHealthProperty(Player->GetClass());
 	if (!HealthProp) return;
 
 	void* ValPtr = HealthProp->ContainerPtrToValuePtr<void>(Player);
@@ -2834,7 +3160,7 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 	const float TubeRightPx = ((2440.0f - 120.0f) / 2626.0f) * HBDisplayWidth;  // ~442px
 	float ClipWidth = TubeLeftPx + (TubeRightPx - TubeLeftPx) * Pct;
 
-	if (PlayerHUD.HealthClipBox.IsValid())
+	if (PlayerHUD.HealthClipBox.IsValid() && HUDValueChanged(PlayerHUD.PushedClipWidth, ClipWidth, 0.5f))
 	{
 		PlayerHUD.HealthClipBox->SetWidthOverride(ClipWidth);
 	}
@@ -2843,17 +3169,20 @@ void UGameplayHelperLibrary::ManagePlayerHUD(ACharacter* Player)
 	if (PlayerHUD.DamageFlashBorder.IsValid() && PlayerHUD.DamageFlashStartTime > 0.0)
 	{
 		float Elapsed = (float)(World->GetTimeSeconds() - PlayerHUD.DamageFlashStartTime);
+		float Alpha = 0.0f;
 		if (Elapsed < 0.3f)
 		{
-			PlayerHUD.DamageFlashBorder->SetBorderBackgroundColor(
-				FLinearColor(0.50f, 0.10f, 0.03f, FMath::Lerp(0.40f, 0.0f, Elapsed / 0.3f)));
+			Alpha = FMath::Lerp(0.40f, 0.0f, Elapsed / 0.3f);
 		}
 		else
 		{
-			PlayerHUD.DamageFlashBorder->SetBorderBackgroundColor(
-				FLinearColor(0.50f, 0.10f, 0.03f, 0.0f));
 			PlayerHUD.DamageFlashStartTime = 0.0;
 		}
+		if (HUDValueChanged(PlayerHUD.PushedDamageFlashAlpha, Alpha, 1.0f / 255.0f))
+		{
+			PlayerHUD.DamageFlashBorder->SetBorderBackgroundColor(
+				FLinearColor(0.50f, 0.10f, 0.03f, Alpha));
+		}
 	}
 
 	// --- Dynamic Music Crossfade ---
@@ -2934,6 +3263,8 @@ bool UGameplayHelperLibrary::IsPlayerBlocking(ACharacter* Character)
 
 void UGameplayHelperLibrary::ManageGameFlow(ACharacter* Player)
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameplayHUD_GameFlow);
+
 	if (!Player) return;
 	UWorld* World = Player->GetWorld();
 	if (!World) return;
@@ -3175,9 +3506,8 @@ void UGameplayHelperLibrary::ManageGameFlow(ACharacter* Player)
 				if (!bCheckpointSoundLoadAttempted)
 				{
 					bCheckpointSoundLoadAttempted = true;
-					CheckpointSound = Cast<USoundBase>(StaticLoadObject(
-						USoundBase::StaticClass(), nullptr,
-						TEXT("/Game/Audio/SFX/S_Checkpoint_Chime.S_Checkpoint_Chime")));
+					CheckpointSound = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+						World, TEXT("/Game/Audio/SFX/S_Checkpoint_Chime.S_Checkpoint_Chime"));
 				}
 				if (CheckpointSound)
 				{
@@ -3267,13 +3597,19 @@ void UGameplayHelperLibrary::ManageGameFlow(ACharacter* Player)
 			{
 				Alpha = FMath::Lerp(0.35f, 0.0f, (Elapsed - 0.1f) / 0.4f);
 			}
-			PlayerHUD.GoldenFlashBorder->SetBorderBackgroundColor(
-				FLinearColor(0.55f, 0.35f, 0.10f, Alpha));
+			if (HUDValueChanged(PlayerHUD.PushedGoldenFlashAlpha, Alpha, 1.0f / 255.0f))
+			{
+				PlayerHUD.GoldenFlashBorder->SetBorderBackgroundColor(
+					FLinearColor(0.55f, 0.35f, 0.10f, Alpha));
+			}
 		}
 		else
 		{
-			PlayerHUD.GoldenFlashBorder->SetBorderBackgroundColor(
-				FLinearColor(0.55f, 0.35f, 0.10f, 0.0f));
+			if (HUDValueChanged(PlayerHUD.PushedGoldenFlashAlpha, 0.0f, 1.0f / 255.0f))
+			{
+				PlayerHUD.GoldenFlashBorder->SetBorderBackgroundColor(
+					FLinearColor(0.55f, 0.35f, 0.10f, 0.0f));
+			}
 			GameFlow.GoldenFlashStartTime = 0.0;
 		}
 	}
@@ -3297,14 +3633,25 @@ void UGameplayHelperLibrary::ManageGameFlow(ACharacter* Player)
 			{
 				Alpha = FMath::Lerp(1.0f, 0.0f, (Elapsed - 0.8f) / 0.7f);
 			}
-			PlayerHUD.CheckpointText->SetText(FText::FromString(GameFlow.CheckpointDisplayText));
-			PlayerHUD.CheckpointText->SetColorAndOpacity(
-				FSlateColor(FLinearColor(0.55f, 0.35f, 0.10f, Alpha)));
+			if (PlayerHUD.PushedCheckpointText != GameFlow.CheckpointDisplayText)
+			{
+				PlayerHUD.PushedCheckpointText = GameFlow.CheckpointDisplayText;
+				PlayerHUD.CheckpointText->SetText(FText::FromString(GameFlow.CheckpointDisplayText));
+				INC_DWORD_STAT(STAT_GameplayHUD_WidgetPushes);
+			}
+			if (HUDValueChanged(PlayerHUD.PushedCheckpointTextAlpha, Alpha, 1.0f / 255.0f))
+			{
+				PlayerHUD.CheckpointText->SetColorAndOpacity(
+					FSlateColor(FLinearColor(0.55f, 0.35f, 0.10f, Alpha)));
+			}
 		}
 		else
 		{
-			PlayerHUD.CheckpointText->SetColorAndOpacity(
-				FSlateColor(FLinearColor(0.55f, 0.35f, 0.10f, 0.0f)));
+			if (HUDValueChanged(PlayerHUD.PushedCheckpointTextAlpha, 0.0f, 1.0f / 255.0f))
+			{
+				PlayerHUD.CheckpointText->SetColorAndOpacity(
+					FSlateColor(FLinearColor(0.55f, 0.35f, 0.10f, 0.0f)));
+			}
 			GameFlow.CheckpointTextStartTime = 0.0;
 		}
 	}
@@ -3357,9 +3704,8 @@ void UGameplayHelperLibrary::ManageGameFlow(ACharacter* Player)
 			if (!bVictorySoundLoadAttempted)
 			{
 				bVictorySoundLoadAttempted = true;
-				VictorySound = Cast<USoundBase>(StaticLoadObject(
-					USoundBase::StaticClass(), nullptr,
-					TEXT("/Game/Audio/SFX/S_Victory_Fanfare.S_Victory_Fanfare")));
+				VictorySound = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+					World, TEXT("/Game/Audio/SFX/S_Victory_Fanfare.S_Victory_Fanfare"));
 			}
 			if (VictorySound)
 			{
@@ -3420,9 +3766,8 @@ void UGameplayHelperLibrary::StartIntroSequence(ACharacter* Character, UAnimSequ
 	UIntroSequenceComponent* IntroComp = NewObject<UIntroSequenceComponent>(Character);
 	if (!GettingUpSound)
 	{
-		GettingUpSound = Cast<USoundBase>(StaticLoadObject(
-			USoundBase::StaticClass(), nullptr,
-			TEXT("/Game/Audio/SFX/Hero/S_Robot_GettingUp.S_Robot_GettingUp")));
+		GettingUpSound = UGameplayPreloadSubsystem::Resolve<USoundBase>(
+			Character, TEXT("/Game/Audio/SFX/Hero/S_Robot_GettingUp.S_Robot_GettingUp"));
 	}
 	IntroComp->GettingUpAnimation = GettingUpAnimation;
 	IntroComp->GettingUpSound = GettingUpSound;
@@ -3454,6 +3799,8 @@ void UGameplayHelperLibrary::StartIntroSequence(ACharacter* Character, UAnimSequ
 
 void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameplayHUD_Minimap);
+
 	if (!Player) return;
 	UWorld* World = Player->GetWorld();
 	if (!World) return;
@@ -3461,10 +3808,7 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 	// During intro cinematic, hide minimap entirely.
 	if (IsIntroSequenceRunning(Player))
 	{
-		if (MinimapState.RootWidget.IsValid())
-		{
-			MinimapState.RootWidget->SetVisibility(EVisibility::Collapsed);
-		}
+		HUDPushVisibility(MinimapState.RootWidget, MinimapState.PushedRootVisible, false);
 		return;
 	}
 
@@ -3513,7 +3857,7 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 		}
 
 		// Load minimap texture
-		UTexture2D* MapTex = LoadObject<UTexture2D>(nullptr, TEXT("/Game/UI/Textures/T_Minimap.T_Minimap"));
+		UTexture2D* MapTex = UGameplayPreloadSubsystem::Resolve<UTexture2D>(World, TEXT("/Game/UI/Textures/T_Minimap.T_Minimap"));
 		if (MapTex)
 		{
 			MinimapState.MapTexture = TStrongObjectPtr<UTexture2D>(MapTex);
@@ -3527,21 +3871,21 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 			UE_LOG(LogTemp, Warning, TEXT("ManageMinimap: Failed to load /Game/UI/Textures/T_Minimap"));
 		}
 
-		// Player: bright orange dot with soft glow halo
-		MinimapState.PlayerGlowBrush = FSlateRoundedBoxBrush(
-			FLinearColor(1.0f, 0.50f, 0.05f, 0.35f), MinimapPlayerGlowSize * 0.5f);
-		MinimapState.PlayerDotBrush = FSlateRoundedBoxBrush(
-			FLinearColor(1.0f, 0.55f, 0.05f, 1.0f), MinimapPlayerMarkerSize * 0.5f);
-		// Checkpoints: bright white with slight blue tint (stands out on golden map)
-		MinimapState.CheckpointActiveBrush = FSlateRoundedBoxBrush(
-			FLinearColor(1.0f, 1.0f, 0.85f, 0.9f), MinimapCheckpointMarkerSize * 0.5f,
-			FLinearColor(0.80f, 0.65f, 0.20f, 1.0f), 2.0f); // gold outline
-		MinimapState.CheckpointCollectedBrush = FSlateRoundedBoxBrush(
-			FLinearColor(0.25f, 0.20f, 0.10f, 0.3f), MinimapCheckpointMarkerSize * 0.5f);
+		// Shared marker disc: player, checkpoints and enemies are all tinted copies of it
+		if (UTexture2D* DiscTex = CreateMinimapDiscTexture())
+		{
+			MinimapState.DiscTexture = TStrongObjectPtr<UTexture2D>(DiscTex);
+			MinimapState.DiscBrush.SetResourceObject(DiscTex);
+			MinimapState.DiscBrush.ImageSize = FVector2D(MinimapDiscTextureSize, MinimapDiscTextureSize);
+			MinimapState.DiscBrush.DrawAs = ESlateBrushDrawType::Image;
+		}
 
-		// Create custom marker layer (draws markers directly via OnPaint — no RenderTransform)
+		// Create custom marker layer (one batched custom-verts draw, culled to the inner map area)
 		TSharedRef<SMinimapMarkerLayer> Markers = SNew(SMinimapMarkerLayer);
-		Markers->SetMarkerCount(FMinimapState::TotalMarkers);
+		Markers->SetDiscBrush(&MinimapState.DiscBrush);
+		Markers->SetClipRect(FSlateRect(
+			MinimapWidth * MinimapInnerLeft, MinimapHeight * MinimapInnerTop,
+			MinimapWidth * MinimapInnerRight, MinimapHeight * MinimapInnerBottom));
 		MinimapState.MarkerLayer = Markers;
 
 		// Assemble root widget (anchored top-right)
@@ -3571,7 +3915,8 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 			];
 
 		MinimapState.RootWidget = Root;
-		GVC->AddViewportWidgetContent(TSharedRef<SWidget>(Root));
+		MinimapState.PushedRootVisible = 1;
+		GVC->AddViewportWidgetContent(SNew(SInvalidationPanel)[Root]);
 		MinimapState.bCreated = true;
 
 		UE_LOG(LogTemp, Log, TEXT("ManageMinimap: Created minimap widget (%.0fx%.0f)"),
@@ -3580,7 +3925,7 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 
 	// Hide minimap when player is dead
 	{
-		FProperty* HealthProp = Player->GetClass()->FindPropertyByName(FName("Health"));
+		FProperty* HealthProp = FindHealthProperty(Player->GetClass());
 		if (HealthProp)
 		{
 			void* ValPtr = HealthProp->ContainerPtrToValuePtr<void>(Player);
@@ -3592,51 +3937,61 @@ void UGameplayHelperLibrary::ManageMinimap(ACharacter* Player)
 
 			if (HP <= 0.f)
 			{
-				if (MinimapState.RootWidget.IsValid())
-					MinimapState.RootWidget->SetVisibility(EVisibility::Collapsed);
+				HUDPushVisibility(MinimapState.RootWidget, MinimapState.PushedRootVisible, false);
 				return;
 			}
 		}
 	}
 
 	// Ensure visible
-	if (MinimapState.RootWidget.IsValid())
-		MinimapState.RootWidget->SetVisibility(EVisibility::Visible);
+	HUDPushVisibility(MinimapState.RootWidget, MinimapState.PushedRootVisible, true);
 
 	if (!MinimapState.MarkerLayer.IsValid()) return;
 	SMinimapMarkerLayer& ML = *MinimapState.MarkerLayer;
 
-	// --- Update markers: soul checkpoints + player only ---
+	// --- Update markers: pack checkpoints, enemies and player into one buffer ---
+	// Positions are pixel-snapped, so the layer is only repainted when something visibly moved.
+	TArray<FMinimapMarker>& Packed = MinimapState.PendingMarkers;
+	Packed.Reset();
 
-	// Checkpoint (soul) markers — slots 0..15
+	// Checkpoint (soul) markers — gold outline disc under the fill disc
 	if (GameFlow.bInitialized)
 	{
-		int32 CPCount = FMath::Min(GameFlow.Checkpoints.Num(), (int32)FMinimapState::MaxCheckpointMarkers);
-		for (int32 i = 0; i < CPCount; i++)
+		static constexpr float OutlineWidth = 2.0f;
+		for (const FCheckpointData& CP : GameFlow.Checkpoints)
 		{
-			const FCheckpointData& CP = GameFlow.Checkpoints[i];
 			FVector2D Pos = WorldToMinimapPos(CP.Location, MinimapCheckpointMarkerSize);
-			const FSlateBrush* Brush = (CP.State == ECheckpointState::Collected)
-				? &MinimapState.CheckpointCollectedBrush
-				: &MinimapState.CheckpointActiveBrush;
-			ML.SetMarker(i, Pos, MinimapCheckpointMarkerSize, Brush, true);
+			if (CP.State == ECheckpointState::Collected)
+			{
+				AddMinimapMarker(Packed, Pos, MinimapCheckpointMarkerSize, MinimapCheckpointCollectedColor);
+			}
+			else
+			{
+				AddMinimapMarker(Packed, Pos, MinimapCheckpointMarkerSize, MinimapCheckpointOutlineColor);
+				AddMinimapMarker(Packed, Pos + FVector2D(OutlineWidth, OutlineWidth),
+					MinimapCheckpointMarkerSize - OutlineWidth * 2.0f, MinimapCheckpointActiveColor);
+			}
 		}
-		for (int32 i = CPCount; i < FMinimapState::MaxCheckpointMarkers; i++)
-			ML.SetMarker(i, FVector2D::ZeroVector, 0, nullptr, false);
 	}
-	else
+
+	// Enemies — straight from the AI state map, dead ones dropped
+	for (const auto& Pair : EnemyAIStates)
 	{
-		for (int32 i = 0; i < FMinimapState::MaxCheckpointMarkers; i++)
-			ML.SetMarker(i, FVector2D::ZeroVector, 0, nullptr, false);
+		const AActor* Enemy = Pair.Key.Get();
+		if (!Enemy || Enemy->GetWorld() != World || Pair.Value.CurrentState == EEnemyAIState::Dead) continue;
+		AddMinimapMarker(Packed, WorldToMinimapPosUnclamped(Enemy->GetActorLocation(), MinimapEnemyMarkerSize),
+			MinimapEnemyMarkerSize, MinimapEnemyColor);
 	}
 
-	// Player glow halo — slot 16 (drawn behind the dot)
-	FVector2D PlayerGlowPos = WorldToMinimapPos(Player->GetActorLocation(), MinimapPlayerGlowSize);
-	ML.SetMarker(FMinimapState::PlayerGlowSlot, PlayerGlowPos, MinimapPlayerGlowSize, &MinimapState.PlayerGlowBrush, true);
-
-	// Player dot — slot 17 (drawn last = on top)
-	FVector2D PlayerDotPos = WorldToMinimapPos(Player->GetActorLocation(), MinimapPlayerMarkerSize);
-	ML.SetMarker(FMinimapState::PlayerDotSlot, PlayerDotPos, MinimapPlayerMarkerSize, &MinimapState.PlayerDotBrush, true);
+	// Player glow halo (drawn behind the dot), then player dot (drawn last = on top)
+	const FVector PlayerLoc = Player->GetActorLocation();
+	AddMinimapMarker(Packed, WorldToMinimapPos(PlayerLoc, MinimapPlayerGlowSize), MinimapPlayerGlowSize, MinimapPlayerGlowColor);
+	AddMinimapMarker(Packed, WorldToMinimapPos(PlayerLoc, MinimapPlayerMarkerSize), MinimapPlayerMarkerSize, MinimapPlayerDotColor);
 
-	ML.RequestRepaint();
+	if (Packed != ML.GetMarkers())
+	{
+		ML.SwapMarkers(Packed);
+		ML.RequestRepaint();
+		INC_DWORD_STAT(STAT_GameplayHUD_MinimapRepaints);
+	}
 }
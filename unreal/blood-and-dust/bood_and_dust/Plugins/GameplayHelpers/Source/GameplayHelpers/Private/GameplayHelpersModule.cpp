@@ -1,8 +1,9 @@
 #include "Modules/ModuleManager.h"
+#include "GameplayHelperLibrary.h"
 
 // BUILD_ID: bump this every time you change plugin code and rebuild.
 // Search for this exact string in the editor log to confirm the new binary is loaded.
-#define GAMEPLAY_HELPERS_BUILD_ID TEXT("GameplayHelpers BUILD_ID=2026-02-16-v22")
+#define GAMEPLAY_HELPERS_BUILD_ID TEXT("GameplayHelpers BUILD_ID=2026-02-16-v32")
 
 class FGameplayHelpersModule : public IModuleInterface
 {
@@ -12,7 +13,10 @@ public:
 		UE_LOG(LogTemp, Warning, TEXT("=== %s LOADED ==="), GAMEPLAY_HELPERS_BUILD_ID);
 	}
 
-	virtual void ShutdownModule() override {}
+	virtual void ShutdownModule() override
+	{
+		UGameplayHelperLibrary::ShutdownMeleeQueue();
+	}
 };
 
 IMPLEMENT_MODULE(FGameplayHelpersModule, GameplayHelpers)
@@ -0,0 +1,322 @@
+#include "GameplayPreloadSubsystem.h"
+#include "Engine/World.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimBlueprint.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMesh.h"
+
+namespace
+{
+	// Built-in manifest: every fixed path GameplayHelperLibrary / IntroSequenceComponent load at runtime.
+	// Keep in sync when adding a new hardcoded asset path there.
+	const TCHAR* kDefaultPreloadAssets[] = {
+		// Music
+		TEXT("/Game/Audio/Music/S_Main_Theme.S_Main_Theme"),
+		TEXT("/Game/Audio/Music/S_Action_1.S_Action_1"),
+		// Hero
+		TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_L.S_Hero_Walk_L"),
+		TEXT("/Game/Audio/SFX/Hero/S_Hero_Walk_R.S_Hero_Walk_R"),
+		TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_1.S_Hero_Hit_1"),
+		TEXT("/Game/Audio/SFX/Hero/S_Hero_Hit_2.S_Hero_Hit_2"),
+		TEXT("/Game/Audio/SFX/Hero/S_Hero_Death.S_Hero_Death"),
+		TEXT("/Game/Audio/SFX/Hero/S_Robot_GettingUp.S_Robot_GettingUp"),
+		TEXT("/Game/Characters/Robot/Animations/getting-hit.getting-hit"),
+		// Enemy SFX (noam-trim set)
+		TEXT("/Game/Audio/SFX/Bell/S_Bell_Hit_1.S_Bell_Hit_1"),
+		TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_1.S_Bell_GettingHit_1"),
+		TEXT("/Game/Audio/SFX/Bell/S_Bell_GettingHit_2.S_Bell_GettingHit_2"),
+		TEXT("/Game/Audio/SFX/Bell/S_Bell_Steps_1.S_Bell_Steps_1"),
+		TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Hit_1.S_Kingbot_Hit_1"),
+		TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_GettingHit_1.S_Kingbot_GettingHit_1"),
+		TEXT("/Game/Audio/SFX/Kingbot/S_Kingbot_Steps_1.S_Kingbot_Steps_1"),
+		TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Hit_1.S_Gigantus_Hit_1"),
+		TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_GettingHit_1.S_Gigantus_GettingHit_1"),
+		TEXT("/Game/Audio/SFX/Gigantus/S_Gigantus_Steps_1.S_Gigantus_Steps_1"),
+		// Game flow
+		TEXT("/Game/Audio/SFX/S_Checkpoint_Chime.S_Checkpoint_Chime"),
+		TEXT("/Game/Audio/SFX/S_Victory_Fanfare.S_Victory_Fanfare"),
+		// Combat FX + death debris
+		TEXT("/Game/FX/NS_BloodBurst.NS_BloodBurst"),
+		TEXT("/Game/FX/NS_FloatingDust.NS_FloatingDust"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock01.rock_moss_set_01_rock01"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock02.rock_moss_set_01_rock02"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock03.rock_moss_set_01_rock03"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock04.rock_moss_set_01_rock04"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock05.rock_moss_set_01_rock05"),
+		TEXT("/Game/Meshes/Rocks/rock_moss_set_01_rock06.rock_moss_set_01_rock06"),
+		// UI
+		TEXT("/Game/UI/WBP_EnemyHealthBar.WBP_EnemyHealthBar_C"),
+		TEXT("/Game/UI/Textures/T_HB_Base.T_HB_Base"),
+		TEXT("/Game/UI/Textures/T_HB_Fill.T_HB_Fill"),
+		TEXT("/Game/UI/Textures/T_HB_Frame.T_HB_Frame"),
+		TEXT("/Game/UI/Textures/T_Minimap.T_Minimap"),
+		// Intro title scene
+		TEXT("/Game/Title/Meshes/SM_Title_BloodAndRust.SM_Title_BloodAndRust"),
+		TEXT("/Game/Title/Materials/M_Title_BloodAndRust.M_Title_BloodAndRust"),
+		TEXT("/Game/Title/Materials/M_IntroBackdrop_Black.M_IntroBackdrop_Black"),
+	};
+
+	// Enemy anims, AnimBPs and skeletons are discovered by naming convention at init,
+	// so the whole enemies folder is preloaded and misses resolve without touching disk.
+	const TCHAR* kDefaultPreloadDirectories[] = {
+		TEXT("/Game/Characters/Enemies"),
+	};
+
+	// Asset types the directory scan preloads completely. Only probes for these can be answered
+	// "missing" from the manifest; anything else in a scanned folder (Blueprints, materials) may exist.
+	TArray<const UClass*, TInlineAllocator<3>> GetScannedTypes()
+	{
+		return { UAnimSequence::StaticClass(), USkeleton::StaticClass(), USkeletalMesh::StaticClass() };
+	}
+}
+
+UGameplayPreloadSubsystem* UGameplayPreloadSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGameplayPreloadSubsystem>() : nullptr;
+}
+
+bool UGameplayPreloadSubsystem::IsPreloadComplete(const UObject* WorldContextObject)
+{
+	UGameplayPreloadSubsystem* Preload = Get(WorldContextObject);
+	return !Preload || Preload->IsComplete();
+}
+
+UObject* UGameplayPreloadSubsystem::ResolveAsset(const UObject* WorldContextObject, const TCHAR* ObjectPath, const UClass* Type)
+{
+	const FSoftObjectPath Path(ObjectPath);
+	if (UGameplayPreloadSubsystem* Preload = Get(WorldContextObject))
+	{
+		return Preload->ResolveInternal(Path, Type);
+	}
+	return Path.TryLoad();
+}
+
+bool UGameplayPreloadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGameplayPreloadSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TArray<FSoftObjectPath> Paths;
+	BuildManifest(Paths);
+
+	PreloadStartTime = FPlatformTime::Seconds();
+	if (Paths.Num() == 0)
+	{
+		OnPreloadComplete();
+		return;
+	}
+
+	PreloadHandle = Streamable.RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate::CreateUObject(this, &UGameplayPreloadSubsystem::OnPreloadComplete),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	UE_LOG(LogTemp, Log, TEXT("GameplayPreload: requested %d assets (%d packages)"), Paths.Num(), ManifestPackages.Num());
+}
+
+void UGameplayPreloadSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	bBegunPlay = true;
+	GateDeadline = FPlatformTime::Seconds() + GateTimeoutSeconds;
+}
+
+void UGameplayPreloadSubsystem::Deinitialize()
+{
+	LogHitchReport();
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+	ManifestPackages.Empty();
+	ScannedDirectories.Empty();
+	Hitches.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGameplayPreloadSubsystem::BuildManifest(TArray<FSoftObjectPath>& OutPaths)
+{
+	if (PreloadAssets.Num() > 0)
+	{
+		OutPaths.Append(PreloadAssets);
+	}
+	else
+	{
+		for (const TCHAR* Path : kDefaultPreloadAssets)
+		{
+			OutPaths.Emplace(Path);
+		}
+	}
+
+	ScannedDirectories = PreloadDirectories;
+	if (ScannedDirectories.Num() == 0)
+	{
+		for (const TCHAR* Dir : kDefaultPreloadDirectories)
+		{
+			ScannedDirectories.Add(Dir);
+		}
+	}
+
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	// While the registry is still discovering assets, "not in the manifest" doesn't mean missing
+	bManifestFromFullRegistry = AssetRegistry && !AssetRegistry->IsLoadingAssets();
+	if (AssetRegistry && ScannedDirectories.Num() > 0)
+	{
+		FARFilter Filter;
+		Filter.bRecursivePaths = true;
+		for (const FString& Dir : ScannedDirectories)
+		{
+			Filter.PackagePaths.Add(FName(*Dir));
+		}
+		for (const UClass* Type : GetScannedTypes())
+		{
+			Filter.ClassPaths.Add(Type->GetClassPathName());
+		}
+		Filter.ClassPaths.Add(UAnimBlueprint::StaticClass()->GetClassPathName());
+
+		TArray<FAssetData> Assets;
+		AssetRegistry->GetAssets(Filter, Assets);
+		for (const FAssetData& Asset : Assets)
+		{
+			if (Asset.AssetClassPath == UAnimBlueprint::StaticClass()->GetClassPathName())
+			{
+				// Load the generated class, which is what enemy init resolves (ABP_BG_X.ABP_BG_X_C)
+				OutPaths.Emplace(FString::Printf(TEXT("%s.%s_C"), *Asset.PackageName.ToString(), *Asset.AssetName.ToString()));
+			}
+			else
+			{
+				OutPaths.Add(Asset.GetSoftObjectPath());
+			}
+		}
+	}
+
+	for (const FSoftObjectPath& Path : OutPaths)
+	{
+		ManifestPackages.Add(Path.GetLongPackageFName());
+	}
+}
+
+void UGameplayPreloadSubsystem::OnPreloadComplete()
+{
+	bLoadComplete = true;
+	PreloadDurationMs = (FPlatformTime::Seconds() - PreloadStartTime) * 1000.0;
+
+	int32 Loaded = 0;
+	if (PreloadHandle.IsValid())
+	{
+		TArray<UObject*> LoadedAssets;
+		PreloadHandle->GetLoadedAssets(LoadedAssets);
+		Loaded = LoadedAssets.Num();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GameplayPreload: complete in %.1f ms (%d assets resident)"), PreloadDurationMs, Loaded);
+}
+
+bool UGameplayPreloadSubsystem::IsComplete() const
+{
+	if (bLoadComplete)
+	{
+		return true;
+	}
+	return bBegunPlay && FPlatformTime::Seconds() >= GateDeadline;
+}
+
+float UGameplayPreloadSubsystem::GetProgress() const
+{
+	if (bLoadComplete)
+	{
+		return 1.f;
+	}
+	return PreloadHandle.IsValid() ? PreloadHandle->GetProgress() : 0.f;
+}
+
+bool UGameplayPreloadSubsystem::IsKnownMissing(const FSoftObjectPath& Path, const UClass* Type) const
+{
+	if (!bLoadComplete || !bManifestFromFullRegistry || !Type)
+	{
+		return false;
+	}
+
+	const bool bScannedType = GetScannedTypes().ContainsByPredicate(
+		[Type](const UClass* Scanned) { return Type->IsChildOf(Scanned); });
+	if (!bScannedType)
+	{
+		return false;
+	}
+
+	const FName PackageName = Path.GetLongPackageFName();
+	if (ManifestPackages.Contains(PackageName))
+	{
+		return false;
+	}
+
+	const FString PackageString = PackageName.ToString();
+	for (const FString& Dir : ScannedDirectories)
+	{
+		if (PackageString.StartsWith(Dir + TEXT("/")))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+UObject* UGameplayPreloadSubsystem::ResolveInternal(const FSoftObjectPath& Path, const UClass* Type)
+{
+	if (UObject* Resident = Path.ResolveObject())
+	{
+		return Resident;
+	}
+
+	// Naming-convention probes (e.g. enemy anim variants) inside a preloaded folder: no disk hit
+	if (IsKnownMissing(Path, Type))
+	{
+		return nullptr;
+	}
+
+	const double Start = FPlatformTime::Seconds();
+	UObject* Loaded = Path.TryLoad();
+	const double DurationMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	if (bBegunPlay)
+	{
+		FGameplaySyncLoadHitch& Hitch = Hitches.AddDefaulted_GetRef();
+		Hitch.ObjectPath = Path.ToString();
+		Hitch.DurationMs = DurationMs;
+		Hitch.WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+		Hitch.bFound = (Loaded != nullptr);
+
+		UE_LOG(LogTemp, Warning, TEXT("GameplayPreload HITCH: sync load %s took %.2f ms at t=%.1fs (%s) - add it to the preload manifest"),
+			*Hitch.ObjectPath, DurationMs, Hitch.WorldTime, Loaded ? TEXT("found") : TEXT("missing"));
+	}
+	return Loaded;
+}
+
+void UGameplayPreloadSubsystem::LogHitchReport() const
+{
+	double TotalMs = 0.0;
+	for (const FGameplaySyncLoadHitch& Hitch : Hitches)
+	{
+		TotalMs += Hitch.DurationMs;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GameplayPreload report: preload %s in %.1f ms, %d sync loads during gameplay (%.1f ms total)"),
+		bLoadComplete ? TEXT("completed") : TEXT("INCOMPLETE"), PreloadDurationMs, Hitches.Num(), TotalMs);
+
+	for (const FGameplaySyncLoadHitch& Hitch : Hitches)
+	{
+		UE_LOG(LogTemp, Log, TEXT("  %.2f ms  t=%.1fs  %s%s"),
+			Hitch.DurationMs, Hitch.WorldTime, *Hitch.ObjectPath, Hitch.bFound ? TEXT("") : TEXT(" (missing)"));
+	}
+}
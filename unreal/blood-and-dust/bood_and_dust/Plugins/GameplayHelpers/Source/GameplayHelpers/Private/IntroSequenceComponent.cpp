@@ -1,4 +1,5 @@
 #include "IntroSequenceComponent.h"
+#include "GameplayPreloadSubsystem.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -141,10 +142,10 @@ bool UIntroSequenceComponent::SetupTitleScene()
 		return false;
 	}
 
-	UStaticMesh* TitleMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Game/Title/Meshes/SM_Title_BloodAndRust.SM_Title_BloodAndRust"));
+	UStaticMesh* TitleMesh = UGameplayPreloadSubsystem::Resolve<UStaticMesh>(this, TEXT("/Game/Title/Meshes/SM_Title_BloodAndRust.SM_Title_BloodAndRust"));
 	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
-	UMaterialInterface* TitleMat = LoadObject<UMaterialInterface>(nullptr, TEXT("/Game/Title/Materials/M_Title_BloodAndRust.M_Title_BloodAndRust"));
-	UMaterialInterface* BackdropMat = LoadObject<UMaterialInterface>(nullptr, TEXT("/Game/Title/Materials/M_IntroBackdrop_Black.M_IntroBackdrop_Black"));
+	UMaterialInterface* TitleMat = UGameplayPreloadSubsystem::Resolve<UMaterialInterface>(this, TEXT("/Game/Title/Materials/M_Title_BloodAndRust.M_Title_BloodAndRust"));
+	UMaterialInterface* BackdropMat = UGameplayPreloadSubsystem::Resolve<UMaterialInterface>(this, TEXT("/Game/Title/Materials/M_IntroBackdrop_Black.M_IntroBackdrop_Black"));
 
 	if (!TitleMesh || !CubeMesh || !BackdropMat)
 	{
@@ -229,7 +230,7 @@ bool UIntroSequenceComponent::SetupTitleScene()
 		}
 	}
 
-	UNiagaraSystem* FXSystem = LoadObject<UNiagaraSystem>(nullptr, TEXT("/Game/FX/NS_FloatingDust.NS_FloatingDust"));
+	UNiagaraSystem* FXSystem = UGameplayPreloadSubsystem::Resolve<UNiagaraSystem>(this, TEXT("/Game/FX/NS_FloatingDust.NS_FloatingDust"));
 	if (FXSystem)
 	{
 		TitleFXA = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
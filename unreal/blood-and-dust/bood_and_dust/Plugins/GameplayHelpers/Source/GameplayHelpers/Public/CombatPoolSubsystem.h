@@ -0,0 +1,172 @@
+// Per-world object pool for transient combat objects: death debris rocks, blood Niagara bursts
+// and floating enemy health bars. Pre-warmed on world begin play so death bursts and hits do
+// no SpawnActor/NewObject at steady state. Used by UGameplayHelperLibrary (ApplyMeleeDamage, UpdateEnemyAI).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatPoolSubsystem.generated.h"
+
+class AActor;
+class UStaticMesh;
+class UStaticMeshComponent;
+class UNiagaraSystem;
+class UNiagaraComponent;
+class UWidgetComponent;
+class UUserWidget;
+
+UENUM(BlueprintType)
+enum class ECombatPoolType : uint8
+{
+	Debris,
+	BloodFX,
+	HealthBar
+};
+
+USTRUCT(BlueprintType)
+struct GAMEPLAYHELPERS_API FCombatPoolStats
+{
+	GENERATED_BODY()
+
+	/** Acquire calls. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Requests = 0;
+
+	/** Acquires served by an idle pooled object. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Hits = 0;
+
+	/** Acquires that had to create a new object (pool grew). */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Misses = 0;
+
+	/** Hits that reclaimed the oldest in-use object because the pool was at capacity. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Evictions = 0;
+
+	/** Objects handed back by expiry or a destroyed owner rather than an explicit release. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Expired = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 InUse = 0;
+
+	/** Highest InUse seen this world. Tune the pre-warm sizes from this. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 HighWater = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Capacity = 0;
+
+	float GetHitRate() const { return Requests > 0 ? (float)Hits / (float)Requests : 1.f; }
+};
+
+USTRUCT()
+struct FCombatPoolEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UObject> Object = nullptr;
+
+	/** Actor the object is lent to. When it goes away the entry is reclaimed. */
+	TWeakObjectPtr<AActor> Borrower;
+
+	/** World time after which the entry is reclaimed; 0 = held until released. */
+	double ExpireTime = 0.0;
+
+	bool bInUse = false;
+};
+
+USTRUCT()
+struct FCombatPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FCombatPoolEntry> Entries;
+
+	FCombatPoolStats Stats;
+};
+
+UCLASS(Config=Game)
+class GAMEPLAYHELPERS_API UCombatPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Pre-warm sizes ([/Script/GameplayHelpers.CombatPoolSubsystem] in DefaultGame.ini). */
+	UPROPERTY(Config)
+	int32 DebrisPoolSize = 40;
+
+	UPROPERTY(Config)
+	int32 BloodFXPoolSize = 12;
+
+	UPROPERTY(Config)
+	int32 HealthBarPoolSize = 24;
+
+	/**
+	 * Hard caps for debris/FX. At the cap the oldest in-use object is recycled instead of growing;
+	 * debris lent to a live owner is never recycled.
+	 */
+	UPROPERTY(Config)
+	int32 MaxDebris = 80;
+
+	UPROPERTY(Config)
+	int32 MaxBloodFX = 24;
+
+	static UCombatPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Debris rock: hidden actor with a physics static mesh root. Returned placed, visible, simulating.
+	 * Owner (optional) keeps the rock from being recycled while it is alive; pass the same Owner to
+	 * ReleaseDebris so a rock that expired and was lent to someone else is left alone.
+	 */
+	AActor* AcquireDebris(UStaticMesh* Mesh, const FTransform& Transform, float Lifetime, AActor* Owner = nullptr);
+	void ReleaseDebris(AActor* Debris, AActor* Owner = nullptr);
+
+	/** Fire-and-forget Niagara burst. The component is reclaimed once the system completes. */
+	UNiagaraComponent* SpawnBloodFX(UNiagaraSystem* System, const FVector& Location);
+
+	/** Screen-space health bar attached to Owner's root; hidden until the caller shows it. */
+	UWidgetComponent* AcquireHealthBar(AActor* Owner, TSubclassOf<UUserWidget> WidgetClass, float HeadZ);
+	void ReleaseHealthBar(UWidgetComponent* HealthBar);
+
+	const FCombatPoolStats& GetStats(ECombatPoolType Type) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Gameplay|Pool")
+	void LogPoolStats() const;
+
+private:
+	UPROPERTY()
+	TObjectPtr<AActor> PoolHost = nullptr;
+
+	UPROPERTY()
+	FCombatPool DebrisPool;
+
+	UPROPERTY()
+	FCombatPool BloodFXPool;
+
+	UPROPERTY()
+	FCombatPool HealthBarPool;
+
+	AActor* GetOrCreateHost();
+	AActor* CreateDebris();
+	UNiagaraComponent* CreateBloodFX(UNiagaraSystem* System);
+	UWidgetComponent* CreateHealthBar(UClass* WidgetClass);
+
+	/** Frees in-use entries that expired, lost their borrower, or report finished. Returns count freed. */
+	int32 Sweep(FCombatPool& Pool, double Now, TFunctionRef<bool(UObject*)> IsFinished, TFunctionRef<void(UObject*)> Deactivate);
+	int32 FindOldestInUse(const FCombatPool& Pool, bool bSkipBorrowed = false) const;
+	void AddEntry(FCombatPool& Pool, UObject* Object);
+	void MarkInUse(FCombatPool& Pool, int32 Index, AActor* Borrower, double ExpireTime);
+	bool MarkFree(FCombatPool& Pool, UObject* Object);
+
+	void DeactivateDebris(UObject* Object) const;
+	void DeactivateHealthBar(UObject* Object) const;
+};
@@ -55,10 +55,14 @@ public:
 	/**
 	 * Melee damage sweep: sphere overlap around attacker, damage Characters
 	 * with a "Health" float variable, ragdoll + knockback + delayed destroy on death.
+	 * Queued and resolved once per frame after actor tick, batched with every other attack.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Gameplay|Combat", meta=(DefaultToSelf="Attacker"))
 	static void ApplyMeleeDamage(ACharacter* Attacker, float Damage = 15.0f, float Radius = 200.0f, float KnockbackImpulse = 50000.0f);
 
+	/** Unbind the melee resolve pass and drop queued attacks (world cleanup, module shutdown). */
+	static void ShutdownMeleeQueue();
+
 	/**
 	 * Tick-based enemy AI: chase player, attack in range, return when leashed.
 	 * Locomotion driven by AnimBP (reads CMC velocity). One-shots use montages.
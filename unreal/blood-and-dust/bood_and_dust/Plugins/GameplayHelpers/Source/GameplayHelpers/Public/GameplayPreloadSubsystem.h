@@ -0,0 +1,109 @@
+// Level-start async preload of every asset GameplayHelpers touches at runtime (music, SFX, blood FX,
+// debris rocks, UI textures, health-bar widget, enemy anims/AnimBPs/skeletons). Gameplay code resolves
+// assets through ResolveAsset(), which is an in-memory lookup once the manifest is loaded. Any sync load
+// that still happens after begin play is timed and recorded in the hitch report.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "GameplayPreloadSubsystem.generated.h"
+
+struct FGameplaySyncLoadHitch
+{
+	FString ObjectPath;
+	double DurationMs = 0.0;
+	double WorldTime = 0.0;
+	bool bFound = false;
+};
+
+UCLASS(Config=Game)
+class GAMEPLAYHELPERS_API UGameplayPreloadSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Manifest ([/Script/GameplayHelpers.GameplayPreloadSubsystem] in DefaultGame.ini).
+	 * Empty lists fall back to the built-in defaults in the .cpp.
+	 */
+	UPROPERTY(Config)
+	TArray<FSoftObjectPath> PreloadAssets;
+
+	/** Folders scanned (recursively) through the asset registry and preloaded whole. */
+	UPROPERTY(Config)
+	TArray<FString> PreloadDirectories;
+
+	/** Enemies wait idle at most this long for the preload before the gate opens anyway. */
+	UPROPERTY(Config)
+	float GateTimeoutSeconds = 10.0f;
+
+	static UGameplayPreloadSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Gate for gameplay systems. True when no subsystem exists (editor worlds), so callers never stall. */
+	static bool IsPreloadComplete(const UObject* WorldContextObject);
+
+	/**
+	 * In-memory resolve through the manifest, sync-load fallback (recorded as a hitch).
+	 * Type is the class the caller expects; a miss inside a scanned directory only skips the disk
+	 * when Type is one of the scanned asset types.
+	 */
+	static UObject* ResolveAsset(const UObject* WorldContextObject, const TCHAR* ObjectPath, const UClass* Type = nullptr);
+
+	template<typename T>
+	static T* Resolve(const UObject* WorldContextObject, const TCHAR* ObjectPath)
+	{
+		return Cast<T>(ResolveAsset(WorldContextObject, ObjectPath, T::StaticClass()));
+	}
+
+	/** Resolve a generated class (e.g. WBP_X_C), null unless it derives from T. Same contract as LoadClass<T>. */
+	template<typename T>
+	static UClass* ResolveClass(const UObject* WorldContextObject, const TCHAR* ObjectPath)
+	{
+		UClass* Class = Cast<UClass>(ResolveAsset(WorldContextObject, ObjectPath, UClass::StaticClass()));
+		return Class && Class->IsChildOf(T::StaticClass()) ? Class : nullptr;
+	}
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintPure, Category = "Gameplay|Preload")
+	bool IsComplete() const;
+
+	UFUNCTION(BlueprintPure, Category = "Gameplay|Preload")
+	float GetProgress() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Gameplay|Preload")
+	void LogHitchReport() const;
+
+	const TArray<FGameplaySyncLoadHitch>& GetHitches() const { return Hitches; }
+
+private:
+	FStreamableManager Streamable;
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	/**
+	 * Packages covered by the manifest; a miss of a scanned type (anim, skeleton, skeletal mesh)
+	 * inside a scanned directory is a known-missing asset.
+	 * Only trusted when the asset registry had finished its initial scan when the manifest was built.
+	 */
+	TSet<FName> ManifestPackages;
+	TArray<FString> ScannedDirectories;
+	bool bManifestFromFullRegistry = false;
+
+	TArray<FGameplaySyncLoadHitch> Hitches;
+
+	double PreloadStartTime = 0.0;
+	double PreloadDurationMs = 0.0;
+	double GateDeadline = 0.0;
+	bool bLoadComplete = false;
+	bool bBegunPlay = false;
+
+	void BuildManifest(TArray<FSoftObjectPath>& OutPaths);
+	void OnPreloadComplete();
+	bool IsKnownMissing(const FSoftObjectPath& Path, const UClass* Type) const;
+	UObject* ResolveInternal(const FSoftObjectPath& Path, const UClass* Type);
+};
@@ -1,4 +1,6 @@
 #include "Commands/BlueprintGraph/BPConnector.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
 #include "Engine/Blueprint.h"
 #include "K2Node.h"
@@ -6,7 +8,6 @@
 #include "EdGraph/EdGraphPin.h"
 #include "EdGraphSchema_K2.h"
 #include "Kismet2/KismetEditorUtilities.h"
-#include "EditorAssetLibrary.h"
 
 TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>& Params)
 {
@@ -23,35 +24,7 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
     Params->TryGetStringField(TEXT("function_name"), FunctionName);
 
     // Charger Blueprint - handle both full paths and simple names
-    UBlueprint* Blueprint = nullptr;
-    FString BlueprintPath = BlueprintName;
-
-    // If no path prefix, assume /Game/Blueprints/
-    if (!BlueprintPath.StartsWith(TEXT("/")))
-    {
-        BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintPath;
-    }
-
-    // Add .Blueprint suffix if not present
-    if (!BlueprintPath.Contains(TEXT(".")))
-    {
-        BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-    }
-
-    // Try to load the Blueprint
-    Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-
-    // If not found, try with UEditorAssetLibrary
-    if (!Blueprint)
-    {
-        FString AssetPath = BlueprintPath;
-        if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
-        {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-            Blueprint = Cast<UBlueprint>(Asset);
-        }
-    }
-
+    UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
     if (!Blueprint)
     {
         Result->SetBoolField("success", false);
@@ -64,29 +37,7 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
 
     if (!FunctionName.IsEmpty())
     {
-        // Strategy 1: Try exact name match with GetFName()
-        for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
-        {
-            if (FuncGraph && (FuncGraph->GetFName().ToString() == FunctionName ||
-                              (FuncGraph->GetOuter() && FuncGraph->GetOuter()->GetFName().ToString() == FunctionName)))
-            {
-                Graph = FuncGraph;
-                break;
-            }
-        }
-
-        // Strategy 2: Fallback - partial match for auto-generated names
-        if (!Graph)
-        {
-            for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
-            {
-                if (FuncGraph && FuncGraph->GetFName().ToString().Contains(FunctionName))
-                {
-                    Graph = FuncGraph;
-                    break;
-                }
-            }
-        }
+        Graph = FBPGraphCache::FindGraph(Blueprint, FunctionName);
 
         if (!Graph)
         {
@@ -116,8 +67,8 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
     }
 
     // Find nodes
-    UK2Node* SourceNode = FindNodeById(Graph, SourceNodeId);
-    UK2Node* TargetNode = FindNodeById(Graph, TargetNodeId);
+    UK2Node* SourceNode = Cast<UK2Node>(FBPGraphCache::FindNode(Graph, SourceNodeId));
+    UK2Node* TargetNode = Cast<UK2Node>(FBPGraphCache::FindNode(Graph, TargetNodeId));
 
     if (!SourceNode || !TargetNode)
     {
@@ -127,8 +78,8 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
     }
 
     // Trouver pins
-    UEdGraphPin* SourcePin = FindPinByName(SourceNode, SourcePinName, EGPD_Output);
-    UEdGraphPin* TargetPin = FindPinByName(TargetNode, TargetPinName, EGPD_Input);
+    UEdGraphPin* SourcePin = FBPGraphCache::FindPin(SourceNode, SourcePinName, EGPD_Output);
+    UEdGraphPin* TargetPin = FBPGraphCache::FindPin(TargetNode, TargetPinName, EGPD_Input);
 
     if (!SourcePin || !TargetPin)
     {
@@ -150,7 +101,7 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
 
     // Recompile
     Blueprint->MarkPackageDirty();
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    FBPEditSession::CompileOrDefer(Blueprint);
 
     // Return
     Result->SetBoolField("success", true);
@@ -167,50 +118,6 @@ TSharedPtr<FJsonObject> FBPConnector::ConnectNodes(const TSharedPtr<FJsonObject>
     return Result;
 }
 
-UK2Node* FBPConnector::FindNodeById(UEdGraph* Graph, const FString& NodeId)
-{
-    if (!Graph)
-    {
-        return nullptr;
-    }
-
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        if (!Node)
-        {
-            continue;
-        }
-
-        // Try matching by NodeGuid first
-        if (Node->NodeGuid.ToString().Equals(NodeId, ESearchCase::IgnoreCase))
-        {
-            UK2Node* K2Node = Cast<UK2Node>(Node);
-            return K2Node;  // Return even if nullptr (caller will handle)
-        }
-
-        // Try matching by GetName()
-        if (Node->GetName().Equals(NodeId, ESearchCase::IgnoreCase))
-        {
-            UK2Node* K2Node = Cast<UK2Node>(Node);
-            return K2Node;  // Return even if nullptr (caller will handle)
-        }
-    }
-
-    return nullptr;
-}
-
-UEdGraphPin* FBPConnector::FindPinByName(UK2Node* Node, const FString& PinName, EEdGraphPinDirection Direction)
-{
-    for (UEdGraphPin* Pin : Node->Pins)
-    {
-        if (Pin->PinName.ToString() == PinName && Pin->Direction == Direction)
-        {
-            return Pin;
-        }
-    }
-    return nullptr;
-}
-
 bool FBPConnector::ArePinsCompatible(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin)
 {
     if (SourcePin->Direction != EGPD_Output || TargetPin->Direction != EGPD_Input)
@@ -0,0 +1,237 @@
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Containers/Ticker.h"
+
+namespace
+{
+	struct FBlueprintEditSession
+	{
+		double StartTime = 0.0;
+		double LastEditTime = 0.0;
+		float TimeoutSeconds = 60.0f;
+		int32 EditCount = 0;
+		bool bNeedsCompile = false;
+		bool bNeedsMarkModified = false;
+		bool bNeedsStructuralMark = false;
+	};
+
+	TMap<TWeakObjectPtr<UBlueprint>, FBlueprintEditSession> GSessions;
+	FTSTicker::FDelegateHandle GTickHandle;
+
+	FBlueprintEditSession* FindSession(const UBlueprint* Blueprint)
+	{
+		return Blueprint ? GSessions.Find(TWeakObjectPtr<UBlueprint>(const_cast<UBlueprint*>(Blueprint))) : nullptr;
+	}
+}
+
+bool FBPEditSession::Begin(UBlueprint* Blueprint, float TimeoutSeconds)
+{
+	if (!Blueprint)
+	{
+		return false;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (FBlueprintEditSession* Existing = FindSession(Blueprint))
+	{
+		Existing->LastEditTime = Now;
+		Existing->TimeoutSeconds = FMath::Max(TimeoutSeconds, 1.0f);
+		return false;
+	}
+
+	FBlueprintEditSession& Session = GSessions.Add(Blueprint);
+	Session.StartTime = Now;
+	Session.LastEditTime = Now;
+	Session.TimeoutSeconds = FMath::Max(TimeoutSeconds, 1.0f);
+
+	if (!GTickHandle.IsValid())
+	{
+		GTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateStatic(&FBPEditSession::TickSessions), 1.0f);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("FBPEditSession: Opened edit session on '%s' (timeout %.0fs)"),
+		*Blueprint->GetName(), Session.TimeoutSeconds);
+	return true;
+}
+
+TSharedPtr<FJsonObject> FBPEditSession::Commit(UBlueprint* Blueprint)
+{
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	if (!Blueprint)
+	{
+		Result->SetBoolField(TEXT("success"), false);
+		Result->SetStringField(TEXT("error"), TEXT("Invalid Blueprint"));
+		return Result;
+	}
+
+	FBlueprintEditSession Session;
+	const bool bHadSession = GSessions.RemoveAndCopyValue(Blueprint, Session);
+
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("had_session"), bHadSession);
+	Result->SetNumberField(TEXT("edit_count"), Session.EditCount);
+	Result->SetNumberField(TEXT("session_seconds"), bHadSession ? FPlatformTime::Seconds() - Session.StartTime : 0.0);
+
+	// Structural edits done through the editor UI while the session was open still need a mark,
+	// so commit always refreshes once even if no MCP command recorded a change
+	if (Session.bNeedsStructuralMark)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
+	else
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	}
+	CompileWithResults(Blueprint, Result);
+
+	UE_LOG(LogTemp, Display, TEXT("FBPEditSession: Committed '%s' (%d edits, compile %.1f ms)"),
+		*Blueprint->GetName(), Session.EditCount, Result->GetNumberField(TEXT("compile_ms")));
+
+	if (GSessions.Num() == 0 && GTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(GTickHandle);
+		GTickHandle.Reset();
+	}
+
+	return Result;
+}
+
+bool FBPEditSession::IsOpen(const UBlueprint* Blueprint)
+{
+	return FindSession(Blueprint) != nullptr;
+}
+
+void FBPEditSession::CompileOrDefer(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	if (FBlueprintEditSession* Session = FindSession(Blueprint))
+	{
+		Session->bNeedsCompile = true;
+		Session->EditCount++;
+		Session->LastEditTime = FPlatformTime::Seconds();
+		return;
+	}
+
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+}
+
+void FBPEditSession::MarkModifiedOrDefer(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	if (FBlueprintEditSession* Session = FindSession(Blueprint))
+	{
+		Blueprint->MarkPackageDirty();
+		Session->bNeedsMarkModified = true;
+		Session->EditCount++;
+		Session->LastEditTime = FPlatformTime::Seconds();
+		return;
+	}
+
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+}
+
+void FBPEditSession::MarkStructurallyModifiedOrDefer(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	if (FBlueprintEditSession* Session = FindSession(Blueprint))
+	{
+		Blueprint->MarkPackageDirty();
+		Session->bNeedsStructuralMark = true;
+		Session->EditCount++;
+		Session->LastEditTime = FPlatformTime::Seconds();
+		return;
+	}
+
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+}
+
+void FBPEditSession::CompileWithResults(UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& Result)
+{
+	FCompilerResultsLog ResultsLog;
+	ResultsLog.bSilentMode = true;
+
+	const double CompileStart = FPlatformTime::Seconds();
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &ResultsLog);
+	const double CompileMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+
+	TArray<TSharedPtr<FJsonValue>> Messages;
+	for (const TSharedRef<FTokenizedMessage>& Message : ResultsLog.Messages)
+	{
+		const EMessageSeverity::Type Severity = Message->GetSeverity();
+		if (Severity != EMessageSeverity::Error && Severity != EMessageSeverity::Warning)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+		MessageObj->SetStringField(TEXT("severity"), Severity == EMessageSeverity::Error ? TEXT("error") : TEXT("warning"));
+		MessageObj->SetStringField(TEXT("message"), Message->ToText().ToString());
+		Messages.Add(MakeShared<FJsonValueObject>(MessageObj));
+	}
+
+	Result->SetNumberField(TEXT("compile_ms"), CompileMs);
+	Result->SetNumberField(TEXT("num_errors"), ResultsLog.NumErrors);
+	Result->SetNumberField(TEXT("num_warnings"), ResultsLog.NumWarnings);
+	Result->SetStringField(TEXT("status"), Blueprint->Status == BS_Error ? TEXT("error") :
+		(Blueprint->Status == BS_UpToDateWithWarnings ? TEXT("warnings") : TEXT("up_to_date")));
+	Result->SetArrayField(TEXT("messages"), Messages);
+}
+
+bool FBPEditSession::TickSessions(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<TWeakObjectPtr<UBlueprint>> Expired;
+	for (auto It = GSessions.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		if (Now - It->Value.LastEditTime > It->Value.TimeoutSeconds)
+		{
+			Expired.Add(It->Key);
+		}
+	}
+
+	for (const TWeakObjectPtr<UBlueprint>& Blueprint : Expired)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FBPEditSession: Session on '%s' idle past timeout, auto-committing"),
+			*Blueprint->GetName());
+		Commit(Blueprint.Get());
+	}
+
+	if (GSessions.Num() == 0)
+	{
+		GTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FBPEditSession::Reset()
+{
+	if (GTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(GTickHandle);
+		GTickHandle.Reset();
+	}
+	GSessions.Empty();
+}
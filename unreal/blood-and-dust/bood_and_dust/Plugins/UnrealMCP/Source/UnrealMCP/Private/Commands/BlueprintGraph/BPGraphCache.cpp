@@ -0,0 +1,307 @@
+#include "Commands/BlueprintGraph/BPGraphCache.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EditorAssetLibrary.h"
+
+namespace
+{
+	struct FNodeIndex
+	{
+		// Upper-cased NodeGuid string and object name -> node
+		TMap<FString, TWeakObjectPtr<UEdGraphNode>> ById;
+		int32 NodeCount = 0;
+		bool bStale = true;
+		FDelegateHandle ChangedHandle;
+	};
+
+	using FGraphKey = TPair<TWeakObjectPtr<UBlueprint>, FString>;
+
+	TMap<FString, TWeakObjectPtr<UBlueprint>> GBlueprints;
+	TMap<FGraphKey, TWeakObjectPtr<UEdGraph>> GGraphs;
+	TMap<TWeakObjectPtr<UEdGraph>, FNodeIndex> GNodeIndices;
+	// Node -> "PINNAME|direction" -> index into Node->Pins
+	TMap<TWeakObjectPtr<UEdGraphNode>, TMap<FString, int32>> GPinIndices;
+
+	constexpr int32 MaxPinIndexEntries = 8192;
+
+	FString MakePinKey(const FString& PinName, EEdGraphPinDirection Direction)
+	{
+		return FString::Printf(TEXT("%s|%d"), *PinName.ToUpper(), (int32)Direction);
+	}
+
+	void IndexNode(FNodeIndex& Index, UEdGraphNode* Node)
+	{
+		if (Node)
+		{
+			Index.ById.Add(Node->NodeGuid.ToString().ToUpper(), Node);
+			Index.ById.Add(Node->GetName().ToUpper(), Node);
+		}
+	}
+
+	void RebuildNodeIndex(UEdGraph* Graph, FNodeIndex& Index)
+	{
+		Index.ById.Reset();
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			IndexNode(Index, Node);
+		}
+		Index.NodeCount = Graph->Nodes.Num();
+		Index.bStale = false;
+	}
+
+	void OnGraphChanged(const FEdGraphEditAction& Action)
+	{
+		FNodeIndex* Index = Action.Graph ? GNodeIndices.Find(Action.Graph) : nullptr;
+		if (!Index || Index->bStale)
+		{
+			return;
+		}
+
+		// Keep the index in step with single adds/removes; anything else is rebuilt on next lookup
+		if (Action.Action & GRAPHACTION_AddNode)
+		{
+			for (const UEdGraphNode* Node : Action.Nodes)
+			{
+				IndexNode(*Index, const_cast<UEdGraphNode*>(Node));
+			}
+		}
+		else if (Action.Action & GRAPHACTION_RemoveNode)
+		{
+			for (const UEdGraphNode* Node : Action.Nodes)
+			{
+				if (Node)
+				{
+					Index->ById.Remove(Node->NodeGuid.ToString().ToUpper());
+					Index->ById.Remove(Node->GetName().ToUpper());
+					GPinIndices.Remove(const_cast<UEdGraphNode*>(Node));
+				}
+			}
+		}
+		else
+		{
+			Index->bStale = true;
+			return;
+		}
+
+		Index->NodeCount = Action.Graph->Nodes.Num();
+	}
+
+	bool GraphMatchesName(const UEdGraph* Graph, const FString& Name)
+	{
+		return Graph && (Graph->GetName().Equals(Name, ESearchCase::IgnoreCase) ||
+			(Graph->GetOuter() && Graph->GetOuter()->GetName().Equals(Name, ESearchCase::IgnoreCase)));
+	}
+}
+
+UBlueprint* FBPGraphCache::LoadBlueprint(const FString& BlueprintName)
+{
+	// If no path prefix, assume /Game/Blueprints/
+	FString BlueprintPath = BlueprintName;
+	if (!BlueprintPath.StartsWith(TEXT("/")))
+	{
+		BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintPath;
+	}
+
+	// Add .AssetName suffix if not present
+	if (!BlueprintPath.Contains(TEXT(".")))
+	{
+		BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
+	}
+
+	if (const TWeakObjectPtr<UBlueprint>* Cached = GBlueprints.Find(BlueprintPath))
+	{
+		// Renamed/moved assets keep the object alive under a new path
+		UBlueprint* BP = Cached->Get();
+		if (BP && BP->GetPathName() == BlueprintPath)
+		{
+			return BP;
+		}
+		GBlueprints.Remove(BlueprintPath);
+	}
+
+	UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+
+	// If not found, try with UEditorAssetLibrary
+	if (!BP && UEditorAssetLibrary::DoesAssetExist(BlueprintPath))
+	{
+		BP = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	}
+
+	if (BP)
+	{
+		GBlueprints.Add(BlueprintPath, BP);
+	}
+	return BP;
+}
+
+UEdGraph* FBPGraphCache::FindGraph(UBlueprint* Blueprint, const FString& FunctionName)
+{
+	if (!Blueprint)
+	{
+		return nullptr;
+	}
+
+	// No function name: EventGraph
+	if (FunctionName.IsEmpty())
+	{
+		return Blueprint->UbergraphPages.Num() > 0 ? Blueprint->UbergraphPages[0] : nullptr;
+	}
+
+	const FGraphKey Key(Blueprint, FunctionName.ToUpper());
+	if (const TWeakObjectPtr<UEdGraph>* Cached = GGraphs.Find(Key))
+	{
+		// Removed graphs are moved out of the Blueprint, renamed ones stop matching
+		UEdGraph* Graph = Cached->Get();
+		if (Graph && Graph->GetOuter() == Blueprint &&
+			(GraphMatchesName(Graph, FunctionName) || Graph->GetName().Contains(FunctionName)))
+		{
+			return Graph;
+		}
+		GGraphs.Remove(Key);
+	}
+
+	UEdGraph* Found = nullptr;
+	for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
+	{
+		if (GraphMatchesName(FuncGraph, FunctionName))
+		{
+			Found = FuncGraph;
+			break;
+		}
+	}
+
+	// Fallback: partial match for auto-generated names
+	if (!Found)
+	{
+		for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
+		{
+			if (FuncGraph && FuncGraph->GetName().Contains(FunctionName))
+			{
+				Found = FuncGraph;
+				break;
+			}
+		}
+	}
+
+	if (Found)
+	{
+		GGraphs.Add(Key, Found);
+	}
+	return Found;
+}
+
+UEdGraphNode* FBPGraphCache::FindNode(UEdGraph* Graph, const FString& NodeId)
+{
+	if (!Graph || NodeId.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	FNodeIndex& Index = GNodeIndices.FindOrAdd(Graph);
+	if (!Index.ChangedHandle.IsValid())
+	{
+		Index.ChangedHandle = Graph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateStatic(&OnGraphChanged));
+	}
+
+	bool bRebuilt = false;
+	if (Index.bStale || Index.NodeCount != Graph->Nodes.Num())
+	{
+		RebuildNodeIndex(Graph, Index);
+		bRebuilt = true;
+	}
+
+	const FString Key = NodeId.ToUpper();
+	if (const TWeakObjectPtr<UEdGraphNode>* Hit = Index.ById.Find(Key))
+	{
+		UEdGraphNode* Node = Hit->Get();
+		if (Node && Node->GetGraph() == Graph)
+		{
+			return Node;
+		}
+	}
+
+	// Guids are often assigned after AddNode, so a miss on a fresh-looking index gets one rescan
+	if (!bRebuilt)
+	{
+		RebuildNodeIndex(Graph, Index);
+		if (const TWeakObjectPtr<UEdGraphNode>* Hit = Index.ById.Find(Key))
+		{
+			return Hit->Get();
+		}
+	}
+
+	return nullptr;
+}
+
+UEdGraphPin* FBPGraphCache::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+{
+	if (!Node)
+	{
+		return nullptr;
+	}
+
+	const FString Key = MakePinKey(PinName, Direction);
+
+	// Pin arrays are reallocated by ReconstructNode, so cache indices and re-check the pin they point at
+	TMap<FString, int32>& PinMap = GPinIndices.FindOrAdd(Node);
+	if (const int32* PinIndex = PinMap.Find(Key))
+	{
+		if (Node->Pins.IsValidIndex(*PinIndex))
+		{
+			UEdGraphPin* Pin = Node->Pins[*PinIndex];
+			if (Pin && Pin->Direction == Direction && Pin->PinName.ToString() == PinName)
+			{
+				return Pin;
+			}
+		}
+	}
+
+	PinMap.Reset();
+	UEdGraphPin* Found = nullptr;
+	for (int32 i = 0; i < Node->Pins.Num(); ++i)
+	{
+		UEdGraphPin* Pin = Node->Pins[i];
+		if (!Pin)
+		{
+			continue;
+		}
+
+		const FString PinKey = MakePinKey(Pin->PinName.ToString(), Pin->Direction);
+		PinMap.FindOrAdd(PinKey, i);
+		if (!Found && Pin->Direction == Direction && Pin->PinName.ToString() == PinName)
+		{
+			Found = Pin;
+		}
+	}
+
+	if (GPinIndices.Num() > MaxPinIndexEntries)
+	{
+		for (auto It = GPinIndices.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	return Found;
+}
+
+void FBPGraphCache::Reset()
+{
+	for (TPair<TWeakObjectPtr<UEdGraph>, FNodeIndex>& Pair : GNodeIndices)
+	{
+		if (UEdGraph* Graph = Pair.Key.Get())
+		{
+			Graph->RemoveOnGraphChangedHandler(Pair.Value.ChangedHandle);
+		}
+	}
+
+	GBlueprints.Reset();
+	GGraphs.Reset();
+	GNodeIndices.Reset();
+	GPinIndices.Reset();
+}
@@ -1,4 +1,5 @@
 #include "Commands/BlueprintGraph/BPVariables.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
 #include "Engine/Blueprint.h"
 #include "EdGraphSchema_K2.h"
@@ -58,7 +59,7 @@ TSharedPtr<FJsonObject> FBPVariables::CreateVariable(const TSharedPtr<FJsonObjec
         Blueprint->MarkPackageDirty();
 
         // Force immediate refresh of the Blueprint editor
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
         // Force asset registry update
         if (GEditor)
@@ -74,7 +75,7 @@ TSharedPtr<FJsonObject> FBPVariables::CreateVariable(const TSharedPtr<FJsonObjec
             PropertyModule.NotifyCustomizationModuleChanged();
         }
 
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        FBPEditSession::CompileOrDefer(Blueprint);
 
         Result->SetBoolField("success", true);
 
@@ -373,7 +374,7 @@ TSharedPtr<FJsonObject> FBPVariables::SetVariableProperties(const TSharedPtr<FJs
 
     // Mark Blueprint as modified and compile
     Blueprint->MarkPackageDirty();
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     // Force property editor refresh for metadata changes
     // This ensures Details Panel dropdowns (Units, etc.) synchronize with metadata
@@ -383,7 +384,7 @@ TSharedPtr<FJsonObject> FBPVariables::SetVariableProperties(const TSharedPtr<FJs
         PropertyModule.NotifyCustomizationModuleChanged();
     }
 
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    FBPEditSession::CompileOrDefer(Blueprint);
 
     Result->SetBoolField("success", true);
     Result->SetStringField("variable_name", VariableName);
@@ -1,9 +1,10 @@
 #include "Commands/BlueprintGraph/EventManager.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "K2Node_Event.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "EditorAssetLibrary.h"
 
 TSharedPtr<FJsonObject> FEventManager::AddEventNode(const TSharedPtr<FJsonObject>& Params)
 {
@@ -39,7 +40,7 @@ TSharedPtr<FJsonObject> FEventManager::AddEventNode(const TSharedPtr<FJsonObject
 	}
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -66,7 +67,7 @@ TSharedPtr<FJsonObject> FEventManager::AddEventNode(const TSharedPtr<FJsonObject
 
 	// Notify changes
 	Graph->NotifyGraphChanged();
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 	return CreateSuccessResponse(EventNode);
 }
@@ -145,40 +146,6 @@ UK2Node_Event* FEventManager::FindExistingEventNode(UEdGraph* Graph, const FStri
 	return nullptr;
 }
 
-UBlueprint* FEventManager::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct path first
-	FString BlueprintPath = BlueprintName;
-
-	// If no path prefix, assume /Game/Blueprints/
-	if (!BlueprintPath.StartsWith(TEXT("/")))
-	{
-		BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintPath;
-	}
-
-	// Add .Blueprint suffix if not present
-	if (!BlueprintPath.Contains(TEXT(".")))
-	{
-		BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-	}
-
-	// Try to load the Blueprint
-	UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-
-	// If not found, try with UEditorAssetLibrary
-	if (!BP)
-	{
-		FString AssetPath = BlueprintPath;
-		if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
-		{
-			UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-			BP = Cast<UBlueprint>(Asset);
-		}
-	}
-
-	return BP;
-}
-
 TSharedPtr<FJsonObject> FEventManager::CreateSuccessResponse(const UK2Node_Event* EventNode)
 {
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject);
@@ -1,4 +1,6 @@
 #include "Commands/BlueprintGraph/Function/FunctionIO.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraphSchema_K2.h"
@@ -7,7 +9,6 @@
 #include "K2Node_FunctionResult.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_CallFunction.h"
-#include "EditorAssetLibrary.h"
 #include "EdGraph/EdGraphNode.h"
 
 TSharedPtr<FJsonObject> FFunctionIO::AddFunctionIO(const TSharedPtr<FJsonObject>& Params)
@@ -73,7 +74,7 @@ TSharedPtr<FJsonObject> FFunctionIO::AddFunctionIO(const TSharedPtr<FJsonObject>
 	}
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -94,7 +95,7 @@ TSharedPtr<FJsonObject> FFunctionIO::AddFunctionIO(const TSharedPtr<FJsonObject>
 	}
 
 	// Mark Blueprint as modified
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 	FunctionGraph->NotifyGraphChanged();
 
 	return CreateSuccessResponse(ParamName, ParamType, bIsInput);
@@ -278,30 +279,12 @@ bool FFunctionIO::AddFunctionParameter(
 	}
 
 	// Update the function signature
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 	FunctionGraph->NotifyGraphChanged();
 
 	return true;
 }
 
-UBlueprint* FFunctionIO::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct load
-	UBlueprint* Blueprint = Cast<UBlueprint>(StaticLoadObject(UBlueprint::StaticClass(), nullptr, *BlueprintName));
-	if (Blueprint)
-	{
-		return Blueprint;
-	}
-
-	// Try EditorAssetLibrary
-	if (UEditorAssetLibrary::DoesAssetExist(BlueprintName))
-	{
-		return Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintName));
-	}
-
-	return nullptr;
-}
-
 FEdGraphPinType FFunctionIO::GetPropertyTypeFromString(const FString& TypeName)
 {
 	FEdGraphPinType PinType;
@@ -353,36 +336,7 @@ UEdGraph* FFunctionIO::FindFunctionGraph(UBlueprint* Blueprint, const FString& F
 		return nullptr;
 	}
 
-	// Search in all function graphs
-	// Try exact name match first
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		if (Graph)
-		{
-			FString GraphName = Graph->GetFName().ToString();
-			// Try exact match
-			if (GraphName == FunctionName)
-			{
-				return Graph;
-			}
-			// Try matching the outer name (function name)
-			if (Graph->GetOuter() && Graph->GetOuter()->GetFName().ToString() == FunctionName)
-			{
-				return Graph;
-			}
-		}
-	}
-
-	// If not found, try to find by searching all graphs more broadly
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		if (Graph && Graph->GetFName().ToString().Contains(FunctionName))
-		{
-			return Graph;
-		}
-	}
-
-	return nullptr;
+	return FBPGraphCache::FindGraph(Blueprint, FunctionName);
 }
 
 bool FFunctionIO::ValidateParameterName(const FString& ParamName)
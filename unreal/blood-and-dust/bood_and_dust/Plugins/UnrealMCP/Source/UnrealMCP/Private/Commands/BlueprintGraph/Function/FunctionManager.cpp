@@ -1,9 +1,10 @@
 #include "Commands/BlueprintGraph/Function/FunctionManager.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
-#include "EditorAssetLibrary.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
 
@@ -39,7 +40,7 @@ TSharedPtr<FJsonObject> FFunctionManager::CreateFunction(const TSharedPtr<FJsonO
 	}
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -119,10 +120,10 @@ TSharedPtr<FJsonObject> FFunctionManager::CreateFunction(const TSharedPtr<FJsonO
 	}
 
 	// Mark Blueprint as modified
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 	// Compile the Blueprint AFTER verifying nodes (like GenBlueprintUtils does)
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FBPEditSession::CompileOrDefer(Blueprint);
 
 	// Get the actual graph name that was created
 	FString ActualGraphName = NewGraph->GetFName().ToString();
@@ -163,7 +164,7 @@ TSharedPtr<FJsonObject> FFunctionManager::DeleteFunction(const TSharedPtr<FJsonO
 	}
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -186,7 +187,7 @@ TSharedPtr<FJsonObject> FFunctionManager::DeleteFunction(const TSharedPtr<FJsonO
 	if (FunctionGraph)
 	{
 		FBlueprintEditorUtils::RemoveGraph(Blueprint, FunctionGraph);
-		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+		FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 		UE_LOG(LogTemp, Display, TEXT("Successfully deleted function '%s' from %s"), *FunctionName, *BlueprintName);
 
@@ -230,7 +231,7 @@ TSharedPtr<FJsonObject> FFunctionManager::RenameFunction(const TSharedPtr<FJsonO
 	}
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -257,40 +258,13 @@ TSharedPtr<FJsonObject> FFunctionManager::RenameFunction(const TSharedPtr<FJsonO
 
 	// Rename using FBlueprintEditorUtils
 	FBlueprintEditorUtils::RenameGraph(FunctionGraph, NewFunctionName);
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 	UE_LOG(LogTemp, Display, TEXT("Successfully renamed function '%s' to '%s' in %s"), *OldFunctionName, *NewFunctionName, *BlueprintName);
 
 	return CreateSuccessResponse(NewFunctionName);
 }
 
-UBlueprint* FFunctionManager::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct load with _C suffix first (most reliable for Blueprint assets)
-	FString ClassPath = BlueprintName + TEXT("_C");
-	UClass* BlueprintClass = Cast<UClass>(StaticLoadObject(UClass::StaticClass(), nullptr, *ClassPath));
-	if (BlueprintClass)
-	{
-		// Get the Blueprint asset from the class
-		for (TObjectIterator<UBlueprint> It; It; ++It)
-		{
-			if (It->GetPathName().Contains(BlueprintName))
-			{
-				return *It;
-			}
-		}
-	}
-
-	// Try EditorAssetLibrary as fallback
-	if (UEditorAssetLibrary::DoesAssetExist(BlueprintName))
-	{
-		UObject* Asset = UEditorAssetLibrary::LoadAsset(BlueprintName);
-		return Cast<UBlueprint>(Asset);
-	}
-
-	return nullptr;
-}
-
 bool FFunctionManager::ValidateFunctionName(const FString& FunctionName)
 {
 	if (FunctionName.IsEmpty())
@@ -333,34 +307,7 @@ UEdGraph* FFunctionManager::FindFunctionGraph(UBlueprint* Blueprint, const FStri
 		return nullptr;
 	}
 
-	// Strategy 1: Exact name match
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		if (Graph && Graph->GetFName().ToString() == FunctionName)
-		{
-			return Graph;
-		}
-	}
-
-	// Strategy 2: Search by outer object name
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		if (Graph && Graph->GetOuter() && Graph->GetOuter()->GetFName().ToString() == FunctionName)
-		{
-			return Graph;
-		}
-	}
-
-	// Strategy 3: Partial match (for auto-generated names like EdGraph_N)
-	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-	{
-		if (Graph && Graph->GetFName().ToString().Contains(FunctionName))
-		{
-			return Graph;
-		}
-	}
-
-	return nullptr;
+	return FBPGraphCache::FindGraph(Blueprint, FunctionName);
 }
 
 TSharedPtr<FJsonObject> FFunctionManager::CreateSuccessResponse(const FString& FunctionName, const FString& GraphID)
@@ -1,9 +1,10 @@
 #include "Commands/BlueprintGraph/NodeDeleter.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "EditorAssetLibrary.h"
 
 TSharedPtr<FJsonObject> FNodeDeleter::DeleteNode(const TSharedPtr<FJsonObject>& Params)
 {
@@ -31,14 +32,14 @@ TSharedPtr<FJsonObject> FNodeDeleter::DeleteNode(const TSharedPtr<FJsonObject>&
 	Params->TryGetStringField(TEXT("function_name"), FunctionName);
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
 	}
 
 	// Get the appropriate graph
-	UEdGraph* Graph = GetGraph(Blueprint, FunctionName);
+	UEdGraph* Graph = FBPGraphCache::FindGraph(Blueprint, FunctionName);
 	if (!Graph)
 	{
 		if (FunctionName.IsEmpty())
@@ -52,7 +53,7 @@ TSharedPtr<FJsonObject> FNodeDeleter::DeleteNode(const TSharedPtr<FJsonObject>&
 	}
 
 	// Find the node
-	UEdGraphNode* Node = FindNodeByID(Graph, NodeID);
+	UEdGraphNode* Node = FBPGraphCache::FindNode(Graph, NodeID);
 	if (!Node)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Node not found: %s"), *NodeID));
@@ -69,72 +70,13 @@ TSharedPtr<FJsonObject> FNodeDeleter::DeleteNode(const TSharedPtr<FJsonObject>&
 
 	// Notify changes
 	Graph->NotifyGraphChanged();
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 	UE_LOG(LogTemp, Display, TEXT("Successfully deleted node '%s' from %s"), *DeletedID, *BlueprintName);
 
 	return CreateSuccessResponse(DeletedID);
 }
 
-UEdGraph* FNodeDeleter::GetGraph(UBlueprint* Blueprint, const FString& FunctionName)
-{
-	if (!Blueprint)
-	{
-		return nullptr;
-	}
-
-	// If no function name, return EventGraph
-	if (FunctionName.IsEmpty())
-	{
-		if (Blueprint->UbergraphPages.Num() > 0)
-		{
-			return Blueprint->UbergraphPages[0];
-		}
-		return nullptr;
-	}
-
-	// Search in function graphs
-	for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
-	{
-		if (FuncGraph && FuncGraph->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-		{
-			return FuncGraph;
-		}
-	}
-
-	return nullptr;
-}
-
-UEdGraphNode* FNodeDeleter::FindNodeByID(UEdGraph* Graph, const FString& NodeID)
-{
-	if (!Graph)
-	{
-		return nullptr;
-	}
-
-	for (UEdGraphNode* Node : Graph->Nodes)
-	{
-		if (!Node)
-		{
-			continue;
-		}
-
-		// Try matching by NodeGuid
-		if (Node->NodeGuid.ToString().Equals(NodeID, ESearchCase::IgnoreCase))
-		{
-			return Node;
-		}
-
-		// Try matching by GetName()
-		if (Node->GetName().Equals(NodeID, ESearchCase::IgnoreCase))
-		{
-			return Node;
-		}
-	}
-
-	return nullptr;
-}
-
 bool FNodeDeleter::RemoveNode(UEdGraph* Graph, UEdGraphNode* Node)
 {
 	if (!Graph || !Node)
@@ -151,40 +93,6 @@ bool FNodeDeleter::RemoveNode(UEdGraph* Graph, UEdGraphNode* Node)
 	return true;
 }
 
-UBlueprint* FNodeDeleter::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct path first
-	FString BlueprintPath = BlueprintName;
-
-	// If no path prefix, assume /Game/Blueprints/
-	if (!BlueprintPath.StartsWith(TEXT("/")))
-	{
-		BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintName;
-	}
-
-	// Add .Blueprint suffix if not present
-	if (!BlueprintPath.Contains(TEXT(".")))
-	{
-		BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-	}
-
-	// Try to load the Blueprint
-	UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-
-	// If not found, try with UEditorAssetLibrary
-	if (!BP)
-	{
-		FString AssetPath = BlueprintPath;
-		if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
-		{
-			UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-			BP = Cast<UBlueprint>(Asset);
-		}
-	}
-
-	return BP;
-}
-
 TSharedPtr<FJsonObject> FNodeDeleter::CreateSuccessResponse(const FString& DeletedNodeID)
 {
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject);
@@ -1,4 +1,6 @@
 #include "Commands/BlueprintGraph/NodeManager.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Commands/BlueprintGraph/Nodes/ControlFlowNodes.h"
 #include "Commands/BlueprintGraph/Nodes/DataNodes.h"
 #include "Commands/BlueprintGraph/Nodes/UtilityNodes.h"
@@ -17,7 +19,6 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "KismetCompiler.h"
-#include "EditorAssetLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -55,7 +56,7 @@ TSharedPtr<FJsonObject> FBlueprintNodeManager::AddNode(const TSharedPtr<FJsonObj
 	}
 
 	// Load the Blueprint
-	UBlueprint* BP = LoadBlueprint(BlueprintName);
+	UBlueprint* BP = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!BP)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -67,29 +68,7 @@ TSharedPtr<FJsonObject> FBlueprintNodeManager::AddNode(const TSharedPtr<FJsonObj
 
 	if (NodeParams->TryGetStringField(TEXT("function_name"), FunctionName) && !FunctionName.IsEmpty())
 	{
-		// Try to find the function graph
-		for (UEdGraph* FuncGraph : BP->FunctionGraphs)
-		{
-			if (FuncGraph && (FuncGraph->GetFName().ToString() == FunctionName ||
-							  (FuncGraph->GetOuter() && FuncGraph->GetOuter()->GetFName().ToString() == FunctionName)))
-			{
-				Graph = FuncGraph;
-				break;
-			}
-		}
-
-		if (!Graph)
-		{
-			// Fallback: partial match for auto-generated names
-			for (UEdGraph* FuncGraph : BP->FunctionGraphs)
-			{
-				if (FuncGraph && FuncGraph->GetFName().ToString().Contains(FunctionName))
-				{
-					Graph = FuncGraph;
-					break;
-				}
-			}
-		}
+		Graph = FBPGraphCache::FindGraph(BP, FunctionName);
 
 		if (!Graph)
 		{
@@ -225,7 +204,7 @@ TSharedPtr<FJsonObject> FBlueprintNodeManager::AddNode(const TSharedPtr<FJsonObj
 
 	// Notify changes
 	Graph->NotifyGraphChanged();
-	FBlueprintEditorUtils::MarkBlueprintAsModified(BP);
+	FBPEditSession::MarkModifiedOrDefer(BP);
 
 	// Ensure node has a valid GUID
 	if (NewNode->NodeGuid.IsValid() == false || NewNode->NodeGuid == FGuid())
@@ -406,40 +385,6 @@ UK2Node* FBlueprintNodeManager::CreateVariableSetNode(UEdGraph* Graph, const TSh
 	return VarSetNode;
 }
 
-UBlueprint* FBlueprintNodeManager::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct path first
-	FString BlueprintPath = BlueprintName;
-
-	// If no path prefix, assume /Game/Blueprints/
-	if (!BlueprintPath.StartsWith(TEXT("/")))
-	{
-		BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintPath;
-	}
-
-	// Add .Blueprint suffix if not present
-	if (!BlueprintPath.Contains(TEXT(".")))
-	{
-		BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-	}
-
-	// Try to load the Blueprint
-	UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-
-	// If not found, try with UEditorAssetLibrary
-	if (!BP)
-	{
-		FString AssetPath = BlueprintPath;
-		if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
-		{
-			UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-			BP = Cast<UBlueprint>(Asset);
-		}
-	}
-
-	return BP;
-}
-
 UK2Node* FBlueprintNodeManager::CreateCallFunctionNode(UEdGraph* Graph, const TSharedPtr<FJsonObject>& Params)
 {
 	if (!Graph)
@@ -1,4 +1,6 @@
 #include "Commands/BlueprintGraph/NodePropertyManager.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 #include "Commands/BlueprintGraph/Nodes/SwitchEnumEditor.h"
 #include "Commands/BlueprintGraph/Nodes/ExecutionSequenceEditor.h"
 #include "Commands/BlueprintGraph/Nodes/MakeArrayEditor.h"
@@ -87,14 +89,14 @@ TSharedPtr<FJsonObject> FNodePropertyManager::SetNodeProperty(const TSharedPtr<F
 	Params->TryGetStringField(TEXT("function_name"), FunctionName);
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
 	}
 
 	// Get the appropriate graph
-	UEdGraph* Graph = GetGraph(Blueprint, FunctionName);
+	UEdGraph* Graph = FBPGraphCache::FindGraph(Blueprint, FunctionName);
 	if (!Graph)
 	{
 		if (FunctionName.IsEmpty())
@@ -108,7 +110,7 @@ TSharedPtr<FJsonObject> FNodePropertyManager::SetNodeProperty(const TSharedPtr<F
 	}
 
 	// Find the node
-	UEdGraphNode* Node = FindNodeByID(Graph, NodeID);
+	UEdGraphNode* Node = FBPGraphCache::FindNode(Graph, NodeID);
 	if (!Node)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Node not found: %s"), *NodeID));
@@ -149,7 +151,7 @@ TSharedPtr<FJsonObject> FNodePropertyManager::SetNodeProperty(const TSharedPtr<F
 
 	// Notify changes
 	Graph->NotifyGraphChanged();
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
 	UE_LOG(LogTemp, Display,
 		TEXT("Successfully set '%s' on node '%s' in %s"),
@@ -190,14 +192,14 @@ TSharedPtr<FJsonObject> FNodePropertyManager::EditNode(const TSharedPtr<FJsonObj
 	Params->TryGetStringField(TEXT("function_name"), FunctionName);
 
 	// Load the Blueprint
-	UBlueprint* Blueprint = LoadBlueprint(BlueprintName);
+	UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
 	if (!Blueprint)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
 	}
 
 	// Get the appropriate graph
-	UEdGraph* Graph = GetGraph(Blueprint, FunctionName);
+	UEdGraph* Graph = FBPGraphCache::FindGraph(Blueprint, FunctionName);
 	if (!Graph)
 	{
 		if (FunctionName.IsEmpty())
@@ -211,7 +213,7 @@ TSharedPtr<FJsonObject> FNodePropertyManager::EditNode(const TSharedPtr<FJsonObj
 	}
 
 	// Find the node
-	UEdGraphNode* Node = FindNodeByID(Graph, NodeID);
+	UEdGraphNode* Node = FBPGraphCache::FindNode(Graph, NodeID);
 	if (!Node)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Node not found: %s"), *NodeID));
@@ -467,7 +469,7 @@ TSharedPtr<FJsonObject> FNodePropertyManager::DispatchEditAction(
 
 		// Notify
 		Graph->NotifyGraphChanged();
-		FBlueprintEditorUtils::MarkBlueprintAsModified(Cast<UBlueprint>(Graph->GetOuter()));
+		FBPEditSession::MarkModifiedOrDefer(Cast<UBlueprint>(Graph->GetOuter()));
 
 		TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject);
 		Response->SetBoolField(TEXT("success"), true);
@@ -607,99 +609,6 @@ bool FNodePropertyManager::SetGenericNodeProperty(
 	return false;
 }
 
-UEdGraph* FNodePropertyManager::GetGraph(UBlueprint* Blueprint, const FString& FunctionName)
-{
-	if (!Blueprint)
-	{
-		return nullptr;
-	}
-
-	// If no function name, return EventGraph
-	if (FunctionName.IsEmpty())
-	{
-		if (Blueprint->UbergraphPages.Num() > 0)
-		{
-			return Blueprint->UbergraphPages[0];
-		}
-		return nullptr;
-	}
-
-	// Search in function graphs
-	for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
-	{
-		if (FuncGraph && FuncGraph->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-		{
-			return FuncGraph;
-		}
-	}
-
-	return nullptr;
-}
-
-UEdGraphNode* FNodePropertyManager::FindNodeByID(UEdGraph* Graph, const FString& NodeID)
-{
-	if (!Graph)
-	{
-		return nullptr;
-	}
-
-	for (UEdGraphNode* Node : Graph->Nodes)
-	{
-		if (!Node)
-		{
-			continue;
-		}
-
-		// Try matching by NodeGuid
-		if (Node->NodeGuid.ToString().Equals(NodeID, ESearchCase::IgnoreCase))
-		{
-			return Node;
-		}
-
-		// Try matching by GetName()
-		if (Node->GetName().Equals(NodeID, ESearchCase::IgnoreCase))
-		{
-			return Node;
-		}
-	}
-
-	return nullptr;
-}
-
-UBlueprint* FNodePropertyManager::LoadBlueprint(const FString& BlueprintName)
-{
-	// Try direct path first
-	FString BlueprintPath = BlueprintName;
-
-	// If no path prefix, assume /Game/Blueprints/
-	if (!BlueprintPath.StartsWith(TEXT("/")))
-	{
-		BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintName;
-	}
-
-	// Add .Blueprint suffix if not present
-	if (!BlueprintPath.Contains(TEXT(".")))
-	{
-		BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-	}
-
-	// Try to load the Blueprint
-	UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-
-	// If not found, try with UEditorAssetLibrary
-	if (!BP)
-	{
-		FString AssetPath = BlueprintPath;
-		if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
-		{
-			UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-			BP = Cast<UBlueprint>(Asset);
-		}
-	}
-
-	return BP;
-}
-
 TSharedPtr<FJsonObject> FNodePropertyManager::CreateSuccessResponse(const FString& PropertyName)
 {
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject);
@@ -1,4 +1,5 @@
 #include "Commands/BlueprintGraph/Nodes/ExecutionSequenceEditor.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "K2Node_ExecutionSequence.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphPin.h"
@@ -60,7 +61,7 @@ bool FExecutionSequenceEditor::AddExecutionPin(UK2Node* Node, UEdGraph* Graph)
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -113,7 +114,7 @@ bool FExecutionSequenceEditor::RemoveExecutionPin(UK2Node* Node, UEdGraph* Graph
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -186,7 +187,7 @@ bool FExecutionSequenceEditor::SetNumExecutionPins(UK2Node* Node, UEdGraph* Grap
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -1,4 +1,5 @@
 #include "Commands/BlueprintGraph/Nodes/MakeArrayEditor.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "K2Node_MakeArray.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphPin.h"
@@ -42,7 +43,7 @@ bool FMakeArrayEditor::AddArrayElementPin(UK2Node* Node, UEdGraph* Graph)
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -104,7 +105,7 @@ bool FMakeArrayEditor::RemoveArrayElementPin(UK2Node* Node, UEdGraph* Graph, con
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -181,7 +182,7 @@ bool FMakeArrayEditor::SetNumArrayElements(UK2Node* Node, UEdGraph* Graph, int32
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
@@ -1,4 +1,5 @@
 #include "Commands/BlueprintGraph/Nodes/SwitchEnumEditor.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "K2Node_SwitchEnum.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
@@ -53,7 +54,7 @@ bool FSwitchEnumEditor::SetEnumType(UK2Node* Node, UEdGraph* Graph, const FStrin
 	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
 	if (Blueprint)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(Blueprint);
 	}
 
 	// Notify graph of changes
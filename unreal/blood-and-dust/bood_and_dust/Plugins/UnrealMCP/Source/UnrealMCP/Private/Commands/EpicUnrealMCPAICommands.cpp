@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPAICommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -99,9 +100,7 @@ static bool SaveAssetPackage(UPackage* Package, UObject* Asset, const FString& F
 		PlatformFile.CreateDirectoryTree(*PackageDirectory);
 	}
 
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	return UPackage::SavePackage(Package, Asset, *PackageFilename, SaveArgs);
+	return FEpicUnrealMCPPackageSaver::SavePackage(Package, Asset);
 }
 
 // ---------------------------------------------------------------------------
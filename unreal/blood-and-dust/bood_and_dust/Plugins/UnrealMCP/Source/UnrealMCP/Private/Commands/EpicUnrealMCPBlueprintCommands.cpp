@@ -1,5 +1,7 @@
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -424,7 +426,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlu
         Blueprint->SimpleConstructionScript->AddNode(NewNode);
 
         // Compile the blueprint
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        FBPEditSession::CompileOrDefer(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("component_name"), ComponentName);
@@ -504,7 +506,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetPhysicsPropert
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -748,7 +750,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetStaticMeshProp
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("component"), ComponentName);
@@ -868,7 +870,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     PrimComponent->SetMaterial(MaterialSlot, DynMaterial);
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     // Log success
     UE_LOG(LogTemp, Log, TEXT("Successfully set material color on component %s: R=%f, G=%f, B=%f, A=%f"), 
@@ -1226,7 +1228,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshAssetMater
 
         StaticMesh->PostEditChange();
         StaticMesh->MarkPackageDirty();
-        UEditorAssetLibrary::SaveLoadedAsset(StaticMesh);
+        FEpicUnrealMCPPackageSaver::SaveAsset(StaticMesh);
     }
     else if (USkeletalMesh* SkelMesh = Cast<USkeletalMesh>(LoadedAsset))
     {
@@ -1254,7 +1256,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshAssetMater
 
         SkelMesh->PostEditChange();
         SkelMesh->MarkPackageDirty();
-        UEditorAssetLibrary::SaveLoadedAsset(SkelMesh);
+        FEpicUnrealMCPPackageSaver::SaveAsset(SkelMesh);
     }
     else
     {
@@ -1377,7 +1379,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleApplyMaterialToBl
     PrimComponent->MarkRenderStateDirty();
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
@@ -2236,10 +2238,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateCharacterBl
     Package->MarkPackageDirty();
 
     // Save the blueprint package
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(FullPath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, NewBP, *PackageFilename, SaveArgs);
+    FEpicUnrealMCPPackageSaver::SavePackage(Package, NewBP);
 
     // ---- Build response ----
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -2396,10 +2395,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateAnimBluepri
     FKismetEditorUtilities::CompileBlueprint(AnimBP);
 
     // Save package
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(FullPath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, AnimBP, *PackageFilename, SaveArgs);
+    FEpicUnrealMCPPackageSaver::SavePackage(Package, AnimBP);
 
     // Build response
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -2765,7 +2761,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupLocomotionSt
 	}
 
 	// Part 7.5: Compile so Speed (and IsFalling) variables are baked into generated class
-	// This is required before K2Node_VariableGet/Set can allocate pins for Speed/IsFalling
+	// This is required before K2Node_VariableGet/Set can allocate pins for Speed/IsFalling, so it is never deferred to an edit session
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
 	FKismetEditorUtilities::CompileBlueprint(AnimBP);
 
@@ -3203,8 +3199,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupLocomotionSt
 	}
 
 	// === Part 10: Compile ===
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
-	FKismetEditorUtilities::CompileBlueprint(AnimBP);
+	FBPEditSession::MarkStructurallyModifiedOrDefer(AnimBP);
+	FBPEditSession::CompileOrDefer(AnimBP);
 
 	// Check compile status
 	bool bCompileSucceeded = (AnimBP->Status != EBlueprintStatus::BS_Error);
@@ -3296,7 +3292,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupBlendspaceLo
 		UE_LOG(LogTemp, Warning, TEXT("setup_blendspace: UEnemyAnimInstance not found — AnimBP parent unchanged. Speed must be set via EventGraph."));
 	}
 
-	// Compile to regenerate generated class (needed for VariableGet to resolve Speed property)
+	// Compile to regenerate generated class (needed now for VariableGet to resolve Speed property, so never deferred)
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
 	FKismetEditorUtilities::CompileBlueprint(AnimBP);
 
@@ -3429,10 +3425,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupBlendspaceLo
 	}
 
 	// Save BlendSpace asset
-	FString BSFilename = FPackageName::LongPackageNameToFilename(BlendSpacePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs BSSaveArgs;
-	BSSaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(BS->GetPackage(), BS, *BSFilename, BSSaveArgs);
+	FEpicUnrealMCPPackageSaver::SavePackage(BS->GetPackage(), BS);
 
 	// === Part 4: Find AnimGraph and clean up ===
 	UEdGraph* AnimGraph = nullptr;
@@ -3527,7 +3520,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupBlendspaceLo
 			UE_LOG(LogTemp, Display, TEXT("setup_blendspace: Created LocSpeed BP variable"));
 		}
 
-		// Must recompile after adding variable so the generated class has the property
+		// Must recompile now (not deferred) after adding variable so the generated class has the property
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
 		FKismetEditorUtilities::CompileBlueprint(AnimBP);
 
@@ -3752,8 +3745,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupBlendspaceLo
 	}
 
 	// === Part 7: Compile and Save ===
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
-	FKismetEditorUtilities::CompileBlueprint(AnimBP);
+	FBPEditSession::MarkStructurallyModifiedOrDefer(AnimBP);
+	FBPEditSession::CompileOrDefer(AnimBP);
 
 	bool bCompileSucceeded = (AnimBP->Status != EBlueprintStatus::BS_Error);
 	UE_LOG(LogTemp, Display, TEXT("setup_blendspace: Final compile status=%d (3=UpToDate, 2=Error)"), (int)AnimBP->Status);
@@ -3762,9 +3755,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetupBlendspaceLo
 	if (bCompileSucceeded)
 	{
 		FString ABPFilename = FPackageName::LongPackageNameToFilename(AnimBPPath, FPackageName::GetAssetPackageExtension());
-		FSavePackageArgs ABPSaveArgs;
-		ABPSaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-		UPackage::SavePackage(AnimBP->GetPackage(), AnimBP, *ABPFilename, ABPSaveArgs);
+		FEpicUnrealMCPPackageSaver::SavePackage(AnimBP->GetPackage(), AnimBP);
 		UE_LOG(LogTemp, Display, TEXT("setup_blendspace: Saved AnimBP to disk: %s"), *ABPFilename);
 	}
 
@@ -3982,8 +3973,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetCharacterPrope
 	}
 
 	// Compile and mark dirty
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(BP);
-	FKismetEditorUtilities::CompileBlueprint(BP);
+	FBPEditSession::MarkStructurallyModifiedOrDefer(BP);
+	FBPEditSession::CompileOrDefer(BP);
 	BP->GetPackage()->MarkPackageDirty();
 
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -4028,7 +4019,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetAnimSequenceRo
     AnimSequence->Modify();
     AnimSequence->bEnableRootMotion = bEnableRootMotion;
     AnimSequence->MarkPackageDirty();
-    UEditorAssetLibrary::SaveLoadedAsset(AnimSequence);
+    FEpicUnrealMCPPackageSaver::SaveAsset(AnimSequence);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), true);
@@ -4150,10 +4141,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetAnimStateAlway
     FoundState->Modify();
     FoundState->bAlwaysResetOnEntry = bAlwaysResetOnEntry;
 
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
-    FKismetEditorUtilities::CompileBlueprint(AnimBP);
+    FBPEditSession::MarkStructurallyModifiedOrDefer(AnimBP);
+    FBPEditSession::CompileOrDefer(AnimBP);
     AnimBP->MarkPackageDirty();
-    UEditorAssetLibrary::SaveLoadedAsset(AnimBP);
+    FEpicUnrealMCPPackageSaver::SaveAsset(AnimBP);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), AnimBP->Status != EBlueprintStatus::BS_Error);
@@ -4244,10 +4235,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetStateMachineMa
     TargetStateMachine->Modify();
     TargetStateMachine->Node.MaxTransitionsPerFrame = MaxTransitionsPerFrame;
 
-    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(AnimBP);
-    FKismetEditorUtilities::CompileBlueprint(AnimBP);
+    FBPEditSession::MarkStructurallyModifiedOrDefer(AnimBP);
+    FBPEditSession::CompileOrDefer(AnimBP);
     AnimBP->MarkPackageDirty();
-    UEditorAssetLibrary::SaveLoadedAsset(AnimBP);
+    FEpicUnrealMCPPackageSaver::SaveAsset(AnimBP);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), AnimBP->Status != EBlueprintStatus::BS_Error);
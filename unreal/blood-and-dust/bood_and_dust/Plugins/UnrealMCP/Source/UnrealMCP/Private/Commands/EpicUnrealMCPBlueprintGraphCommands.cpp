@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPBlueprintGraphCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
 #include "Commands/BlueprintGraph/NodeManager.h"
 #include "Commands/BlueprintGraph/BPConnector.h"
 #include "Commands/BlueprintGraph/BPVariables.h"
@@ -8,6 +9,8 @@
 #include "Commands/BlueprintGraph/NodePropertyManager.h"
 #include "Commands/BlueprintGraph/Function/FunctionManager.h"
 #include "Commands/BlueprintGraph/Function/FunctionIO.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
 // Enhanced Input
 #include "K2Node_EnhancedInputAction.h"
 #include "InputAction.h"
@@ -19,6 +22,120 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 
+namespace
+{
+    // Graph-only commands that build_blueprint_graph may batch (asset-creating commands are excluded)
+    const TCHAR* BatchableGraphCommands[] = {
+        TEXT("add_blueprint_node"),
+        TEXT("connect_nodes"),
+        TEXT("create_variable"),
+        TEXT("set_blueprint_variable_properties"),
+        TEXT("add_event_node"),
+        TEXT("delete_node"),
+        TEXT("set_node_property"),
+        TEXT("create_function"),
+        TEXT("add_function_input"),
+        TEXT("add_function_output"),
+        TEXT("delete_function"),
+        TEXT("rename_function"),
+        TEXT("add_enhanced_input_action_event"),
+    };
+
+    bool IsBatchableGraphCommand(const FString& Command)
+    {
+        for (const TCHAR* Name : BatchableGraphCommands)
+        {
+            if (Command == Name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Replace {"$ref": "name"} / {"$ref": "name.field"} values with fields of earlier operation results.
+     * A bare name resolves to the result's node_id. Plain strings are never rewritten, so a literal
+     * starting with "$" passes through. Recurses into nested objects and arrays.
+     */
+    bool ResolveOperationRefs(const TSharedPtr<FJsonObject>& Object, const TMap<FString, TSharedPtr<FJsonObject>>& Results, FString& OutError);
+
+    bool ResolveRefValue(TSharedPtr<FJsonValue>& Value, const TMap<FString, TSharedPtr<FJsonObject>>& Results, FString& OutError)
+    {
+        if (!Value.IsValid())
+        {
+            return true;
+        }
+
+        if (Value->Type == EJson::Object)
+        {
+            const TSharedPtr<FJsonObject> Object = Value->AsObject();
+            FString Ref;
+            if (!Object.IsValid() || Object->Values.Num() != 1 || !Object->TryGetStringField(TEXT("$ref"), Ref))
+            {
+                return ResolveOperationRefs(Object, Results, OutError);
+            }
+
+            FString RefName = Ref;
+            FString FieldName = TEXT("node_id");
+            FString Left, Right;
+            if (Ref.Split(TEXT("."), &Left, &Right))
+            {
+                RefName = Left;
+                FieldName = Right;
+            }
+
+            const TSharedPtr<FJsonObject>* Result = Results.Find(RefName);
+            if (!Result)
+            {
+                OutError = FString::Printf(TEXT("Unknown reference '%s'"), *Ref);
+                return false;
+            }
+
+            FString Resolved;
+            if (!(*Result)->TryGetStringField(FieldName, Resolved))
+            {
+                OutError = FString::Printf(TEXT("Reference '%s' has no '%s' field"), *RefName, *FieldName);
+                return false;
+            }
+
+            Value = MakeShared<FJsonValueString>(Resolved);
+            return true;
+        }
+
+        if (Value->Type == EJson::Array)
+        {
+            TArray<TSharedPtr<FJsonValue>> Items = Value->AsArray();
+            for (TSharedPtr<FJsonValue>& Item : Items)
+            {
+                if (!ResolveRefValue(Item, Results, OutError))
+                {
+                    return false;
+                }
+            }
+            Value = MakeShared<FJsonValueArray>(Items);
+        }
+        return true;
+    }
+
+    bool ResolveOperationRefs(const TSharedPtr<FJsonObject>& Object, const TMap<FString, TSharedPtr<FJsonObject>>& Results, FString& OutError)
+    {
+        if (!Object.IsValid())
+        {
+            return true;
+        }
+
+        for (TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+        {
+            if (!ResolveRefValue(Field.Value, Results, OutError))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
 FEpicUnrealMCPBlueprintGraphCommands::FEpicUnrealMCPBlueprintGraphCommands()
 {
 }
@@ -89,6 +206,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleCommand(cons
     {
         return HandleAddInputMapping(Params);
     }
+    else if (CommandType == TEXT("begin_blueprint_edit"))
+    {
+        return HandleBeginBlueprintEdit(Params);
+    }
+    else if (CommandType == TEXT("commit_blueprint_edit"))
+    {
+        return HandleCommitBlueprintEdit(Params);
+    }
+    else if (CommandType == TEXT("build_blueprint_graph"))
+    {
+        return HandleBuildBlueprintGraph(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint graph command: %s"), *CommandType));
 }
@@ -433,24 +562,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddEnhancedI
         *InputActionPath, *BlueprintName);
 
     // Load the Blueprint
-    FString BlueprintPath = BlueprintName;
-    if (!BlueprintPath.StartsWith(TEXT("/")))
-    {
-        BlueprintPath = TEXT("/Game/Blueprints/") + BlueprintPath;
-    }
-    if (!BlueprintPath.Contains(TEXT(".")))
-    {
-        BlueprintPath += TEXT(".") + FPaths::GetBaseFilename(BlueprintPath);
-    }
-
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
-    if (!Blueprint)
-    {
-        if (UEditorAssetLibrary::DoesAssetExist(BlueprintPath))
-        {
-            Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
-        }
-    }
+    UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
     if (!Blueprint)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
@@ -547,7 +659,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddEnhancedI
 
     // Notify changes
     Graph->NotifyGraphChanged();
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FBPEditSession::MarkModifiedOrDefer(Blueprint);
 
     UE_LOG(LogTemp, Display, TEXT("HandleAddEnhancedInputActionEvent: Created node for '%s' (ID: %s)"),
         *InputActionPath, *ActionNode->NodeGuid.ToString());
@@ -662,10 +774,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleCreateInputA
     Package->MarkPackageDirty();
 
     // Save the package
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, NewAction, *PackageFilename, SaveArgs);
+    FEpicUnrealMCPPackageSaver::SavePackage(Package, NewAction);
 
     UE_LOG(LogTemp, Display, TEXT("CreateInputAction: Created '%s' at '%s' (ValueType: %s)"),
         *ActionName, *FullPath, *ValueTypeStr);
@@ -718,10 +827,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddInputMapp
             {
                 FAssetRegistryModule::AssetCreated(IMC);
                 IMCPackage->MarkPackageDirty();
-                FString IMCFilename = FPackageName::LongPackageNameToFilename(ContextPath, FPackageName::GetAssetPackageExtension());
-                FSavePackageArgs SaveArgs;
-                SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-                UPackage::SavePackage(IMCPackage, IMC, *IMCFilename, SaveArgs);
+                FEpicUnrealMCPPackageSaver::SavePackage(IMCPackage, IMC);
                 UE_LOG(LogTemp, Display, TEXT("AddInputMapping: Auto-created InputMappingContext '%s'"), *ContextPath);
             }
         }
@@ -811,11 +917,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddInputMapp
 
     // Save the IMC package
     IMC->GetPackage()->MarkPackageDirty();
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(
-        IMC->GetPackage()->GetName(), FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(IMC->GetPackage(), IMC, *PackageFilename, SaveArgs);
+    FEpicUnrealMCPPackageSaver::SavePackage(IMC->GetPackage(), IMC);
 
     UE_LOG(LogTemp, Display, TEXT("AddInputMapping: Mapped '%s' -> '%s' in '%s'"),
         *KeyName, *ActionPath, *ContextPath);
@@ -829,3 +931,181 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddInputMapp
     if (bSwizzle) Response->SetBoolField(TEXT("swizzle"), true);
     return Response;
 }
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleBeginBlueprintEdit(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    double TimeoutSeconds = 60.0;
+    Params->TryGetNumberField(TEXT("timeout_seconds"), TimeoutSeconds);
+
+    const bool bOpened = FBPEditSession::Begin(Blueprint, (float)TimeoutSeconds);
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), true);
+    Response->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    Response->SetBoolField(TEXT("already_open"), !bOpened);
+    Response->SetNumberField(TEXT("timeout_seconds"), TimeoutSeconds);
+    return Response;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleCommitBlueprintEdit(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    TSharedPtr<FJsonObject> Response = FBPEditSession::Commit(Blueprint);
+    Response->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    return Response;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleBuildBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Operations = nullptr;
+    if (!Params->TryGetArrayField(TEXT("operations"), Operations))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'operations' array"));
+    }
+
+    bool bStopOnError = true;
+    Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+    UBlueprint* Blueprint = FBPGraphCache::LoadBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPBlueprintGraphCommands::HandleBuildBlueprintGraph: Applying %d operations to blueprint '%s'"),
+        Operations->Num(), *BlueprintName);
+
+    // Reuse a session the caller already opened; otherwise this batch owns one and commits it below
+    const bool bOwnsSession = !FBPEditSession::IsOpen(Blueprint);
+    if (bOwnsSession)
+    {
+        FBPEditSession::Begin(Blueprint);
+    }
+
+    const double ApplyStart = FPlatformTime::Seconds();
+    TMap<FString, TSharedPtr<FJsonObject>> RefResults;
+    TArray<TSharedPtr<FJsonValue>> OperationResults;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 NumSucceeded = 0;
+
+    for (int32 Index = 0; Index < Operations->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* OperationObj = nullptr;
+        FString Command;
+        FString Error;
+        TSharedPtr<FJsonObject> OpResult;
+
+        if (!(*Operations)[Index]->TryGetObject(OperationObj) || !(*OperationObj)->TryGetStringField(TEXT("command"), Command))
+        {
+            Error = TEXT("Operation needs a 'command' field");
+        }
+        else if (!IsBatchableGraphCommand(Command))
+        {
+            Error = FString::Printf(TEXT("Command '%s' cannot be batched"), *Command);
+        }
+        else
+        {
+            const TSharedPtr<FJsonObject>* OpParamsObj = nullptr;
+            TSharedPtr<FJsonObject> OpParams = (*OperationObj)->TryGetObjectField(TEXT("params"), OpParamsObj)
+                ? *OpParamsObj : MakeShared<FJsonObject>();
+            if (!OpParams->HasField(TEXT("blueprint_name")))
+            {
+                OpParams->SetStringField(TEXT("blueprint_name"), BlueprintName);
+            }
+
+            if (ResolveOperationRefs(OpParams, RefResults, Error))
+            {
+                OpResult = HandleCommand(Command, OpParams);
+                bool bOpSuccess = false;
+                if (!OpResult.IsValid() || !OpResult->TryGetBoolField(TEXT("success"), bOpSuccess) || !bOpSuccess)
+                {
+                    if (!OpResult.IsValid() || !OpResult->TryGetStringField(TEXT("error"), Error))
+                    {
+                        Error = TEXT("Operation failed");
+                    }
+                }
+            }
+        }
+
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetNumberField(TEXT("index"), Index);
+        Entry->SetStringField(TEXT("command"), Command);
+
+        FString Ref;
+        if (OperationObj)
+        {
+            (*OperationObj)->TryGetStringField(TEXT("ref"), Ref);
+        }
+
+        if (Error.IsEmpty())
+        {
+            NumSucceeded++;
+            if (!Ref.IsEmpty())
+            {
+                RefResults.Add(Ref, OpResult);
+                Entry->SetStringField(TEXT("ref"), Ref);
+            }
+            Entry->SetObjectField(TEXT("result"), OpResult);
+            OperationResults.Add(MakeShared<FJsonValueObject>(Entry));
+            continue;
+        }
+
+        Entry->SetStringField(TEXT("error"), Error);
+        Errors.Add(MakeShared<FJsonValueObject>(Entry));
+        if (bStopOnError)
+        {
+            break;
+        }
+    }
+
+    const double ApplyMs = (FPlatformTime::Seconds() - ApplyStart) * 1000.0;
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    if (bOwnsSession)
+    {
+        Response = FBPEditSession::Commit(Blueprint);
+    }
+
+    Response->SetBoolField(TEXT("success"), Errors.Num() == 0);
+    Response->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    Response->SetBoolField(TEXT("compile_deferred"), !bOwnsSession);
+    Response->SetNumberField(TEXT("num_operations"), Operations->Num());
+    Response->SetNumberField(TEXT("num_succeeded"), NumSucceeded);
+    Response->SetNumberField(TEXT("apply_ms"), ApplyMs);
+    Response->SetArrayField(TEXT("results"), OperationResults);
+    Response->SetArrayField(TEXT("errors"), Errors);
+    if (Errors.Num() > 0)
+    {
+        Response->SetStringField(TEXT("error"), FString::Printf(TEXT("%d operation(s) failed"), Errors.Num()));
+    }
+    return Response;
+}
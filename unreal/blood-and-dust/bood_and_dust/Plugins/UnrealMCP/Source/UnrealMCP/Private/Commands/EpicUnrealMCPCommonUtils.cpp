@@ -1,4 +1,5 @@
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPResponseWriter.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -49,6 +50,26 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::CreateSuccessResponse(const T
     return ResponseObject;
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::StreamToJsonObject(TFunctionRef<bool(FMCPResponseWriter& Writer, FString& OutError)> Write)
+{
+    TArray<uint8> Buffer;
+    FMCPResponseWriter Writer(Buffer, EMCPWireFormat::Json);
+    FString Error;
+    if (!Write(Writer, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), Buffer.Num());
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FString(Converted.Length(), Converted.Get()));
+    TSharedPtr<FJsonObject> Result;
+    if (!FJsonSerializer::Deserialize(Reader, Result) || !Result.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Streamed result is not a JSON object"));
+    }
+    return Result;
+}
+
 void FEpicUnrealMCPCommonUtils::GetIntArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<int32>& OutArray)
 {
     OutArray.Reset();
@@ -465,41 +486,6 @@ UEdGraphPin* FEpicUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FStrin
 }
 
 // Actor utilities
-TSharedPtr<FJsonValue> FEpicUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
-{
-    if (!Actor)
-    {
-        return MakeShared<FJsonValueNull>();
-    }
-    
-    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
-    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
-    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-    
-    FVector Location = Actor->GetActorLocation();
-    TArray<TSharedPtr<FJsonValue>> LocationArray;
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
-    ActorObject->SetArrayField(TEXT("location"), LocationArray);
-    
-    FRotator Rotation = Actor->GetActorRotation();
-    TArray<TSharedPtr<FJsonValue>> RotationArray;
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
-    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
-    
-    FVector Scale = Actor->GetActorScale3D();
-    TArray<TSharedPtr<FJsonValue>> ScaleArray;
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
-    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
-    
-    return MakeShared<FJsonValueObject>(ActorObject);
-}
-
 AActor* FEpicUnrealMCPCommonUtils::FindActorByName(UWorld* World, const FString& ActorName)
 {
     if (!World) return nullptr;
@@ -563,6 +549,22 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToJsonObject(AActor* Act
     return ActorObject;
 }
 
+void FEpicUnrealMCPCommonUtils::WriteActor(FMCPResponseWriter& Writer, const AActor* Actor)
+{
+    Writer.BeginObject();
+    Writer.StringField(TEXT("name"), Actor->GetName());
+    Writer.StringField(TEXT("class"), Actor->GetClass()->GetName());
+    WriteActorTransform(Writer, Actor);
+    Writer.EndObject();
+}
+
+void FEpicUnrealMCPCommonUtils::WriteActorTransform(FMCPResponseWriter& Writer, const AActor* Actor)
+{
+    Writer.VectorField(TEXT("location"), Actor->GetActorLocation());
+    Writer.RotatorField(TEXT("rotation"), Actor->GetActorRotation());
+    Writer.VectorField(TEXT("scale"), Actor->GetActorScale3D());
+}
+
 UK2Node_Event* FEpicUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
 {
     if (!Graph)
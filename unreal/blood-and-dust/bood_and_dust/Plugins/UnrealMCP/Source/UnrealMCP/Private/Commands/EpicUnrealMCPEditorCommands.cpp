@@ -1,5 +1,10 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "MCPResponseWriter.h"
+#include "MCPBulkChannel.h"
+#include "MCPLogCapture.h"
+#include "MCPSceneJournal.h"
 #include "Editor.h"
 #include "Animation/AnimSequence.h"
 #include "Animation/AnimNotifies/AnimNotify_PlaySound.h"
@@ -14,6 +19,7 @@
 #include "Components/SceneCaptureComponent2D.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "Components/CapsuleComponent.h"
@@ -110,14 +116,28 @@
 #include "Animation/Skeleton.h"
 #include "Animation/AnimSequence.h"
 
-// HISM for foliage scatter
+// HISM for foliage scatter and instanced spawning
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "ScopedTransaction.h"
+#include "MCPInstanceMetadata.h"
 
 // Audio import
 #include "Sound/SoundWave.h"
 #include "Sound/AmbientSound.h"
 #include "Components/AudioComponent.h"
 #include "Factories/SoundFactory.h"
+#include "Audio.h"
+
+// Import cache (content hash in asset metadata)
+#include "Hash/xxhash.h"
+#include "EditorReimportHandler.h"
+
+// Batch import (worker-thread decode)
+#include "Async/Async.h"
+#include "ImageCore.h"
+#include "ImageCoreUtils.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Containers/Ticker.h"
 
 // Landscape filter for foliage scatter line traces
 #include "LandscapeProxy.h"
@@ -132,13 +152,12 @@ FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
     // Actor manipulation commands
-    if (CommandType == TEXT("get_actors_in_level"))
-    {
-        return HandleGetActorsInLevel(Params);
-    }
-    else if (CommandType == TEXT("find_actors_by_name"))
+    if (CommandType == TEXT("get_actors_in_level") || CommandType == TEXT("find_actors_by_name"))
     {
-        return HandleFindActorsByName(Params);
+        return FEpicUnrealMCPCommonUtils::StreamToJsonObject([this, &CommandType, &Params](FMCPResponseWriter& Writer, FString& OutError)
+        {
+            return StreamCommand(CommandType, Params, Writer, OutError);
+        });
     }
     else if (CommandType == TEXT("spawn_actor"))
     {
@@ -284,54 +303,90 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
     {
         return HandleGetEditorLog(Params);
     }
+    // Batch import
+    else if (CommandType == TEXT("import_assets_batch"))
+    {
+        return HandleImportAssetsBatch(Params);
+    }
+    else if (CommandType == TEXT("get_import_batch_status"))
+    {
+        return HandleGetImportBatchStatus(Params);
+    }
+    // Save policy
+    else if (CommandType == TEXT("set_save_policy"))
+    {
+        return HandleSetSavePolicy(Params);
+    }
+    else if (CommandType == TEXT("flush_dirty_packages"))
+    {
+        return HandleFlushDirtyPackages(Params);
+    }
+    // Instanced spawning
+    else if (CommandType == TEXT("spawn_instanced_batch"))
+    {
+        return HandleSpawnInstancedBatch(Params);
+    }
+    else if (CommandType == TEXT("consolidate_to_instances"))
+    {
+        return HandleConsolidateToInstances(Params);
+    }
+    // Shared-memory bulk channel
+    else if (CommandType == TEXT("get_bulk_channel_info"))
+    {
+        return HandleGetBulkChannelInfo(Params);
+    }
+    else if (CommandType == TEXT("release_bulk"))
+    {
+        return HandleReleaseBulk(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
+bool FEpicUnrealMCPEditorCommands::CanStreamCommand(const FString& CommandType) const
 {
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor)
-        {
-            ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
-        }
-    }
-    
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
-    
-    return ResultObj;
+    return CommandType == TEXT("get_actors_in_level") || CommandType == TEXT("find_actors_by_name") ||
+        CommandType == TEXT("get_scene_delta");
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
+bool FEpicUnrealMCPEditorCommands::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    FMCPResponseWriter& Writer, FString& OutError)
 {
+    if (CommandType == TEXT("get_scene_delta"))
+    {
+        return FMCPSceneJournal::WriteDelta(Params, Writer, OutError);
+    }
+
     FString Pattern;
-    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    if (CommandType == TEXT("find_actors_by_name") && !Params->TryGetStringField(TEXT("pattern"), Pattern))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+        OutError = TEXT("Missing 'pattern' parameter");
+        return false;
     }
-    
+    return StreamActorList(Pattern, Writer);
+}
+
+// The only serializer for get_actors_in_level / find_actors_by_name; HandleCommand reads it back for DOM callers
+bool FEpicUnrealMCPEditorCommands::StreamActorList(const FString& Pattern, FMCPResponseWriter& Writer)
+{
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+
+    Writer.BeginObject();
+    Writer.Key(TEXT("actors"));
+    Writer.BeginArray();
     for (AActor* Actor : AllActors)
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        // Skip transient helpers (the capture rig's scene capture actor etc.), like the scene journal does
+        if (!Actor || Actor->HasAnyFlags(RF_Transient) || (!Pattern.IsEmpty() && !Actor->GetName().Contains(Pattern)))
         {
-            MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            continue;
         }
+        FEpicUnrealMCPCommonUtils::WriteActor(Writer, Actor);
     }
-    
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
-    
-    return ResultObj;
+    Writer.EndArray();
+    Writer.EndObject();
+    return true;
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSharedPtr<FJsonObject>& Params)
@@ -656,8 +711,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
         NewTransform.SetScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
     }
 
-    // Set the new transform
+    // Set the new transform; broadcast like an editor drag so move listeners (event subscriptions) see it
     TargetActor->SetActorTransform(NewTransform);
+    GEngine->BroadcastOnActorMoved(TargetActor);
 
     // Return updated actor info
     return FEpicUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
@@ -1953,7 +2009,166 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetMaterialInstanceP
     return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportTexture(const TSharedPtr<FJsonObject>& Params)
+// ============================================================================
+// Import cache
+//
+// Every import records xxHash64(source file) + hash(import options) in the asset's
+// package metadata. Re-importing an unchanged source with the same options returns
+// the existing asset instead of running the importer (FBX parse, Nanite build, save)
+// again. Pass force=true to re-import anyway.
+// ============================================================================
+
+static const FName ImportHashTag(TEXT("MCPImportHash"));
+
+static bool HashSourceFile(const FString& SourcePath, uint64& OutHash)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SourcePath));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    // Stream in chunks so multi-GB FBX files are not loaded whole just to be hashed
+    FXxHash64Builder Builder;
+    TArray<uint8> Chunk;
+    Chunk.SetNumUninitialized(1024 * 1024);
+    int64 Remaining = Reader->TotalSize();
+    while (Remaining > 0 && !Reader->IsError())
+    {
+        const int64 ChunkSize = FMath::Min<int64>(Remaining, Chunk.Num());
+        Reader->Serialize(Chunk.GetData(), ChunkSize);
+        Builder.Update(Chunk.GetData(), ChunkSize);
+        Remaining -= ChunkSize;
+    }
+
+    OutHash = Builder.Finalize().Hash;
+    return !Reader->IsError();
+}
+
+// Combine the file hash with every option that affects the imported result.
+// Keys are sorted so the same options in a different order hash the same.
+static FString MakeImportHash(uint64 ContentHash, const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> Keys;
+    Params->Values.GetKeys(Keys);
+    Keys.Sort();
+
+    FString Options;
+    for (const FString& Key : Keys)
+    {
+        // Where the file lives and how the result is saved do not change the asset
+        if (Key == TEXT("source_path") || Key == TEXT("save") || Key == TEXT("force") || Key == TEXT("type"))
+        {
+            continue;
+        }
+
+        FString ValueJson;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ValueJson);
+        FJsonSerializer::Serialize(Params->Values[Key], FString(), Writer);
+        Options += Key + TEXT("=") + ValueJson + TEXT(";");
+    }
+
+    const FTCHARToUTF8 OptionsUtf8(*Options);
+    const uint64 OptionsHash = FXxHash64::HashBuffer(OptionsUtf8.Get(), OptionsUtf8.Length()).Hash;
+    return FString::Printf(TEXT("%016llx%016llx"), ContentHash, OptionsHash);
+}
+
+static FString ComputeImportHash(const FString& SourcePath, const TSharedPtr<FJsonObject>& Params)
+{
+    uint64 ContentHash = 0;
+    return HashSourceFile(SourcePath, ContentHash) ? MakeImportHash(ContentHash, Params) : FString();
+}
+
+// Same hash from bytes the caller has already loaded, so the file isn't read a second time
+static FString ComputeImportHash(const TArray64<uint8>& FileData, const TSharedPtr<FJsonObject>& Params)
+{
+    return MakeImportHash(FXxHash64::HashBuffer(FileData.GetData(), FileData.Num()).Hash, Params);
+}
+
+static FString GetStoredImportHash(UObject* Asset)
+{
+    return Asset ? UEditorAssetLibrary::GetMetadataTag(Asset, ImportHashTag) : FString();
+}
+
+static void StoreImportHash(UObject* Asset, const FString& ImportHash)
+{
+    if (Asset && !ImportHash.IsEmpty())
+    {
+        UEditorAssetLibrary::SetMetadataTag(Asset, ImportHashTag, ImportHash);
+    }
+}
+
+// The asset at AssetPath if it was produced by exactly this source + options, else nullptr
+static UObject* FindUpToDateImport(const FString& AssetPath, const FString& ImportHash)
+{
+    if (ImportHash.IsEmpty() || !UEditorAssetLibrary::DoesAssetExist(AssetPath))
+    {
+        return nullptr;
+    }
+
+    UObject* Existing = UEditorAssetLibrary::LoadAsset(AssetPath);
+    return GetStoredImportHash(Existing) == ImportHash ? Existing : nullptr;
+}
+
+static TSharedPtr<FJsonObject> MakeUpToDateResult(UObject* Asset, const FString& Name, const FString& SourcePath,
+    const FString& ImportHash, double StartTime)
+{
+    UE_LOG(LogTemp, Display, TEXT("Import cache hit for '%s' (%s), skipping import"), *Asset->GetPathName(), *SourcePath);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("skipped"), true);
+    Result->SetBoolField(TEXT("unchanged"), true);
+    Result->SetStringField(TEXT("name"), Name);
+    Result->SetStringField(TEXT("path"), Asset->GetOutermost()->GetName());
+    Result->SetStringField(TEXT("source"), SourcePath);
+    Result->SetStringField(TEXT("class"), Asset->GetClass()->GetName());
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Result->SetStringField(TEXT("message"), TEXT("Source and options unchanged since last import, returned existing asset (pass force=true to re-import)"));
+    return Result;
+}
+
+// Texture settings shared by import_texture and import_assets_batch
+static void ApplyTextureImportOptions(UTexture2D* Texture, const TSharedPtr<FJsonObject>& Params)
+{
+    FString CompressionType;
+    if (Params->TryGetStringField(TEXT("compression_type"), CompressionType))
+    {
+        if (CompressionType == TEXT("Normalmap") || CompressionType == TEXT("TC_Normalmap"))
+            Texture->CompressionSettings = TC_Normalmap;
+        else if (CompressionType == TEXT("Masks") || CompressionType == TEXT("TC_Masks"))
+            Texture->CompressionSettings = TC_Masks;
+        else if (CompressionType == TEXT("Default") || CompressionType == TEXT("TC_Default"))
+            Texture->CompressionSettings = TC_Default;
+        else if (CompressionType == TEXT("Grayscale") || CompressionType == TEXT("TC_Grayscale"))
+            Texture->CompressionSettings = TC_Grayscale;
+        else if (CompressionType == TEXT("HDR") || CompressionType == TEXT("TC_HDR"))
+            Texture->CompressionSettings = TC_HDR;
+        else if (CompressionType == TEXT("EditorIcon") || CompressionType == TEXT("TC_EditorIcon") || CompressionType == TEXT("UserInterface2D"))
+        {
+            Texture->CompressionSettings = TC_EditorIcon;
+            // UI textures must be fully resident — no streaming, no mipmaps
+            Texture->NeverStream = true;
+            Texture->MipGenSettings = TMGS_NoMipmaps;
+            Texture->LODGroup = TEXTUREGROUP_UI;
+        }
+    }
+
+    bool bSRGB;
+    if (Params->TryGetBoolField(TEXT("srgb"), bSRGB))
+    {
+        Texture->SRGB = bSRGB;
+    }
+
+    bool bFlipGreen;
+    if (Params->TryGetBoolField(TEXT("flip_green_channel"), bFlipGreen))
+    {
+        Texture->bFlipGreenChannel = bFlipGreen;
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportTexture(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash)
 {
     // Get required parameters
     FString SourcePath;
@@ -1988,110 +2203,125 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportTexture(const
     // Create package for the texture
     FString PackagePath = DestinationPath + TextureName;
 
-    // If asset already exists, return success — NEVER delete+reimport over loaded assets
+    const double StartTime = FPlatformTime::Seconds();
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+    const FString ImportHash = KnownImportHash.IsEmpty() ? ComputeImportHash(SourcePath, Params) : KnownImportHash;
+
+    UPackage* Package = nullptr;
+    UTexture2D* ImportedTexture = nullptr;
+    bool bReimported = false;
+
+    // If asset already exists, NEVER delete+reimport over loaded assets
     // (editor subsystems hold RefCount > 0, causing "partially loaded" crash on SavePackage)
     if (UEditorAssetLibrary::DoesAssetExist(PackagePath))
     {
-        UE_LOG(LogTemp, Warning, TEXT("import_texture: Asset '%s' already exists, skipping import"), *PackagePath);
-        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetBoolField(TEXT("success"), true);
-        Result->SetStringField(TEXT("name"), TextureName);
-        Result->SetStringField(TEXT("path"), PackagePath);
-        Result->SetStringField(TEXT("message"), TEXT("Asset already exists, skipped import"));
-        return Result;
-    }
+        UObject* Existing = UEditorAssetLibrary::LoadAsset(PackagePath);
+        const FString StoredHash = GetStoredImportHash(Existing);
+        if (Existing && !bForce && !ImportHash.IsEmpty() && StoredHash == ImportHash)
+        {
+            return MakeUpToDateResult(Existing, TextureName, SourcePath, ImportHash, StartTime);
+        }
 
-    UPackage* Package = CreatePackage(*PackagePath);
+        // Assets imported before the cache existed have no hash: keep skipping them unless forced
+        if (!bForce && StoredHash.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("import_texture: Asset '%s' already exists, skipping import"), *PackagePath);
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetBoolField(TEXT("success"), true);
+            Result->SetBoolField(TEXT("skipped"), true);
+            Result->SetStringField(TEXT("name"), TextureName);
+            Result->SetStringField(TEXT("path"), PackagePath);
+            Result->SetStringField(TEXT("message"), TEXT("Asset already exists, skipped import"));
+            return Result;
+        }
 
-    if (!Package)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for texture"));
+        // Source or options changed: reimport in place, the existing object is updated, not replaced
+        ImportedTexture = Cast<UTexture2D>(Existing);
+        if (!ImportedTexture || !FReimportManager::Instance()->Reimport(ImportedTexture, false, false, SourcePath, nullptr, INDEX_NONE, false, true))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to re-import texture '%s' from: %s"), *PackagePath, *SourcePath));
+        }
+        Package = ImportedTexture->GetOutermost();
+        bReimported = true;
     }
+    else
+    {
+        Package = CreatePackage(*PackagePath);
 
-    // Create texture factory
-    UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
-    TextureFactory->AddToRoot();
+        if (!Package)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for texture"));
+        }
 
-    // Import the texture
-    bool bCancelled = false;
-    UTexture2D* ImportedTexture = Cast<UTexture2D>(TextureFactory->ImportObject(
-        UTexture2D::StaticClass(),
-        Package,
-        FName(*TextureName),
-        RF_Public | RF_Standalone,
-        SourcePath,
-        nullptr,
-        bCancelled
-    ));
+        // Create texture factory
+        UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
+        TextureFactory->AddToRoot();
 
-    TextureFactory->RemoveFromRoot();
+        // Import the texture
+        bool bCancelled = false;
+        ImportedTexture = Cast<UTexture2D>(TextureFactory->ImportObject(
+            UTexture2D::StaticClass(),
+            Package,
+            FName(*TextureName),
+            RF_Public | RF_Standalone,
+            SourcePath,
+            nullptr,
+            bCancelled
+        ));
 
-    if (!ImportedTexture)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to import texture from: %s"), *SourcePath));
-    }
+        TextureFactory->RemoveFromRoot();
 
-    // Apply optional texture properties after import
-    FString CompressionType;
-    if (Params->TryGetStringField(TEXT("compression_type"), CompressionType))
-    {
-        if (CompressionType == TEXT("Normalmap") || CompressionType == TEXT("TC_Normalmap"))
-            ImportedTexture->CompressionSettings = TC_Normalmap;
-        else if (CompressionType == TEXT("Masks") || CompressionType == TEXT("TC_Masks"))
-            ImportedTexture->CompressionSettings = TC_Masks;
-        else if (CompressionType == TEXT("Default") || CompressionType == TEXT("TC_Default"))
-            ImportedTexture->CompressionSettings = TC_Default;
-        else if (CompressionType == TEXT("Grayscale") || CompressionType == TEXT("TC_Grayscale"))
-            ImportedTexture->CompressionSettings = TC_Grayscale;
-        else if (CompressionType == TEXT("HDR") || CompressionType == TEXT("TC_HDR"))
-            ImportedTexture->CompressionSettings = TC_HDR;
-        else if (CompressionType == TEXT("EditorIcon") || CompressionType == TEXT("TC_EditorIcon") || CompressionType == TEXT("UserInterface2D"))
+        if (!ImportedTexture)
         {
-            ImportedTexture->CompressionSettings = TC_EditorIcon;
-            // UI textures must be fully resident — no streaming, no mipmaps
-            ImportedTexture->NeverStream = true;
-            ImportedTexture->MipGenSettings = TMGS_NoMipmaps;
-            ImportedTexture->LODGroup = TEXTUREGROUP_UI;
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to import texture from: %s"), *SourcePath));
         }
     }
 
-    bool bSRGB;
-    if (Params->TryGetBoolField(TEXT("srgb"), bSRGB))
-    {
-        ImportedTexture->SRGB = bSRGB;
-    }
-
-    bool bFlipGreen;
-    if (Params->TryGetBoolField(TEXT("flip_green_channel"), bFlipGreen))
-    {
-        ImportedTexture->bFlipGreenChannel = bFlipGreen;
-    }
+    // Apply optional texture properties after import
+    ApplyTextureImportOptions(ImportedTexture, Params);
 
     ImportedTexture->PostEditChange();
     ImportedTexture->UpdateResource();
+    StoreImportHash(ImportedTexture, ImportHash);
 
     // Notify asset registry
-    IAssetRegistry::Get()->AssetCreated(ImportedTexture);
+    if (!bReimported)
+    {
+        IAssetRegistry::Get()->AssetCreated(ImportedTexture);
+    }
 
-    // CRITICAL: Save package to disk immediately after import.
+    // CRITICAL: Save package to disk immediately after import (default "immediate" save policy).
     // Without this, texture packages accumulate in memory (~64MB per 4K texture).
     // Rapid imports without saving cause memory pressure that triggers GC,
     // which can unload/corrupt landscape streaming proxies.
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    UPackage::SavePackage(Package, ImportedTexture, *PackageFilename, SaveArgs);
+    // The "deferred" policy caps how many packages it holds before flushing for the same reason.
+    // import_assets_batch passes save=false and saves all packages once at the end.
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+    if (bSave)
+    {
+        FEpicUnrealMCPPackageSaver::SavePackage(Package, ImportedTexture);
+    }
 
     // Build result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!bSave)
+    {
+        Result->SetArrayField(TEXT("unsaved_packages"), TArray<TSharedPtr<FJsonValue>>{ MakeShared<FJsonValueString>(Package->GetName()) });
+    }
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("name"), TextureName);
     Result->SetStringField(TEXT("path"), PackagePath);
     Result->SetStringField(TEXT("source"), SourcePath);
     Result->SetNumberField(TEXT("width"), ImportedTexture->GetSizeX());
     Result->SetNumberField(TEXT("height"), ImportedTexture->GetSizeY());
-    Result->SetStringField(TEXT("message"), TEXT("Texture imported successfully"));
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetBoolField(TEXT("reimported"), bReimported);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Result->SetStringField(TEXT("message"), bReimported ? TEXT("Texture re-imported (source or options changed)") : TEXT("Texture imported successfully"));
 
     return Result;
 }
@@ -3795,14 +4025,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCreateLandscapeMater
     Package->MarkPackageDirty();
     IAssetRegistry::Get()->AssetCreated(Mat);
 
-    // Save the package to disk immediately
-    FString PackageFilename;
-    if (FPackageName::TryConvertLongPackageNameToFilename(FullPath, PackageFilename, FPackageName::GetAssetPackageExtension()))
-    {
-        FSavePackageArgs SaveArgs;
-        SaveArgs.TopLevelFlags = RF_Standalone;
-        UPackage::SavePackage(Package, Mat, *PackageFilename, SaveArgs);
-    }
+    // Save the package to disk (or queue it, per save policy)
+    FEpicUnrealMCPPackageSaver::SavePackage(Package, Mat, RF_Standalone);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), true);
@@ -3815,7 +4039,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCreateLandscapeMater
     return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportMesh(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportMesh(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash)
 {
     // Get required parameters
     FString SourcePath;
@@ -3861,6 +4085,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportMesh(const TSh
     bool bCombineMeshes = true;
     Params->TryGetBoolField(TEXT("combine_meshes"), bCombineMeshes);
 
+    // Import cache: an unchanged source with the same options skips the FBX import (and Nanite rebuild + save) entirely
+    const double StartTime = FPlatformTime::Seconds();
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+    const FString ImportHash = KnownImportHash.IsEmpty() ? ComputeImportHash(SourcePath, Params) : KnownImportHash;
+    if (UObject* Existing = bForce ? nullptr : FindUpToDateImport(DestinationPath + AssetName, ImportHash))
+    {
+        return MakeUpToDateResult(Existing, AssetName, SourcePath, ImportHash, StartTime);
+    }
+
     // Create the import task
     UAssetImportTask* ImportTask = NewObject<UAssetImportTask>();
     ImportTask->AddToRoot();
@@ -3917,29 +4151,43 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportMesh(const TSh
         StaticMesh->PostEditChange();
     }
 
+    // Record what produced this asset so the next identical import is a no-op
+    StoreImportHash(ImportedObject, ImportHash);
+
     // CRITICAL: Save the imported mesh package to disk immediately.
     // Prevents unsaved packages from accumulating in memory and
     // causing GC pressure that can corrupt landscape streaming proxies.
+    // import_assets_batch passes save=false and saves all packages once at the end.
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    TArray<TSharedPtr<FJsonValue>> UnsavedPackages;
     if (ImportedObject)
     {
         UPackage* MeshPackage = ImportedObject->GetOutermost();
-        if (MeshPackage)
+        if (MeshPackage && bSave)
+        {
+            FEpicUnrealMCPPackageSaver::SavePackage(MeshPackage, ImportedObject);
+        }
+        else if (MeshPackage)
         {
-            FString MeshPackagePath = DestinationPath + AssetName;
-            FString MeshPackageFilename = FPackageName::LongPackageNameToFilename(MeshPackagePath, FPackageName::GetAssetPackageExtension());
-            FSavePackageArgs SaveArgs;
-            SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-            UPackage::SavePackage(MeshPackage, ImportedObject, *MeshPackageFilename, SaveArgs);
+            UnsavedPackages.Add(MakeShared<FJsonValueString>(MeshPackage->GetName()));
         }
     }
 
     // Build result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!bSave)
+    {
+        Result->SetArrayField(TEXT("unsaved_packages"), UnsavedPackages);
+    }
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("name"), AssetName);
     Result->SetStringField(TEXT("path"), DestinationPath + AssetName);
     Result->SetStringField(TEXT("source"), SourcePath);
     Result->SetStringField(TEXT("class"), ImportedObject->GetClass()->GetName());
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
     if (StaticMesh)
     {
@@ -3980,7 +4228,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportMesh(const TSh
     return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSkeletalMesh(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSkeletalMesh(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash)
 {
     // Get required parameters
     FString SourcePath;
@@ -4037,6 +4285,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSkeletalMesh(c
     FString SkeletonPath;
     Params->TryGetStringField(TEXT("skeleton_path"), SkeletonPath);
 
+    // Import cache: an unchanged source with the same options skips the FBX import (and skeleton/physics asset rebuild) entirely
+    const double StartTime = FPlatformTime::Seconds();
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+    const FString ImportHash = KnownImportHash.IsEmpty() ? ComputeImportHash(SourcePath, Params) : KnownImportHash;
+    if (UObject* Existing = bForce ? nullptr : FindUpToDateImport(DestinationPath + AssetName, ImportHash))
+    {
+        return MakeUpToDateResult(Existing, AssetName, SourcePath, ImportHash, StartTime);
+    }
+
     // Create the import task
     UAssetImportTask* ImportTask = NewObject<UAssetImportTask>();
     ImportTask->AddToRoot();
@@ -4114,30 +4372,47 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSkeletalMesh(c
         }
     }
 
+    // Record what produced these assets so the next identical import is a no-op
+    for (UObject* Obj : ImportedObjects)
+    {
+        StoreImportHash(Obj, ImportHash);
+    }
+
     // Save all imported packages immediately to prevent memory accumulation
+    // (import_assets_batch passes save=false and saves once at the end)
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    TArray<TSharedPtr<FJsonValue>> UnsavedPackages;
     for (UObject* Obj : ImportedObjects)
     {
         if (Obj)
         {
             UPackage* ObjPackage = Obj->GetOutermost();
-            if (ObjPackage)
+            if (ObjPackage && bSave)
+            {
+                FEpicUnrealMCPPackageSaver::SavePackage(ObjPackage, Obj);
+            }
+            else if (ObjPackage)
             {
-                FString ObjPackagePath = ObjPackage->GetName();
-                FString ObjPackageFilename = FPackageName::LongPackageNameToFilename(ObjPackagePath, FPackageName::GetAssetPackageExtension());
-                FSavePackageArgs SaveArgs;
-                SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-                UPackage::SavePackage(ObjPackage, Obj, *ObjPackageFilename, SaveArgs);
+                UnsavedPackages.Add(MakeShared<FJsonValueString>(ObjPackage->GetName()));
             }
         }
     }
 
     // Build result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!bSave)
+    {
+        Result->SetArrayField(TEXT("unsaved_packages"), UnsavedPackages);
+    }
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("name"), AssetName);
     Result->SetStringField(TEXT("path"), DestinationPath + AssetName);
     Result->SetStringField(TEXT("source"), SourcePath);
     Result->SetNumberField(TEXT("imported_objects_count"), ImportedObjects.Num());
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
     if (SkeletalMesh)
     {
@@ -4206,7 +4481,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSkeletalMesh(c
     return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportAnimation(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportAnimation(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash)
 {
     // Get required parameters
     FString SourcePath;
@@ -4252,6 +4527,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportAnimation(cons
         DestinationPath += TEXT("/");
     }
 
+    // Import cache: an unchanged source with the same options skips the FBX import entirely
+    const double StartTime = FPlatformTime::Seconds();
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+    const FString ImportHash = KnownImportHash.IsEmpty() ? ComputeImportHash(SourcePath, Params) : KnownImportHash;
+    if (UObject* Existing = bForce ? nullptr : FindUpToDateImport(DestinationPath + AssetName, ImportHash))
+    {
+        return MakeUpToDateResult(Existing, AssetName, SourcePath, ImportHash, StartTime);
+    }
+
     // Create the import task
     UAssetImportTask* ImportTask = NewObject<UAssetImportTask>();
     ImportTask->AddToRoot();
@@ -4290,29 +4575,45 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportAnimation(cons
             FString::Printf(TEXT("Failed to import animation from: %s. Ensure the FBX contains animation data compatible with the target skeleton."), *SourcePath));
     }
 
-    // Save all imported animation packages
+    // Record what produced these assets so the next identical import is a no-op
+    for (UObject* Obj : ImportedObjects)
+    {
+        StoreImportHash(Obj, ImportHash);
+    }
+
+    // Save all imported animation packages (deferred to the end of import_assets_batch when save=false)
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    TArray<TSharedPtr<FJsonValue>> UnsavedPackages;
     for (UObject* Obj : ImportedObjects)
     {
         if (Obj)
         {
             UPackage* ObjPackage = Obj->GetOutermost();
-            if (ObjPackage)
+            if (ObjPackage && bSave)
+            {
+                FEpicUnrealMCPPackageSaver::SavePackage(ObjPackage, Obj);
+            }
+            else if (ObjPackage)
             {
-                FString ObjPackagePath = ObjPackage->GetName();
-                FString ObjPackageFilename = FPackageName::LongPackageNameToFilename(ObjPackagePath, FPackageName::GetAssetPackageExtension());
-                FSavePackageArgs SaveArgs;
-                SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-                UPackage::SavePackage(ObjPackage, Obj, *ObjPackageFilename, SaveArgs);
+                UnsavedPackages.Add(MakeShared<FJsonValueString>(ObjPackage->GetName()));
             }
         }
     }
 
     // Build result - iterate all imported objects (may contain multiple AnimSequences)
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!bSave)
+    {
+        Result->SetArrayField(TEXT("unsaved_packages"), UnsavedPackages);
+    }
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("source"), SourcePath);
     Result->SetStringField(TEXT("skeleton_path"), SkeletonPath);
     Result->SetNumberField(TEXT("imported_count"), ImportedObjects.Num());
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
     TArray<TSharedPtr<FJsonValue>> AnimArray;
     for (UObject* Obj : ImportedObjects)
@@ -4619,6 +4920,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSnapActorToGround(co
         NewLocation.Z = HitResult.Location.Z + VisualBottomOffset;
 
         TargetActor->SetActorLocation(NewLocation);
+        GEngine->BroadcastOnActorMoved(TargetActor);
 
         Result->SetBoolField(TEXT("success"), true);
         Result->SetStringField(TEXT("actor"), ActorName);
@@ -5512,8 +5814,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetNaniteEnabled(con
     Mesh->PostEditChange();
     Mesh->MarkPackageDirty();
 
-    // Save to disk
-    UEditorAssetLibrary::SaveLoadedAsset(Mesh);
+    // Save to disk (or queue it, per save policy)
+    FEpicUnrealMCPPackageSaver::SaveAsset(Mesh);
 
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), true);
@@ -5536,6 +5838,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleScatterFoliage(const
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
     }
 
+    // Precomputed transforms in a bulk segment skip sampling and tracing entirely
+    const TSharedPtr<FJsonObject>* TransformsBulk = nullptr;
+    if (Params->TryGetObjectField(TEXT("transforms_bulk"), TransformsBulk))
+    {
+        return HandleScatterFoliageFromBulk(Params, *TransformsBulk);
+    }
+
     // --- Parse required parameters ---
     FString MeshPath;
     if (!Params->TryGetStringField(TEXT("mesh_path"), MeshPath))
@@ -6081,7 +6390,23 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleScatterFoliage(const
     return Result;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSound(const TSharedPtr<FJsonObject>& Params)
+// Sound settings shared by import_sound and import_assets_batch
+static void ApplySoundImportOptions(USoundWave* Sound, const TSharedPtr<FJsonObject>& Params)
+{
+    bool bLooping = false;
+    if (Params->TryGetBoolField(TEXT("looping"), bLooping))
+    {
+        Sound->bLooping = bLooping;
+    }
+
+    double Volume = 1.0;
+    if (Params->TryGetNumberField(TEXT("volume"), Volume))
+    {
+        Sound->Volume = static_cast<float>(Volume);
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSound(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash)
 {
     // Get required parameters
     FString SourcePath;
@@ -6116,76 +6441,109 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSound(const TS
     // Create package for the sound
     FString PackagePath = DestinationPath + SoundName;
 
-    // If asset already exists, return success — NEVER delete+reimport over loaded assets
+    const double StartTime = FPlatformTime::Seconds();
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+    const FString ImportHash = KnownImportHash.IsEmpty() ? ComputeImportHash(SourcePath, Params) : KnownImportHash;
+
+    UPackage* Package = nullptr;
+    USoundWave* ImportedSound = nullptr;
+    bool bReimported = false;
+
+    // If asset already exists, NEVER delete+reimport over loaded assets
     // (editor subsystems hold RefCount > 0, causing "partially loaded" crash on SavePackage)
     if (UEditorAssetLibrary::DoesAssetExist(PackagePath))
     {
-        UE_LOG(LogTemp, Warning, TEXT("import_sound: Asset '%s' already exists, skipping import"), *PackagePath);
-        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetBoolField(TEXT("success"), true);
-        Result->SetStringField(TEXT("name"), SoundName);
-        Result->SetStringField(TEXT("path"), PackagePath);
-        Result->SetStringField(TEXT("message"), TEXT("Asset already exists, skipped import"));
-        return Result;
-    }
-
-    UPackage* Package = CreatePackage(*PackagePath);
+        UObject* Existing = UEditorAssetLibrary::LoadAsset(PackagePath);
+        const FString StoredHash = GetStoredImportHash(Existing);
+        if (Existing && !bForce && !ImportHash.IsEmpty() && StoredHash == ImportHash)
+        {
+            return MakeUpToDateResult(Existing, SoundName, SourcePath, ImportHash, StartTime);
+        }
 
-    if (!Package)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for sound"));
+        // Assets imported before the cache existed have no hash: keep skipping them unless forced
+        if (!bForce && StoredHash.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("import_sound: Asset '%s' already exists, skipping import"), *PackagePath);
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetBoolField(TEXT("success"), true);
+            Result->SetBoolField(TEXT("skipped"), true);
+            Result->SetStringField(TEXT("name"), SoundName);
+            Result->SetStringField(TEXT("path"), PackagePath);
+            Result->SetStringField(TEXT("message"), TEXT("Asset already exists, skipped import"));
+            return Result;
+        }
+
+        // Source or options changed: reimport in place, the existing object is updated, not replaced
+        ImportedSound = Cast<USoundWave>(Existing);
+        if (!ImportedSound || !FReimportManager::Instance()->Reimport(ImportedSound, false, false, SourcePath, nullptr, INDEX_NONE, false, true))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to re-import sound '%s' from: %s"), *PackagePath, *SourcePath));
+        }
+        Package = ImportedSound->GetOutermost();
+        bReimported = true;
     }
+    else
+    {
+        Package = CreatePackage(*PackagePath);
 
-    // Create sound factory
-    USoundFactory* SoundFactory = NewObject<USoundFactory>();
-    SoundFactory->AddToRoot();
+        if (!Package)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for sound"));
+        }
 
-    // Import the sound
-    bool bCancelled = false;
-    USoundWave* ImportedSound = Cast<USoundWave>(SoundFactory->ImportObject(
-        USoundWave::StaticClass(),
-        Package,
-        FName(*SoundName),
-        RF_Public | RF_Standalone,
-        SourcePath,
-        nullptr,
-        bCancelled
-    ));
+        // Create sound factory
+        USoundFactory* SoundFactory = NewObject<USoundFactory>();
+        SoundFactory->AddToRoot();
 
-    SoundFactory->RemoveFromRoot();
+        // Import the sound
+        bool bCancelled = false;
+        ImportedSound = Cast<USoundWave>(SoundFactory->ImportObject(
+            USoundWave::StaticClass(),
+            Package,
+            FName(*SoundName),
+            RF_Public | RF_Standalone,
+            SourcePath,
+            nullptr,
+            bCancelled
+        ));
 
-    if (!ImportedSound)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to import sound from: %s"), *SourcePath));
-    }
+        SoundFactory->RemoveFromRoot();
 
-    // Apply optional properties
-    bool bLooping = false;
-    if (Params->TryGetBoolField(TEXT("looping"), bLooping))
-    {
-        ImportedSound->bLooping = bLooping;
+        if (!ImportedSound)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to import sound from: %s"), *SourcePath));
+        }
     }
 
-    double Volume = 1.0;
-    if (Params->TryGetNumberField(TEXT("volume"), Volume))
-    {
-        ImportedSound->Volume = static_cast<float>(Volume);
-    }
+    // Apply optional properties
+    ApplySoundImportOptions(ImportedSound, Params);
 
     ImportedSound->PostEditChange();
+    StoreImportHash(ImportedSound, ImportHash);
 
     // Notify asset registry
-    IAssetRegistry::Get()->AssetCreated(ImportedSound);
+    if (!bReimported)
+    {
+        IAssetRegistry::Get()->AssetCreated(ImportedSound);
+    }
 
     // Save package to disk immediately (same pattern as texture import)
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    UPackage::SavePackage(Package, ImportedSound, *PackageFilename, SaveArgs);
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+    if (bSave)
+    {
+        FEpicUnrealMCPPackageSaver::SavePackage(Package, ImportedSound);
+    }
 
     // Build result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!bSave)
+    {
+        Result->SetArrayField(TEXT("unsaved_packages"), TArray<TSharedPtr<FJsonValue>>{ MakeShared<FJsonValueString>(Package->GetName()) });
+    }
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("name"), SoundName);
     Result->SetStringField(TEXT("path"), PackagePath);
@@ -6194,7 +6552,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportSound(const TS
     Result->SetNumberField(TEXT("sample_rate"), static_cast<double>(ImportedSound->GetSampleRateForCurrentPlatform()));
     Result->SetNumberField(TEXT("num_channels"), static_cast<double>(ImportedSound->NumChannels));
     Result->SetBoolField(TEXT("looping"), ImportedSound->bLooping);
-    Result->SetStringField(TEXT("message"), TEXT("Sound imported successfully"));
+    Result->SetStringField(TEXT("import_hash"), ImportHash);
+    Result->SetBoolField(TEXT("reimported"), bReimported);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Result->SetStringField(TEXT("message"), bReimported ? TEXT("Sound re-imported (source or options changed)") : TEXT("Sound imported successfully"));
 
     return Result;
 }
@@ -6280,13 +6641,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleAddAnimNotify(const
     AnimSeq->PostEditChange();
     AnimSeq->MarkPackageDirty();
 
-    // Save to disk
-    UPackage* Package = AnimSeq->GetOutermost();
-    FString PackageName = Package->GetName();
-    FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, AnimSeq, *PackageFilename, SaveArgs);
+    // Save to disk (or queue it, per save policy)
+    FEpicUnrealMCPPackageSaver::SavePackage(AnimSeq->GetOutermost(), AnimSeq);
 
     // Result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -6303,83 +6659,1532 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleAddAnimNotify(const
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetEditorLog(const TSharedPtr<FJsonObject>& Params)
 {
-    // Parameters: num_lines (default 200), filter (optional substring match)
-    int32 NumLines = 200;
-    double NumLinesDouble = 0;
-    if (Params->TryGetNumberField(TEXT("num_lines"), NumLinesDouble))
+    // Parameters: num_lines (default 200), filter (substring), regex, category, verbosity, structured,
+    // cursor (memory) or offset/max_bytes (source "file"). Thread-safe: the bridge runs this on the server thread.
+    FString Source = TEXT("memory");
+    Params->TryGetStringField(TEXT("source"), Source);
+
+    if (Source == TEXT("file"))
+    {
+        // Lines from before the module loaded, or older than the ring holds
+        return FMCPLogCapture::TailFile(Params);
+    }
+    if (Source != TEXT("memory"))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown source '%s' (memory, file)"), *Source));
+    }
+
+    TSharedPtr<FJsonObject> Result = FMCPLogCapture::Get().Query(Params);
+    if (Result->HasField(TEXT("success")) && Result->GetBoolField(TEXT("success")))
     {
-        NumLines = FMath::Clamp(static_cast<int32>(NumLinesDouble), 1, 5000);
+        Result->SetStringField(TEXT("log_file"), FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir() / FApp::GetProjectName() + TEXT(".log")));
     }
+    return Result;
+}
+
+// ============================================================================
+// Batch asset import: import_assets_batch / get_import_batch_status
+//
+// Worker threads read every source file and do the decode work that does not
+// touch UObjects (image decompression, WAV header parse, FBX size/corruption
+// check, import cache hashes). The game thread only creates assets, inside a per-tick time budget, so
+// the editor stays responsive and the client polls progress between ticks.
+// FBX parsing itself stays on the game thread: the FBX SDK importer is a
+// game-thread singleton. Packages are saved once at the end of the batch.
+// ============================================================================
+
+namespace MCPImportBatch
+{
+    enum class EItemType : uint8
+    {
+        Texture,
+        Sound,
+        Mesh,
+        SkeletalMesh,
+        Animation
+    };
 
-    FString Filter;
-    Params->TryGetStringField(TEXT("filter"), Filter);
+    struct FItem
+    {
+        int32 Index = 0;
+        EItemType Type = EItemType::Texture;
+        FString TypeName;
+        FString SourcePath;
+        TSharedPtr<FJsonObject> Params;
+
+        // Written by the worker, read on the game thread once Decode is ready
+        TFuture<void> Decode;
+        FString DecodeError;
+        TArray64<uint8> FileData;
+        FImage Image;
+        uint64 ContentHash = 0;
+        FString ImportHash;
+        int64 FileSize = 0;
+        double DecodeMs = 0.0;
+    };
+
+    struct FBatch
+    {
+        FString Id;
+        TArray<TSharedPtr<FItem>> Items;
+        int32 NextDecode = 0;
+        int32 NextCreate = 0;
+        int32 MaxInFlight = 8;
+        double GameThreadBudgetMs = 30.0;
+        bool bSave = true;
+
+        IImageWrapperModule* ImageWrapper = nullptr;
+        TArray<TSharedPtr<FJsonValue>> Results;
+        TSet<FString> PackagesToSave;
+
+        int32 NumSucceeded = 0;
+        int32 NumFailed = 0;
+        int32 NumSkipped = 0;
+        int64 BytesRead = 0;
+        double StartTime = 0.0;
+        double DecodeMs = 0.0;
+        double CreateMs = 0.0;
+        double SaveMs = 0.0;
+        int32 PackagesSaved = 0;
+        int64 BytesWritten = 0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+
+        FTSTicker::FDelegateHandle TickerHandle;
+    };
 
-    // Find the current log file
-    FString LogDir = FPaths::ProjectLogDir();
-    FString LogFilePath = LogDir / FApp::GetProjectName() + TEXT(".log");
+    TMap<FString, TSharedPtr<FBatch>> Batches;
+    constexpr int32 MaxFinishedBatches = 8;
 
-    if (!FPaths::FileExists(LogFilePath))
+    bool ParseItemType(const FString& TypeName, EItemType& OutType)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Log file not found at: %s"), *LogFilePath));
+        if (TypeName == TEXT("texture")) { OutType = EItemType::Texture; return true; }
+        if (TypeName == TEXT("sound")) { OutType = EItemType::Sound; return true; }
+        if (TypeName == TEXT("mesh")) { OutType = EItemType::Mesh; return true; }
+        if (TypeName == TEXT("skeletal_mesh")) { OutType = EItemType::SkeletalMesh; return true; }
+        if (TypeName == TEXT("animation")) { OutType = EItemType::Animation; return true; }
+        return false;
     }
 
-    // Read the entire log file
-    FString LogContent;
-    if (!FFileHelper::LoadFileToString(LogContent, *LogFilePath))
+    FString InferItemType(const FString& SourcePath)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to read log file: %s"), *LogFilePath));
+        const FString Ext = FPaths::GetExtension(SourcePath).ToLower();
+        if (Ext == TEXT("png") || Ext == TEXT("jpg") || Ext == TEXT("jpeg") || Ext == TEXT("tga") ||
+            Ext == TEXT("bmp") || Ext == TEXT("exr") || Ext == TEXT("hdr") || Ext == TEXT("tif") || Ext == TEXT("tiff"))
+        {
+            return TEXT("texture");
+        }
+        if (Ext == TEXT("wav") || Ext == TEXT("ogg") || Ext == TEXT("flac"))
+        {
+            return TEXT("sound");
+        }
+        if (Ext == TEXT("fbx") || Ext == TEXT("obj"))
+        {
+            return TEXT("mesh");
+        }
+        return FString();
+    }
+
+    // Worker thread: no UObject access here
+    void DecodeItem(FItem& Item, IImageWrapperModule* ImageWrapper)
+    {
+        const double Start = FPlatformTime::Seconds();
+
+        if (Item.Type != EItemType::Texture && Item.Type != EItemType::Sound)
+        {
+            // FBX: the importer reads the file itself on the game thread, so only size and hash it here
+            // (streamed, never held whole) and hand the hash to the handler instead of re-reading it there
+            Item.FileSize = IFileManager::Get().FileSize(*Item.SourcePath);
+            if (Item.FileSize < 0)
+            {
+                Item.FileSize = 0;
+                Item.DecodeError = FString::Printf(TEXT("Source file not found or unreadable: %s"), *Item.SourcePath);
+            }
+            // Same corruption guard as import_skeletal_mesh (some exported FBX files are tiny JSON stubs)
+            else if (Item.FileSize < 1024)
+            {
+                Item.DecodeError = FString::Printf(TEXT("Source file too small (%lld bytes), likely corrupt: %s"), Item.FileSize, *Item.SourcePath);
+            }
+            else if (!HashSourceFile(Item.SourcePath, Item.ContentHash))
+            {
+                Item.DecodeError = FString::Printf(TEXT("Source file not found or unreadable: %s"), *Item.SourcePath);
+            }
+            else
+            {
+                Item.ImportHash = MakeImportHash(Item.ContentHash, Item.Params);
+            }
+        }
+        else if (!FFileHelper::LoadFileToArray(Item.FileData, *Item.SourcePath))
+        {
+            Item.DecodeError = FString::Printf(TEXT("Source file not found or unreadable: %s"), *Item.SourcePath);
+        }
+        else
+        {
+            Item.FileSize = Item.FileData.Num();
+            switch (Item.Type)
+            {
+            case EItemType::Texture:
+                Item.ImportHash = ComputeImportHash(Item.FileData, Item.Params);
+                if (!ImageWrapper->DecompressImage(Item.FileData.GetData(), Item.FileData.Num(), Item.Image))
+                {
+                    Item.DecodeError = FString::Printf(TEXT("Unsupported or corrupt image: %s"), *Item.SourcePath);
+                }
+                Item.FileData.Empty();
+                break;
+
+            case EItemType::Sound:
+                Item.ImportHash = ComputeImportHash(Item.FileData, Item.Params);
+                if (FPaths::GetExtension(Item.SourcePath).Equals(TEXT("wav"), ESearchCase::IgnoreCase))
+                {
+                    FWaveModInfo WaveInfo;
+                    FString WaveError;
+                    if (!WaveInfo.ReadWaveInfo(Item.FileData.GetData(), (int32)Item.FileData.Num(), &WaveError))
+                    {
+                        Item.DecodeError = FString::Printf(TEXT("Invalid WAV file %s: %s"), *Item.SourcePath, *WaveError);
+                    }
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        Item.DecodeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
     }
 
-    // Split into lines
-    TArray<FString> AllLines;
-    LogContent.ParseIntoArrayLines(AllLines);
+    TSharedPtr<FJsonObject> MakeSkippedResult(const FString& Name, const FString& PackagePath)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetBoolField(TEXT("skipped"), true);
+        Result->SetStringField(TEXT("name"), Name);
+        Result->SetStringField(TEXT("path"), PackagePath);
+        Result->SetStringField(TEXT("message"), TEXT("Asset already exists, skipped import"));
+        return Result;
+    }
 
-    // Apply filter if provided
-    TArray<FString> FilteredLines;
-    if (Filter.IsEmpty())
+    // Existing asset: unchanged (import cache hit) and untracked assets are answered here.
+    // Changed or forced ones return nullptr and go through the single-file handler's in-place re-import.
+    TSharedPtr<FJsonObject> CheckExisting(const FItem& Item, const FString& Name, const FString& PackagePath,
+        const FString& ImportHash, double StartTime)
     {
-        // No filter — take last N lines
-        int32 StartIdx = FMath::Max(0, AllLines.Num() - NumLines);
-        for (int32 i = StartIdx; i < AllLines.Num(); i++)
+        bool bForce = false;
+        Item.Params->TryGetBoolField(TEXT("force"), bForce);
+        if (bForce)
+        {
+            return nullptr;
+        }
+
+        UObject* Existing = UEditorAssetLibrary::LoadAsset(PackagePath);
+        const FString StoredHash = GetStoredImportHash(Existing);
+        if (Existing && StoredHash == ImportHash)
         {
-            FilteredLines.Add(AllLines[i]);
+            return MakeUpToDateResult(Existing, Name, Item.SourcePath, ImportHash, StartTime);
         }
+        return StoredHash.IsEmpty() ? MakeSkippedResult(Name, PackagePath) : nullptr;
     }
-    else
+
+    // Game thread: build the texture from worker-decoded pixels instead of re-reading the file
+    TSharedPtr<FJsonObject> CreateTexture(FItem& Item, TSet<FString>& OutPackages)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        const FString ImportHash = Item.ImportHash;
+
+        FString TextureName;
+        if (!Item.Params->TryGetStringField(TEXT("texture_name"), TextureName))
+        {
+            TextureName = FPaths::GetBaseFilename(Item.SourcePath);
+        }
+
+        FString DestinationPath = TEXT("/Game/Textures/");
+        Item.Params->TryGetStringField(TEXT("destination_path"), DestinationPath);
+        if (!DestinationPath.EndsWith(TEXT("/")))
+        {
+            DestinationPath += TEXT("/");
+        }
+
+        // Same rule as import_texture: never delete+reimport over loaded assets
+        const FString PackagePath = DestinationPath + TextureName;
+        if (UEditorAssetLibrary::DoesAssetExist(PackagePath))
+        {
+            return CheckExisting(Item, TextureName, PackagePath, ImportHash, StartTime);
+        }
+
+        UPackage* Package = CreatePackage(*PackagePath);
+        if (!Package)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for texture"));
+        }
+
+        UTexture2D* Texture = NewObject<UTexture2D>(Package, FName(*TextureName), RF_Public | RF_Standalone | RF_Transactional);
+        const ETextureSourceFormat SourceFormat = FImageCoreUtils::ConvertToTextureSourceFormat(Item.Image.Format);
+        Texture->Source.Init(Item.Image.SizeX, Item.Image.SizeY, 1, 1, SourceFormat, Item.Image.RawData.GetData());
+        Texture->SRGB = Item.Image.GammaSpace != EGammaSpace::Linear;
+        if (SourceFormat == TSF_RGBA16F || SourceFormat == TSF_RGBA32F)
+        {
+            Texture->CompressionSettings = TC_HDR;
+        }
+        Texture->AssetImportData->Update(Item.SourcePath);
+
+        ApplyTextureImportOptions(Texture, Item.Params);
+
+        Texture->PostEditChange();
+        StoreImportHash(Texture, ImportHash);
+        IAssetRegistry::Get()->AssetCreated(Texture);
+        Package->MarkPackageDirty();
+        OutPackages.Add(Package->GetName());
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetStringField(TEXT("name"), TextureName);
+        Result->SetStringField(TEXT("path"), PackagePath);
+        Result->SetNumberField(TEXT("width"), Item.Image.SizeX);
+        Result->SetNumberField(TEXT("height"), Item.Image.SizeY);
+        Result->SetStringField(TEXT("import_hash"), ImportHash);
+        return Result;
+    }
+
+    // Game thread: hand the worker-loaded bytes straight to the sound factory
+    TSharedPtr<FJsonObject> CreateSound(FItem& Item, TSet<FString>& OutPackages)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        const FString ImportHash = Item.ImportHash;
+
+        FString SoundName;
+        if (!Item.Params->TryGetStringField(TEXT("sound_name"), SoundName))
+        {
+            SoundName = FPaths::GetBaseFilename(Item.SourcePath);
+        }
+
+        FString DestinationPath = TEXT("/Game/Audio/");
+        Item.Params->TryGetStringField(TEXT("destination_path"), DestinationPath);
+        if (!DestinationPath.EndsWith(TEXT("/")))
+        {
+            DestinationPath += TEXT("/");
+        }
+
+        const FString PackagePath = DestinationPath + SoundName;
+        if (UEditorAssetLibrary::DoesAssetExist(PackagePath))
+        {
+            return CheckExisting(Item, SoundName, PackagePath, ImportHash, StartTime);
+        }
+
+        UPackage* Package = CreatePackage(*PackagePath);
+        if (!Package)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create package for sound"));
+        }
+
+        USoundFactory* SoundFactory = NewObject<USoundFactory>();
+        SoundFactory->AddToRoot();
+
+        // FactoryCreateBinary records import data from CurrentFilename (ImportObject normally sets it)
+        UFactory::CurrentFilename = Item.SourcePath;
+        const uint8* Buffer = Item.FileData.GetData();
+        const FString Extension = FPaths::GetExtension(Item.SourcePath);
+        USoundWave* Sound = Cast<USoundWave>(SoundFactory->FactoryCreateBinary(
+            USoundWave::StaticClass(), Package, FName(*SoundName), RF_Public | RF_Standalone,
+            nullptr, *Extension, Buffer, Buffer + Item.FileData.Num(), GWarn));
+        UFactory::CurrentFilename.Empty();
+
+        SoundFactory->RemoveFromRoot();
+
+        if (!Sound)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to import sound from: %s"), *Item.SourcePath));
+        }
+
+        ApplySoundImportOptions(Sound, Item.Params);
+
+        Sound->PostEditChange();
+        StoreImportHash(Sound, ImportHash);
+        IAssetRegistry::Get()->AssetCreated(Sound);
+        Package->MarkPackageDirty();
+        OutPackages.Add(Package->GetName());
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetStringField(TEXT("name"), SoundName);
+        Result->SetStringField(TEXT("path"), PackagePath);
+        Result->SetNumberField(TEXT("duration_seconds"), Sound->Duration);
+        Result->SetNumberField(TEXT("num_channels"), static_cast<double>(Sound->NumChannels));
+        Result->SetStringField(TEXT("import_hash"), ImportHash);
+        return Result;
+    }
+
+    void LaunchDecodes(FBatch& Batch)
+    {
+        while (Batch.NextDecode < Batch.Items.Num() && Batch.NextDecode - Batch.NextCreate < Batch.MaxInFlight)
+        {
+            TSharedPtr<FItem> Item = Batch.Items[Batch.NextDecode++];
+            IImageWrapperModule* ImageWrapper = Batch.ImageWrapper;
+            Item->Decode = Async(EAsyncExecution::ThreadPool, [Item, ImageWrapper]()
+            {
+                DecodeItem(*Item, ImageWrapper);
+            });
+        }
+    }
+
+    void SaveBatchPackages(FBatch& Batch)
     {
-        // Filter matching lines, then take last N
-        TArray<FString> MatchingLines;
-        for (const FString& Line : AllLines)
+        TArray<UPackage*> Packages;
+        for (const FString& PackageName : Batch.PackagesToSave)
         {
-            if (Line.Contains(Filter))
+            UPackage* Package = FindPackage(nullptr, *PackageName);
+            if (Package && Package->IsDirty())
             {
-                MatchingLines.Add(Line);
+                Packages.Add(Package);
             }
         }
-        int32 StartIdx = FMath::Max(0, MatchingLines.Num() - NumLines);
-        for (int32 i = StartIdx; i < MatchingLines.Num(); i++)
+
+        // Under the deferred/on_flush policies the batch's packages join the shared save queue
+        if (FEpicUnrealMCPPackageSaver::GetPolicy() != EMCPSavePolicy::Immediate)
         {
-            FilteredLines.Add(MatchingLines[i]);
+            for (UPackage* Package : Packages)
+            {
+                FEpicUnrealMCPPackageSaver::SavePackage(Package, Package->FindAssetInPackage());
+            }
+            return;
         }
+
+        TSharedPtr<FJsonObject> SaveResult = FEpicUnrealMCPPackageSaver::SavePackages(Packages);
+        Batch.PackagesSaved = (int32)SaveResult->GetNumberField(TEXT("packages_saved"));
+        Batch.BytesWritten = (int64)SaveResult->GetNumberField(TEXT("bytes_written"));
+        Batch.SaveMs = SaveResult->GetNumberField(TEXT("save_ms"));
     }
 
-    // Build result
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetStringField(TEXT("log_file"), LogFilePath);
-    Result->SetNumberField(TEXT("total_lines"), AllLines.Num());
-    Result->SetNumberField(TEXT("returned_lines"), FilteredLines.Num());
+    TSharedPtr<FJsonObject> MakeStatus(const FBatch& Batch, int32 Since)
+    {
+        const int32 Completed = Batch.NextCreate;
+        const int32 Total = Batch.Items.Num();
+
+        TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+        Status->SetBoolField(TEXT("success"), true);
+        Status->SetStringField(TEXT("batch_id"), Batch.Id);
+        Status->SetStringField(TEXT("state"), Batch.bFinished ? TEXT("finished") : TEXT("running"));
+        Status->SetNumberField(TEXT("total"), Total);
+        Status->SetNumberField(TEXT("completed"), Completed);
+        Status->SetNumberField(TEXT("progress"), Total > 0 ? (double)Completed / (double)Total : 1.0);
+        Status->SetNumberField(TEXT("succeeded"), Batch.NumSucceeded);
+        Status->SetNumberField(TEXT("failed"), Batch.NumFailed);
+        Status->SetNumberField(TEXT("skipped"), Batch.NumSkipped);
+        Status->SetNumberField(TEXT("bytes_read"), (double)Batch.BytesRead);
+        Status->SetNumberField(TEXT("decode_ms"), Batch.DecodeMs);
+        Status->SetNumberField(TEXT("create_ms"), Batch.CreateMs);
+        Status->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - Batch.StartTime) * 1000.0);
+
+        // Only the results the client has not seen yet
+        TArray<TSharedPtr<FJsonValue>> NewResults;
+        for (int32 i = FMath::Max(Since, 0); i < Batch.Results.Num(); ++i)
+        {
+            NewResults.Add(Batch.Results[i]);
+        }
+        Status->SetArrayField(TEXT("results"), NewResults);
+        Status->SetNumberField(TEXT("next_since"), Batch.Results.Num());
+
+        if (Batch.bFinished)
+        {
+            Status->SetNumberField(TEXT("save_ms"), Batch.SaveMs);
+            Status->SetNumberField(TEXT("packages_saved"), Batch.PackagesSaved);
+            Status->SetNumberField(TEXT("bytes_written"), (double)Batch.BytesWritten);
+        }
+        return Status;
+    }
+}
+
+FEpicUnrealMCPEditorCommands::~FEpicUnrealMCPEditorCommands()
+{
+    using namespace MCPImportBatch;
+
+    // Running import batches tick through this object; stop them and drop their state
+    for (const TPair<FString, TSharedPtr<FBatch>>& Pair : Batches)
+    {
+        if (Pair.Value->TickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Pair.Value->TickerHandle);
+        }
+    }
+    Batches.Empty();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleImportAssetsBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    using namespace MCPImportBatch;
+
+    const TArray<TSharedPtr<FJsonValue>>* Files = nullptr;
+    if (!Params->TryGetArrayField(TEXT("files"), Files) || Files->Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing or empty 'files' array"));
+    }
+
+    // Per-type defaults ({"texture": {...}, "mesh": {...}}), overridden by fields on each file entry
+    const TSharedPtr<FJsonObject>* Defaults = nullptr;
+    Params->TryGetObjectField(TEXT("defaults"), Defaults);
+
+    TSharedPtr<FBatch> Batch = MakeShared<FBatch>();
+    Batch->Id = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+    Batch->StartTime = FPlatformTime::Seconds();
+    Params->TryGetBoolField(TEXT("save"), Batch->bSave);
+
+    int32 MaxInFlight = Batch->MaxInFlight;
+    Params->TryGetNumberField(TEXT("max_in_flight"), MaxInFlight);
+    Batch->MaxInFlight = FMath::Clamp(MaxInFlight, 1, 64);
+    Params->TryGetNumberField(TEXT("game_thread_budget_ms"), Batch->GameThreadBudgetMs);
+
+    // ImageWrapper must be loaded on the game thread before workers use it
+    Batch->ImageWrapper = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    for (int32 i = 0; i < Files->Num(); ++i)
+    {
+        const TSharedPtr<FJsonObject>* FileObj = nullptr;
+        if (!(*Files)[i]->TryGetObject(FileObj))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("files[%d] is not an object"), i));
+        }
+
+        TSharedPtr<FItem> Item = MakeShared<FItem>();
+        Item->Index = i;
+        if (!(*FileObj)->TryGetStringField(TEXT("source_path"), Item->SourcePath))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("files[%d] is missing 'source_path'"), i));
+        }
+
+        if (!(*FileObj)->TryGetStringField(TEXT("type"), Item->TypeName))
+        {
+            Item->TypeName = InferItemType(Item->SourcePath);
+        }
+        if (!ParseItemType(Item->TypeName, Item->Type))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("files[%d]: unknown type '%s' (texture, sound, mesh, skeletal_mesh, animation)"), i, *Item->TypeName));
+        }
 
-    if (!Filter.IsEmpty())
+        Item->Params = MakeShared<FJsonObject>();
+        const TSharedPtr<FJsonObject>* TypeDefaults = nullptr;
+        if (Defaults && (*Defaults)->TryGetObjectField(Item->TypeName, TypeDefaults))
+        {
+            Item->Params->Values = (*TypeDefaults)->Values;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*FileObj)->Values)
+        {
+            Item->Params->Values.Add(Field.Key, Field.Value);
+        }
+        // FBX handlers save per file unless told otherwise; the batch saves once at the end
+        Item->Params->SetBoolField(TEXT("save"), false);
+
+        Batch->Items.Add(Item);
+    }
+
+    // Drop the oldest finished batches so status stays queryable for recent ones only
+    TArray<TSharedPtr<FBatch>> Finished;
+    for (const TPair<FString, TSharedPtr<FBatch>>& Pair : Batches)
+    {
+        if (Pair.Value->bFinished)
+        {
+            Finished.Add(Pair.Value);
+        }
+    }
+    Finished.Sort([](const TSharedPtr<FBatch>& A, const TSharedPtr<FBatch>& B)
+    {
+        return A->FinishTime < B->FinishTime;
+    });
+    for (int32 i = 0; i + MaxFinishedBatches <= Finished.Num(); ++i)
+    {
+        Batches.Remove(Finished[i]->Id);
+    }
+
+    Batches.Add(Batch->Id, Batch);
+    LaunchDecodes(*Batch);
+
+    // The ticker can outlive this handler object (bridge teardown); the destructor removes it,
+    // and the weak pointer covers a tick already in flight
+    const FString BatchId = Batch->Id;
+    TWeakPtr<FEpicUnrealMCPEditorCommands> WeakThis = AsShared();
+    Batch->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, BatchId](float DeltaTime) -> bool
     {
-        Result->SetStringField(TEXT("filter"), Filter);
+        TSharedPtr<FEpicUnrealMCPEditorCommands> This = WeakThis.Pin();
+        return This.IsValid() && This->TickImportBatch(BatchId);
+    }));
+
+    UE_LOG(LogTemp, Display, TEXT("import_assets_batch: Started batch %s with %d files (%d decode workers in flight)"),
+        *BatchId, Batch->Items.Num(), Batch->MaxInFlight);
+
+    TSharedPtr<FJsonObject> Result = MakeStatus(*Batch, 0);
+    Result->SetStringField(TEXT("message"), TEXT("Batch started; poll get_import_batch_status for progress"));
+    return Result;
+}
+
+bool FEpicUnrealMCPEditorCommands::TickImportBatch(const FString& BatchId)
+{
+    using namespace MCPImportBatch;
+
+    TSharedPtr<FBatch>* Found = Batches.Find(BatchId);
+    if (!Found)
+    {
+        return false;
     }
+    FBatch& Batch = **Found;
 
-    // Join filtered lines into a single string (more compact than JSON array)
-    FString JoinedLines = FString::Join(FilteredLines, TEXT("\n"));
-    Result->SetStringField(TEXT("lines"), JoinedLines);
+    const double TickStart = FPlatformTime::Seconds();
+    while (Batch.NextCreate < Batch.Items.Num())
+    {
+        FItem& Item = *Batch.Items[Batch.NextCreate];
+        if (!Item.Decode.IsReady())
+        {
+            break; // worker still decoding, come back next tick
+        }
 
+        const double CreateStart = FPlatformTime::Seconds();
+        TSharedPtr<FJsonObject> ItemResult;
+        if (!Item.DecodeError.IsEmpty())
+        {
+            ItemResult = FEpicUnrealMCPCommonUtils::CreateErrorResponse(Item.DecodeError);
+        }
+        else
+        {
+            switch (Item.Type)
+            {
+            case EItemType::Texture:
+                // Changed or forced existing textures reimport in place through the single-file path,
+                // which leaves the package to the batch save (save=false, unsaved_packages)
+                ItemResult = CreateTexture(Item, Batch.PackagesToSave);
+                ItemResult = ItemResult ? ItemResult : HandleImportTexture(Item.Params, Item.ImportHash);
+                break;
+            case EItemType::Sound:
+                ItemResult = CreateSound(Item, Batch.PackagesToSave);
+                ItemResult = ItemResult ? ItemResult : HandleImportSound(Item.Params, Item.ImportHash);
+                break;
+            case EItemType::Mesh:
+                ItemResult = HandleImportMesh(Item.Params, Item.ImportHash);
+                break;
+            case EItemType::SkeletalMesh:
+                ItemResult = HandleImportSkeletalMesh(Item.Params, Item.ImportHash);
+                break;
+            case EItemType::Animation:
+                ItemResult = HandleImportAnimation(Item.Params, Item.ImportHash);
+                break;
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* Unsaved = nullptr;
+            if (ItemResult->TryGetArrayField(TEXT("unsaved_packages"), Unsaved))
+            {
+                for (const TSharedPtr<FJsonValue>& PackageName : *Unsaved)
+                {
+                    Batch.PackagesToSave.Add(PackageName->AsString());
+                }
+                ItemResult->RemoveField(TEXT("unsaved_packages"));
+            }
+        }
+        const double CreateMs = (FPlatformTime::Seconds() - CreateStart) * 1000.0;
+
+        bool bItemSuccess = false;
+        bool bItemSkipped = false;
+        ItemResult->TryGetBoolField(TEXT("success"), bItemSuccess);
+        ItemResult->TryGetBoolField(TEXT("skipped"), bItemSkipped);
+        Batch.NumSucceeded += (bItemSuccess && !bItemSkipped) ? 1 : 0;
+        Batch.NumSkipped += bItemSkipped ? 1 : 0;
+        Batch.NumFailed += bItemSuccess ? 0 : 1;
+        Batch.BytesRead += Item.FileSize;
+        Batch.DecodeMs += Item.DecodeMs;
+        Batch.CreateMs += CreateMs;
+
+        ItemResult->SetNumberField(TEXT("index"), Item.Index);
+        ItemResult->SetStringField(TEXT("type"), Item.TypeName);
+        ItemResult->SetStringField(TEXT("source"), Item.SourcePath);
+        ItemResult->SetNumberField(TEXT("decode_ms"), Item.DecodeMs);
+        ItemResult->SetNumberField(TEXT("create_ms"), CreateMs);
+        Batch.Results.Add(MakeShared<FJsonValueObject>(ItemResult));
+
+        // Decoded pixels/bytes are no longer needed once the asset exists
+        Item.FileData.Empty();
+        Item.Image = FImage();
+        Batch.NextCreate++;
+
+        LaunchDecodes(Batch);
+
+        if ((FPlatformTime::Seconds() - TickStart) * 1000.0 >= Batch.GameThreadBudgetMs)
+        {
+            break;
+        }
+    }
+
+    if (Batch.NextCreate < Batch.Items.Num())
+    {
+        return true;
+    }
+
+    if (Batch.bSave)
+    {
+        SaveBatchPackages(Batch);
+    }
+    Batch.bFinished = true;
+    Batch.FinishTime = FPlatformTime::Seconds();
+    Batch.TickerHandle.Reset();
+
+    UE_LOG(LogTemp, Display, TEXT("import_assets_batch: Batch %s finished - %d ok, %d skipped, %d failed, %.0f ms total (decode %.0f ms on workers, create %.0f ms, save %.0f ms for %d packages)"),
+        *Batch.Id, Batch.NumSucceeded, Batch.NumSkipped, Batch.NumFailed,
+        (FPlatformTime::Seconds() - Batch.StartTime) * 1000.0, Batch.DecodeMs, Batch.CreateMs, Batch.SaveMs, Batch.PackagesSaved);
+    return false;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetImportBatchStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    using namespace MCPImportBatch;
+
+    FString BatchId;
+    if (!Params->TryGetStringField(TEXT("batch_id"), BatchId))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'batch_id' parameter"));
+    }
+
+    const TSharedPtr<FBatch>* Batch = Batches.Find(BatchId);
+    if (!Batch)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown import batch: %s"), *BatchId));
+    }
+
+    int32 Since = 0;
+    Params->TryGetNumberField(TEXT("since"), Since);
+    return MakeStatus(**Batch, Since);
+}
+
+// ============================================================================
+// Save policy: set_save_policy / flush_dirty_packages
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetSavePolicy(const TSharedPtr<FJsonObject>& Params)
+{
+    // No arguments: report the current policy
+    FString PolicyName;
+    if (Params->TryGetStringField(TEXT("policy"), PolicyName))
+    {
+        EMCPSavePolicy Policy;
+        if (!FEpicUnrealMCPPackageSaver::ParsePolicy(PolicyName, Policy))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown save policy '%s' (immediate, deferred, on_flush)"), *PolicyName));
+        }
+
+        TSharedPtr<FJsonObject> Current = FEpicUnrealMCPPackageSaver::GetStatus();
+        double IdleSeconds = Current->GetNumberField(TEXT("deferred_idle_seconds"));
+        int32 MaxQueued = (int32)Current->GetNumberField(TEXT("deferred_max_queued"));
+        Params->TryGetNumberField(TEXT("deferred_idle_seconds"), IdleSeconds);
+        Params->TryGetNumberField(TEXT("deferred_max_queued"), MaxQueued);
+        FEpicUnrealMCPPackageSaver::SetDeferredLimits((float)IdleSeconds, MaxQueued);
+
+        FEpicUnrealMCPPackageSaver::SetPolicy(Policy);
+        UE_LOG(LogTemp, Display, TEXT("set_save_policy: Save policy is now '%s'"), *FEpicUnrealMCPPackageSaver::PolicyToString(Policy));
+    }
+
+    return FEpicUnrealMCPPackageSaver::GetStatus();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFlushDirtyPackages(const TSharedPtr<FJsonObject>& Params)
+{
+    // Only the queue by default; include_untracked also saves /Game packages that handlers only marked dirty
+    bool bIncludeUntracked = false;
+    Params->TryGetBoolField(TEXT("include_untracked"), bIncludeUntracked);
+
+    return FEpicUnrealMCPPackageSaver::Flush(bIncludeUntracked);
+}
+
+// ============================================================================
+// Instanced spawning: spawn_instanced_batch
+// ============================================================================
+
+namespace MCPInstancing
+{
+    /** Mesh + per-slot override materials; instances with equal keys share one component */
+    FString MakeGroupKey(const UStaticMesh* Mesh, const TArray<UMaterialInterface*>& SlotMaterials)
+    {
+        FString Key = Mesh->GetPathName();
+        for (const UMaterialInterface* Material : SlotMaterials)
+        {
+            Key += TEXT("|");
+            Key += Material ? Material->GetPathName() : FString();
+        }
+        return Key;
+    }
+
+    FString MakeGroupKey(const UInstancedStaticMeshComponent* Component)
+    {
+        const UStaticMesh* Mesh = Component->GetStaticMesh();
+        TArray<UMaterialInterface*> SlotMaterials;
+        SlotMaterials.SetNumZeroed(Mesh->GetStaticMaterials().Num());
+        for (int32 Slot = 0; Slot < SlotMaterials.Num(); ++Slot)
+        {
+            SlotMaterials[Slot] = Component->OverrideMaterials.IsValidIndex(Slot) ? Component->OverrideMaterials[Slot].Get() : nullptr;
+        }
+        return MakeGroupKey(Mesh, SlotMaterials);
+    }
+
+    /** Empty container actor with a root component, set up like the scatter_foliage container */
+    AActor* SpawnContainer(UWorld* World, const FString& ActorName, const FVector& Location, const FString& FolderPath)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = *ActorName;
+        SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+
+        AActor* ContainerActor = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        if (!ContainerActor)
+        {
+            return nullptr;
+        }
+        ContainerActor->SetFlags(RF_Transactional);
+
+        USceneComponent* RootComp = NewObject<USceneComponent>(ContainerActor, TEXT("Root"));
+        RootComp->SetFlags(RF_Transactional);
+        ContainerActor->SetRootComponent(RootComp);
+        RootComp->RegisterComponent();
+        ContainerActor->AddInstanceComponent(RootComp);
+
+        ContainerActor->SetActorLabel(ActorName);
+        ContainerActor->SetFolderPath(*FolderPath);
+        return ContainerActor;
+    }
+
+    UInstancedStaticMeshComponent* CreateComponent(AActor* ContainerActor, UStaticMesh* Mesh,
+        const TArray<UMaterialInterface*>& SlotMaterials, bool bHierarchical,
+        EComponentMobility::Type Mobility = EComponentMobility::Static)
+    {
+        const FName ComponentName = MakeUniqueObjectName(ContainerActor,
+            bHierarchical ? UHierarchicalInstancedStaticMeshComponent::StaticClass() : UInstancedStaticMeshComponent::StaticClass(),
+            *FString::Printf(TEXT("%s_%s"), bHierarchical ? TEXT("HISM") : TEXT("ISM"), *Mesh->GetName()));
+
+        UInstancedStaticMeshComponent* Component = bHierarchical
+            ? NewObject<UHierarchicalInstancedStaticMeshComponent>(ContainerActor, ComponentName)
+            : NewObject<UInstancedStaticMeshComponent>(ContainerActor, ComponentName);
+        Component->SetFlags(RF_Transactional);
+        Component->CreationMethod = EComponentCreationMethod::Instance;
+        Component->SetStaticMesh(Mesh);
+        Component->SetMobility(Mobility);
+        Component->AttachToComponent(ContainerActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+
+        for (int32 Slot = 0; Slot < SlotMaterials.Num(); ++Slot)
+        {
+            if (SlotMaterials[Slot])
+            {
+                Component->SetMaterial(Slot, SlotMaterials[Slot]);
+            }
+        }
+
+        Component->RegisterComponent();
+        ContainerActor->AddInstanceComponent(Component);
+        return Component;
+    }
+
+    /**
+     * Batch-add world-space instances, rebuild the HISM tree once and notify the editor
+     * @param Labels / SourceActors Per-instance names kept in UMCPInstanceMetadata (may be empty)
+     */
+    void AddInstances(UInstancedStaticMeshComponent* Component, const TArray<FTransform>& Transforms,
+        const TArray<FString>& Labels = TArray<FString>(), const TArray<FString>& SourceActors = TArray<FString>())
+    {
+        UHierarchicalInstancedStaticMeshComponent* HISM = Cast<UHierarchicalInstancedStaticMeshComponent>(Component);
+        if (HISM)
+        {
+            HISM->bAutoRebuildTreeOnInstanceChanges = false;
+        }
+
+        Component->Modify();
+        const int32 FirstInstance = Component->GetInstanceCount();
+
+        UMCPInstanceMetadata* Metadata = Component->GetAssetUserData<UMCPInstanceMetadata>();
+        if (!Metadata && (Labels.ContainsByPredicate([](const FString& L) { return !L.IsEmpty(); }) || SourceActors.Num() > 0))
+        {
+            Metadata = NewObject<UMCPInstanceMetadata>(Component, NAME_None, RF_Transactional);
+            Component->AddAssetUserData(Metadata);
+        }
+        if (Metadata)
+        {
+            // Instances added before the metadata existed get empty entries
+            Metadata->Modify();
+            Metadata->Labels.SetNum(FirstInstance);
+            Metadata->SourceActors.SetNum(FirstInstance);
+            for (int32 i = 0; i < Transforms.Num(); ++i)
+            {
+                Metadata->Labels.Add(Labels.IsValidIndex(i) ? Labels[i] : FString());
+                Metadata->SourceActors.Add(SourceActors.IsValidIndex(i) ? SourceActors[i] : FString());
+            }
+        }
+
+        Component->AddInstances(Transforms, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+
+        if (HISM)
+        {
+            // Must happen before save or reload will crash
+            HISM->BuildTreeIfOutdated(true, true);
+            HISM->bAutoRebuildTreeOnInstanceChanges = true;
+        }
+
+        FProperty* PerInstanceProp = FindFieldChecked<FProperty>(
+            UInstancedStaticMeshComponent::StaticClass(),
+            GET_MEMBER_NAME_CHECKED(UInstancedStaticMeshComponent, PerInstanceSMData)
+        );
+        FPropertyChangedEvent PropertyEvent(PerInstanceProp);
+        Component->PostEditChangeProperty(PropertyEvent);
+        Component->MarkPackageDirty();
+    }
+
+    void MarkContainerDirty(AActor* ContainerActor)
+    {
+        ContainerActor->Modify();
+        ContainerActor->MarkPackageDirty();
+        if (UPackage* ExtPackage = ContainerActor->GetExternalPackage())
+        {
+            ExtPackage->SetDirtyFlag(true);
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnInstancedBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+    if (!Params->TryGetArrayField(TEXT("items"), Items) || Items->Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing or empty 'items' array"));
+    }
+
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("name"), ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    FString ComponentType = TEXT("hism");
+    Params->TryGetStringField(TEXT("component_type"), ComponentType);
+    if (ComponentType != TEXT("hism") && ComponentType != TEXT("ism"))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown component_type '%s' (hism, ism)"), *ComponentType));
+    }
+    const bool bHierarchical = ComponentType == TEXT("hism");
+
+    FString FolderPath = TEXT("Instanced");
+    Params->TryGetStringField(TEXT("folder"), FolderPath);
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    // An existing container with this name is appended to; anything else with the name is a conflict
+    AActor* ContainerActor = FEpicUnrealMCPCommonUtils::FindActorByName(World, ActorName);
+    const bool bAppend = ContainerActor != nullptr;
+    if (ContainerActor && ContainerActor->GetClass() != AActor::StaticClass())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Actor with name '%s' already exists and is not an instance container"), *ActorName));
+    }
+
+    // --- Resolve items and group them by mesh + materials (each asset path is loaded once) ---
+    struct FGroup
+    {
+        UStaticMesh* Mesh = nullptr;
+        TArray<UMaterialInterface*> SlotMaterials;
+        TArray<FTransform> Transforms;
+        TArray<FString> Labels;
+    };
+    TMap<FString, FGroup> Groups;
+    TMap<FString, UObject*> LoadedAssets;
+    auto LoadCached = [&LoadedAssets](const FString& Path) -> UObject*
+    {
+        if (UObject** Found = LoadedAssets.Find(Path))
+        {
+            return *Found;
+        }
+        UObject* Asset = UEditorAssetLibrary::LoadAsset(Path);
+        LoadedAssets.Add(Path, Asset);
+        return Asset;
+    };
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 Skipped = 0;
+    FBox Bounds(ForceInit);
+
+    for (int32 Index = 0; Index < Items->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject> Item = (*Items)[Index]->AsObject();
+        FString MeshPath;
+        if (!Item.IsValid() || !Item->TryGetStringField(TEXT("mesh"), MeshPath))
+        {
+            ++Skipped;
+            if (Errors.Num() < 20)
+            {
+                Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Item %d: missing 'mesh'"), Index)));
+            }
+            continue;
+        }
+
+        UStaticMesh* Mesh = Cast<UStaticMesh>(LoadCached(MeshPath));
+        if (!Mesh)
+        {
+            ++Skipped;
+            if (Errors.Num() < 20)
+            {
+                Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Item %d: static mesh not found: %s"), Index, *MeshPath)));
+            }
+            continue;
+        }
+
+        // "materials" sets slots in order, "material" overrides every slot
+        TArray<UMaterialInterface*> SlotMaterials;
+        SlotMaterials.SetNumZeroed(Mesh->GetStaticMaterials().Num());
+        const TArray<TSharedPtr<FJsonValue>>* MaterialPaths = nullptr;
+        FString MaterialPath;
+        if (Item->TryGetArrayField(TEXT("materials"), MaterialPaths))
+        {
+            for (int32 Slot = 0; Slot < FMath::Min(MaterialPaths->Num(), SlotMaterials.Num()); ++Slot)
+            {
+                const FString SlotPath = (*MaterialPaths)[Slot]->AsString();
+                if (!SlotPath.IsEmpty())
+                {
+                    SlotMaterials[Slot] = Cast<UMaterialInterface>(LoadCached(SlotPath));
+                }
+            }
+        }
+        else if (Item->TryGetStringField(TEXT("material"), MaterialPath) && !MaterialPath.IsEmpty())
+        {
+            UMaterialInterface* Material = Cast<UMaterialInterface>(LoadCached(MaterialPath));
+            for (UMaterialInterface*& SlotMaterial : SlotMaterials)
+            {
+                SlotMaterial = Material;
+            }
+        }
+
+        const FVector Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("location"));
+        const FRotator Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(Item, TEXT("rotation"));
+        const FVector Scale = Item->HasField(TEXT("scale"))
+            ? FEpicUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("scale")) : FVector::OneVector;
+
+        FGroup& Group = Groups.FindOrAdd(MCPInstancing::MakeGroupKey(Mesh, SlotMaterials));
+        Group.Mesh = Mesh;
+        Group.SlotMaterials = SlotMaterials;
+        Group.Transforms.Add(FTransform(Rotation.Quaternion(), Location, Scale));
+        FString Label;
+        Item->TryGetStringField(TEXT("label"), Label);
+        Group.Labels.Add(Label);
+        Bounds += Location;
+    }
+
+    if (Groups.Num() == 0)
+    {
+        TSharedPtr<FJsonObject> Result = FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No valid items to spawn"));
+        Result->SetArrayField(TEXT("errors"), Errors);
+        return Result;
+    }
+
+    // --- Create or reuse the container, one component per group ---
+    FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("MCP Spawn Instanced Batch (%s)"), *ActorName)));
+
+    if (!ContainerActor)
+    {
+        ContainerActor = MCPInstancing::SpawnContainer(World, ActorName, Bounds.GetCenter(), FolderPath);
+        if (!ContainerActor)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn container actor"));
+        }
+    }
+
+    TMap<FString, UInstancedStaticMeshComponent*> ExistingComponents;
+    if (bAppend)
+    {
+        TArray<UInstancedStaticMeshComponent*> Components;
+        ContainerActor->GetComponents(Components);
+        for (UInstancedStaticMeshComponent* Component : Components)
+        {
+            if (Component->GetStaticMesh() && Component->IsA<UHierarchicalInstancedStaticMeshComponent>() == bHierarchical)
+            {
+                ExistingComponents.Add(MCPInstancing::MakeGroupKey(Component), Component);
+            }
+        }
+    }
+
+    int32 InstanceCount = 0;
+    int32 ComponentsCreated = 0;
+    TArray<TSharedPtr<FJsonValue>> GroupArray;
+    for (const TPair<FString, FGroup>& Pair : Groups)
+    {
+        const FGroup& Group = Pair.Value;
+
+        UInstancedStaticMeshComponent* Component = ExistingComponents.FindRef(Pair.Key);
+        if (!Component)
+        {
+            Component = MCPInstancing::CreateComponent(ContainerActor, Group.Mesh, Group.SlotMaterials, bHierarchical);
+            ++ComponentsCreated;
+        }
+        MCPInstancing::AddInstances(Component, Group.Transforms, Group.Labels);
+        InstanceCount += Group.Transforms.Num();
+
+        TSharedPtr<FJsonObject> GroupJson = MakeShared<FJsonObject>();
+        GroupJson->SetStringField(TEXT("component"), Component->GetName());
+        GroupJson->SetStringField(TEXT("mesh"), Group.Mesh->GetPathName());
+        TArray<TSharedPtr<FJsonValue>> MaterialArray;
+        for (const UMaterialInterface* Material : Group.SlotMaterials)
+        {
+            MaterialArray.Add(MakeShared<FJsonValueString>(Material ? Material->GetPathName() : FString()));
+        }
+        GroupJson->SetArrayField(TEXT("materials"), MaterialArray);
+        GroupJson->SetNumberField(TEXT("instances_added"), Group.Transforms.Num());
+        GroupJson->SetNumberField(TEXT("instance_count"), Component->GetInstanceCount());
+        GroupArray.Add(MakeShared<FJsonValueObject>(GroupJson));
+    }
+
+    MCPInstancing::MarkContainerDirty(ContainerActor);
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Display, TEXT("spawn_instanced_batch: %d instance(s) in %d group(s) on '%s' in %.1f ms (%d skipped)"),
+        InstanceCount, Groups.Num(), *ContainerActor->GetName(), ElapsedMs, Skipped);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("actor_name"), ContainerActor->GetName());
+    Result->SetBoolField(TEXT("appended"), bAppend);
+    Result->SetStringField(TEXT("component_type"), ComponentType);
+    Result->SetNumberField(TEXT("instance_count"), InstanceCount);
+    Result->SetNumberField(TEXT("component_count"), Groups.Num());
+    Result->SetNumberField(TEXT("components_created"), ComponentsCreated);
+    Result->SetNumberField(TEXT("skipped"), Skipped);
+    Result->SetArrayField(TEXT("groups"), GroupArray);
+    Result->SetArrayField(TEXT("errors"), Errors);
+    Result->SetNumberField(TEXT("elapsed_ms"), ElapsedMs);
+    Result->SetStringField(TEXT("message"),
+        FString::Printf(TEXT("Spawned %d instances in %d %s component(s) on %s instead of %d actors"),
+            InstanceCount, Groups.Num(), *ComponentType.ToUpper(), *ContainerActor->GetName(), InstanceCount));
+    return Result;
+}
+
+// ============================================================================
+// Instance consolidation: consolidate_to_instances
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Filters (at least one is required so a stray call cannot merge the whole level)
+    FString Pattern;
+    FString ClassName;
+    Params->TryGetStringField(TEXT("pattern"), Pattern);
+    Params->TryGetStringField(TEXT("class"), ClassName);
+
+    FBox Region(ForceInit);
+    if (Params->HasField(TEXT("region_min")) && Params->HasField(TEXT("region_max")))
+    {
+        Region = FBox(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("region_min")),
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("region_max")));
+    }
+    double Radius = 0.0;
+    Params->TryGetNumberField(TEXT("radius"), Radius);
+    const FVector Center = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("center"));
+
+    if (Pattern.IsEmpty() && ClassName.IsEmpty() && !Region.IsValid && Radius <= 0.0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            TEXT("Provide at least one filter: 'pattern', 'class', 'region_min'+'region_max' or 'center'+'radius'"));
+    }
+
+    FString ContainerName = TEXT("Consolidated_Instances");
+    Params->TryGetStringField(TEXT("name"), ContainerName);
+
+    FString ComponentType = TEXT("hism");
+    Params->TryGetStringField(TEXT("component_type"), ComponentType);
+    if (ComponentType != TEXT("hism") && ComponentType != TEXT("ism"))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown component_type '%s' (hism, ism)"), *ComponentType));
+    }
+    const bool bHierarchical = ComponentType == TEXT("hism");
+
+    double MinGroupSizeValue = 2.0;
+    Params->TryGetNumberField(TEXT("min_group_size"), MinGroupSizeValue);
+    const int32 MinGroupSize = FMath::Max(static_cast<int32>(MinGroupSizeValue), 1);
+
+    bool bDryRun = false;
+    Params->TryGetBoolField(TEXT("dry_run"), bDryRun);
+
+    FString FolderPath = TEXT("Instanced");
+    Params->TryGetStringField(TEXT("folder"), FolderPath);
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
+    }
+
+    if (AActor* Existing = FEpicUnrealMCPCommonUtils::FindActorByName(World, ContainerName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Actor with name '%s' already exists"), *Existing->GetName()));
+    }
+
+    // --- Collect candidates: exactly one static mesh component, no attachment hierarchy ---
+    struct FSource
+    {
+        AActor* Actor = nullptr;
+        FTransform Transform;
+    };
+    struct FGroup
+    {
+        UStaticMesh* Mesh = nullptr;
+        TArray<UMaterialInterface*> SlotMaterials;
+        FName CollisionProfile;
+        EComponentMobility::Type Mobility = EComponentMobility::Static;
+        TArray<FSource> Sources;
+    };
+    TMap<FString, FGroup> Groups;
+    int32 Matched = 0;
+    int32 Ineligible = 0;
+
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+    for (AActor* Actor : AllActors)
+    {
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+        if (!Pattern.IsEmpty() && !Actor->GetName().Contains(Pattern) && !Actor->GetActorLabel().Contains(Pattern))
+        {
+            continue;
+        }
+        // Without a class filter only plain StaticMeshActors are merged, never gameplay actors that happen to have one mesh
+        if (ClassName.IsEmpty() ? !Actor->IsA<AStaticMeshActor>() : Actor->GetClass()->GetName() != ClassName)
+        {
+            continue;
+        }
+        const FVector Location = Actor->GetActorLocation();
+        if (Region.IsValid && !Region.IsInsideOrOn(Location))
+        {
+            continue;
+        }
+        if (Radius > 0.0 && FVector::Dist(Location, Center) > Radius)
+        {
+            continue;
+        }
+        ++Matched;
+
+        TArray<UStaticMeshComponent*> MeshComponents;
+        Actor->GetComponents(MeshComponents);
+        TArray<AActor*> AttachedActors;
+        Actor->GetAttachedActors(AttachedActors);
+        if (MeshComponents.Num() != 1 || MeshComponents[0]->IsA<UInstancedStaticMeshComponent>() ||
+            !MeshComponents[0]->GetStaticMesh() || Actor->GetAttachParentActor() || AttachedActors.Num() > 0)
+        {
+            ++Ineligible;
+            continue;
+        }
+
+        UStaticMeshComponent* MeshComp = MeshComponents[0];
+        UStaticMesh* Mesh = MeshComp->GetStaticMesh();
+        TArray<UMaterialInterface*> SlotMaterials;
+        SlotMaterials.SetNumZeroed(Mesh->GetStaticMaterials().Num());
+        for (int32 Slot = 0; Slot < SlotMaterials.Num(); ++Slot)
+        {
+            SlotMaterials[Slot] = MeshComp->OverrideMaterials.IsValidIndex(Slot) ? MeshComp->OverrideMaterials[Slot].Get() : nullptr;
+        }
+
+        // Instances share their component's collision and mobility, so those split groups too
+        const FName CollisionProfile = MeshComp->GetCollisionProfileName();
+        const EComponentMobility::Type Mobility = MeshComp->Mobility;
+        const FString GroupKey = FString::Printf(TEXT("%s|%s|%d"),
+            *MCPInstancing::MakeGroupKey(Mesh, SlotMaterials), *CollisionProfile.ToString(), static_cast<int32>(Mobility));
+        FGroup& Group = Groups.FindOrAdd(GroupKey);
+        if (!Group.Mesh)
+        {
+            Group.Mesh = Mesh;
+            Group.SlotMaterials = SlotMaterials;
+            Group.CollisionProfile = CollisionProfile;
+            Group.Mobility = Mobility;
+        }
+        Group.Sources.Add({ Actor, MeshComp->GetComponentTransform() });
+    }
+
+    // Groups below the threshold are left as actors
+    int32 DrawCallsBefore = 0;
+    int32 DrawCallsAfter = 0;
+    int32 ActorsReplaced = 0;
+    int32 SmallGroupActors = 0;
+    FBox Bounds(ForceInit);
+    for (auto It = Groups.CreateIterator(); It; ++It)
+    {
+        FGroup& Group = It->Value;
+        if (Group.Sources.Num() < MinGroupSize)
+        {
+            SmallGroupActors += Group.Sources.Num();
+            It.RemoveCurrent();
+            continue;
+        }
+        // Rough estimate: one draw per material section per actor, one per section per instanced component
+        const int32 Sections = FMath::Max(Group.SlotMaterials.Num(), 1);
+        DrawCallsBefore += Sections * Group.Sources.Num();
+        DrawCallsAfter += Sections;
+        ActorsReplaced += Group.Sources.Num();
+        for (const FSource& Source : Group.Sources)
+        {
+            Bounds += Source.Transform.GetLocation();
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("dry_run"), bDryRun);
+    Result->SetNumberField(TEXT("actors_matched"), Matched);
+    Result->SetNumberField(TEXT("actors_ineligible"), Ineligible);
+    Result->SetNumberField(TEXT("actors_in_small_groups"), SmallGroupActors);
+    Result->SetNumberField(TEXT("actors_replaced"), ActorsReplaced);
+    Result->SetNumberField(TEXT("actor_count_reduction"), ActorsReplaced > 0 ? ActorsReplaced - 1 : 0);
+    Result->SetNumberField(TEXT("draw_calls_before_estimate"), DrawCallsBefore);
+    Result->SetNumberField(TEXT("draw_calls_after_estimate"), DrawCallsAfter);
+    Result->SetNumberField(TEXT("component_count"), Groups.Num());
+
+    if (Groups.Num() == 0 || bDryRun)
+    {
+        TArray<TSharedPtr<FJsonValue>> GroupArray;
+        for (const TPair<FString, FGroup>& Pair : Groups)
+        {
+            TSharedPtr<FJsonObject> GroupJson = MakeShared<FJsonObject>();
+            GroupJson->SetStringField(TEXT("mesh"), Pair.Value.Mesh->GetPathName());
+            GroupJson->SetStringField(TEXT("collision_profile"), Pair.Value.CollisionProfile.ToString());
+            GroupJson->SetNumberField(TEXT("actor_count"), Pair.Value.Sources.Num());
+            GroupArray.Add(MakeShared<FJsonValueObject>(GroupJson));
+        }
+        Result->SetArrayField(TEXT("groups"), GroupArray);
+        Result->SetStringField(TEXT("message"), Groups.Num() == 0
+            ? FString::Printf(TEXT("Nothing to consolidate (%d matched, %d ineligible, %d in groups below %d)"),
+                Matched, Ineligible, SmallGroupActors, MinGroupSize)
+            : FString::Printf(TEXT("Dry run: would replace %d actors with %d %s component(s)"),
+                ActorsReplaced, Groups.Num(), *ComponentType.ToUpper()));
+        return Result;
+    }
+
+    // --- Replace: one transaction covers the container, the instances and the deleted actors ---
+    FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("MCP Consolidate To Instances (%s)"), *ContainerName)));
+
+    AActor* ContainerActor = MCPInstancing::SpawnContainer(World, ContainerName, Bounds.GetCenter(), FolderPath);
+    if (!ContainerActor)
+    {
+        Transaction.Cancel();
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn container actor"));
+    }
+
+    UEditorActorSubsystem* EditorActorSubsystem = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
+    TArray<TSharedPtr<FJsonValue>> GroupArray;
+    int32 FailedDeletes = 0;
+    for (const TPair<FString, FGroup>& Pair : Groups)
+    {
+        const FGroup& Group = Pair.Value;
+
+        TArray<FTransform> Transforms;
+        TArray<FString> Labels;
+        TArray<FString> SourceActors;
+        for (const FSource& Source : Group.Sources)
+        {
+            Transforms.Add(Source.Transform);
+            Labels.Add(Source.Actor->GetActorLabel());
+            SourceActors.Add(Source.Actor->GetName());
+        }
+
+        UInstancedStaticMeshComponent* Component = MCPInstancing::CreateComponent(
+            ContainerActor, Group.Mesh, Group.SlotMaterials, bHierarchical, Group.Mobility);
+        Component->SetCollisionProfileName(Group.CollisionProfile);
+        MCPInstancing::AddInstances(Component, Transforms, Labels, SourceActors);
+
+        for (const FSource& Source : Group.Sources)
+        {
+            const bool bDestroyed = EditorActorSubsystem
+                ? EditorActorSubsystem->DestroyActor(Source.Actor)
+                : World->DestroyActor(Source.Actor);
+            if (!bDestroyed)
+            {
+                ++FailedDeletes;
+            }
+        }
+
+        TSharedPtr<FJsonObject> GroupJson = MakeShared<FJsonObject>();
+        GroupJson->SetStringField(TEXT("component"), Component->GetName());
+        GroupJson->SetStringField(TEXT("mesh"), Group.Mesh->GetPathName());
+        GroupJson->SetStringField(TEXT("collision_profile"), Group.CollisionProfile.ToString());
+        GroupJson->SetNumberField(TEXT("instance_count"), Transforms.Num());
+        GroupArray.Add(MakeShared<FJsonValueObject>(GroupJson));
+    }
+
+    MCPInstancing::MarkContainerDirty(ContainerActor);
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    UE_LOG(LogTemp, Display, TEXT("consolidate_to_instances: Replaced %d actors with %d component(s) on '%s' in %.1f ms"),
+        ActorsReplaced, Groups.Num(), *ContainerActor->GetName(), ElapsedMs);
+
+    Result->SetStringField(TEXT("actor_name"), ContainerActor->GetName());
+    Result->SetStringField(TEXT("component_type"), ComponentType);
+    Result->SetArrayField(TEXT("groups"), GroupArray);
+    Result->SetNumberField(TEXT("failed_deletes"), FailedDeletes);
+    Result->SetNumberField(TEXT("elapsed_ms"), ElapsedMs);
+    Result->SetStringField(TEXT("message"),
+        FString::Printf(TEXT("Replaced %d actors with %d %s component(s) on %s (~%d -> ~%d draw calls); undo restores them"),
+            ActorsReplaced, Groups.Num(), *ComponentType.ToUpper(), *ContainerActor->GetName(), DrawCallsBefore, DrawCallsAfter));
+    return Result;
+}
+
+// ============================================================================
+// Shared-memory bulk channel
+// ============================================================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleScatterFoliageFromBulk(const TSharedPtr<FJsonObject>& Params,
+    const TSharedPtr<FJsonObject>& Descriptor)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+
+    // The segment is consumed whether or not the scatter succeeds; a failed call must not leave it behind
+    bool bRelease = true;
+    Params->TryGetBoolField(TEXT("release_bulk"), bRelease);
+    FString Handle;
+    Descriptor->TryGetStringField(TEXT("handle"), Handle);
+    ON_SCOPE_EXIT
+    {
+        if (bRelease && !Handle.IsEmpty())
+        {
+            FMCPBulkChannel::Release(Handle);
+        }
+    };
+
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world"));
+    }
+
+    FString MeshPath;
+    if (!Params->TryGetStringField(TEXT("mesh_path"), MeshPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing required 'mesh_path' parameter"));
+    }
+    UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+    if (!Mesh)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Static mesh not found: %s"), *MeshPath));
+    }
+
+    // 9 values per instance: location xyz, rotation pitch/yaw/roll, scale xyz (world space)
+    TArray<float> Values;
+    FString Error;
+    if (!FMCPBulkChannel::ReadFloats(Descriptor, Values, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    if (Values.Num() == 0 || Values.Num() % 9 != 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("transforms_bulk must hold 9 floats per instance (x, y, z, pitch, yaw, roll, sx, sy, sz); got %d values"), Values.Num()));
+    }
+
+    const int32 InstanceCount = Values.Num() / 9;
+    TArray<FTransform> Transforms;
+    Transforms.Reserve(InstanceCount);
+    FBox Bounds(ForceInit);
+    for (int32 i = 0; i < InstanceCount; ++i)
+    {
+        const float* V = Values.GetData() + i * 9;
+        const FVector Location(V[0], V[1], V[2]);
+        Transforms.Emplace(FRotator(V[3], V[4], V[5]).Quaternion(), Location, FVector(V[6], V[7], V[8]));
+        Bounds += Location;
+    }
+
+    // Same per-slot / single material override rules as the sampled path
+    TArray<UMaterialInterface*> SlotMaterials;
+    SlotMaterials.SetNumZeroed(Mesh->GetStaticMaterials().Num());
+    const TArray<TSharedPtr<FJsonValue>>* MaterialsArray = nullptr;
+    FString MaterialPath;
+    if (Params->TryGetArrayField(TEXT("materials"), MaterialsArray))
+    {
+        for (int32 Slot = 0; Slot < FMath::Min(MaterialsArray->Num(), SlotMaterials.Num()); ++Slot)
+        {
+            const FString SlotPath = (*MaterialsArray)[Slot]->AsString();
+            SlotMaterials[Slot] = SlotPath.IsEmpty() ? nullptr : Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(SlotPath));
+        }
+    }
+    else if (Params->TryGetStringField(TEXT("material_path"), MaterialPath) && !MaterialPath.IsEmpty())
+    {
+        UMaterialInterface* MatOverride = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+        for (UMaterialInterface*& SlotMaterial : SlotMaterials)
+        {
+            SlotMaterial = MatOverride;
+        }
+    }
+
+    FString ActorName = TEXT("HISM_Foliage");
+    Params->TryGetStringField(TEXT("actor_name"), ActorName);
+
+    const FVector Center = Bounds.GetCenter();
+    AActor* ContainerActor = MCPInstancing::SpawnContainer(World, ActorName, FVector(Center.X, Center.Y, 0.0), TEXT("Foliage"));
+    if (!ContainerActor)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn container actor"));
+    }
+
+    UInstancedStaticMeshComponent* Component = MCPInstancing::CreateComponent(ContainerActor, Mesh, SlotMaterials, true);
+    double CullDistance = 0.0;
+    if (Params->TryGetNumberField(TEXT("cull_distance"), CullDistance) && CullDistance > 0.0)
+    {
+        Component->SetCullDistances(0, static_cast<int32>(CullDistance));
+    }
+    MCPInstancing::AddInstances(Component, Transforms);
+    MCPInstancing::MarkContainerDirty(ContainerActor);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("actor_name"), ContainerActor->GetName());
+    Result->SetStringField(TEXT("mesh"), MeshPath);
+    Result->SetNumberField(TEXT("instance_count"), InstanceCount);
+    Result->SetStringField(TEXT("source"), TEXT("bulk"));
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Result->SetStringField(TEXT("message"),
+        FString::Printf(TEXT("Placed %d instances of %s via HISM from bulk segment"), InstanceCount, *Mesh->GetName()));
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetBulkChannelInfo(const TSharedPtr<FJsonObject>& Params)
+{
+    int64 TotalBytes = 0;
+    TArray<TSharedPtr<FJsonValue>> Segments = FMCPBulkChannel::ListSegments(TotalBytes);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("directory"), FMCPBulkChannel::GetDirectory());
+    Result->SetStringField(TEXT("layout"), TEXT("headerless little-endian arrays, one file per handle: <directory>/<handle>.bin"));
+    Result->SetArrayField(TEXT("segments"), Segments);
+    Result->SetNumberField(TEXT("total_bytes"), static_cast<double>(TotalBytes));
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleReleaseBulk(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    bool bAll = false;
+    Params->TryGetBoolField(TEXT("all"), bAll);
+    if (bAll)
+    {
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetNumberField(TEXT("released"), FMCPBulkChannel::ReleaseAll());
+        return Result;
+    }
+
+    FString Handle;
+    if (!Params->TryGetStringField(TEXT("handle"), Handle))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'handle' parameter (or pass all=true)"));
+    }
+    if (!FMCPBulkChannel::Release(Handle))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No bulk segment '%s'"), *Handle));
+    }
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetNumberField(TEXT("released"), 1);
     return Result;
 }
@@ -1,5 +1,7 @@
 #include "Commands/EpicUnrealMCPGameplayCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Subsystems/EditorActorSubsystem.h"
@@ -205,7 +207,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleSetGameModeDefault
 		}
 	}
 
-	// Compile the GameMode BP first so the CDO is available
+	// Compile the GameMode BP first so the CDO is available (needed now, so never deferred)
 	FKismetEditorUtilities::CompileBlueprint(GameModeBP);
 
 	// Get the CDO and set DefaultPawnClass
@@ -225,15 +227,12 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleSetGameModeDefault
 	UE_LOG(LogTemp, Log, TEXT("Set DefaultPawnClass to '%s' on GameMode '%s'"),
 		*CharacterClass->GetName(), *GameModeClass->GetName());
 
-	// Recompile after CDO modification
-	FKismetEditorUtilities::CompileBlueprint(GameModeBP);
+	// Recompile after CDO modification (deferred to Commit if a session holds the GameMode open)
+	FBPEditSession::CompileOrDefer(GameModeBP);
 	GameModePackage->MarkPackageDirty();
 
 	// Save the GameMode package
-	FString PackageFilename = FPackageName::LongPackageNameToFilename(GameModePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(GameModePackage, GameModeBP, *PackageFilename, SaveArgs);
+	FEpicUnrealMCPPackageSaver::SavePackage(GameModePackage, GameModeBP);
 
 	// Optional: create_player_start (default true)
 	bool bCreatePlayerStart = true;
@@ -416,10 +415,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleCreateAnimMontage(
 	FAssetRegistryModule::AssetCreated(Montage);
 	Package->MarkPackageDirty();
 
-	FString PackageFilename = FPackageName::LongPackageNameToFilename(FullMontageAssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Montage, *PackageFilename, SaveArgs);
+	FEpicUnrealMCPPackageSaver::SavePackage(Package, Montage);
 
 	UE_LOG(LogTemp, Log, TEXT("Created AnimMontage '%s' at '%s' (duration: %.2f, slot: %s)"),
 		*MontageName, *FullMontageAssetPath, SequenceLength, *SlotName);
@@ -1176,8 +1172,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleSetSkeletalAnimati
 	if (OwnerBP)
 	{
 		OwnerBP->GetPackage()->MarkPackageDirty();
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(OwnerBP);
-		FKismetEditorUtilities::CompileBlueprint(OwnerBP);
+		FBPEditSession::MarkStructurallyModifiedOrDefer(OwnerBP);
+		FBPEditSession::CompileOrDefer(OwnerBP);
 	}
 
 	// Build result
@@ -1262,11 +1258,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleCreateNiagaraSyste
 	// Mark package dirty and save
 	Package->MarkPackageDirty();
 
-	FString PackageFilename = FPackageName::LongPackageNameToFilename(
-		FullAssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NewSystem, *PackageFilename, SaveArgs);
+	FEpicUnrealMCPPackageSaver::SavePackage(Package, NewSystem);
 
 	UE_LOG(LogTemp, Log, TEXT("Created NiagaraSystem '%s' at '%s' from template '%s'"),
 		*SystemName, *FullAssetPath, *TemplatePath);
@@ -1642,11 +1634,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPGameplayCommands::HandleCreateAtmosphericF
 	// Mark package dirty and save
 	Package->MarkPackageDirty();
 
-	FString PackageFilename = FPackageName::LongPackageNameToFilename(
-		FullAssetPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NewSystem, *PackageFilename, SaveArgs);
+	FEpicUnrealMCPPackageSaver::SavePackage(Package, NewSystem);
 
 	UE_LOG(LogTemp, Log, TEXT("Created atmospheric FX system '%s' at '%s' with preset '%s'"),
 		*SystemName, *FullAssetPath, *Preset);
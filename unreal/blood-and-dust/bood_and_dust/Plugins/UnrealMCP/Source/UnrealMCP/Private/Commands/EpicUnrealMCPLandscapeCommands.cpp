@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPLandscapeCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
 #include "Editor.h"
 #include "Landscape.h"
 #include "LandscapeProxy.h"
@@ -933,9 +934,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPLandscapeCommands::HandleCreateLandscapeLa
         PlatformFile.CreateDirectoryTree(*PackageDirectory);
     }
 
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Standalone;
-    bool bSaved = UPackage::SavePackage(Package, LayerInfo, *PackageFilename, SaveArgs);
+    bool bSaved = FEpicUnrealMCPPackageSaver::SavePackage(Package, LayerInfo, RF_Standalone);
     if (!bSaved)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to save layer info asset: %s"), *PackageFilename));
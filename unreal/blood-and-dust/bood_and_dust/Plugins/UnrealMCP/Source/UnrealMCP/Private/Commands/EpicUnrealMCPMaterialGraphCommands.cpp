@@ -3,6 +3,8 @@
 
 #include "Commands/EpicUnrealMCPMaterialGraphCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "MCPResponseWriter.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Factories/MaterialFactoryNew.h"
@@ -53,10 +55,25 @@
 #include "Materials/MaterialExpressionTwoSidedSign.h"
 #include "Materials/MaterialExpressionPerInstanceRandom.h"
 #include "UObject/SavePackage.h"
+#include "Serialization/ObjectWriter.h"
+#include "ShaderCompiler.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 
 FEpicUnrealMCPMaterialGraphCommands::FEpicUnrealMCPMaterialGraphCommands()
     : ExpressionCounter(0)
 {
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+        this, &FEpicUnrealMCPMaterialGraphCommands::OnObjectPropertyChanged);
+}
+
+FEpicUnrealMCPMaterialGraphCommands::~FEpicUnrealMCPMaterialGraphCommands()
+{
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    if (SessionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SessionTickerHandle);
+    }
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
@@ -67,7 +84,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCommand(const
     }
     else if (CommandType == TEXT("get_material_graph"))
     {
-        return HandleGetMaterialGraph(Params);
+        return FEpicUnrealMCPCommonUtils::StreamToJsonObject([this, &Params](FMCPResponseWriter& Writer, FString& OutError)
+        {
+            return StreamGetMaterialGraph(Params, Writer, OutError);
+        });
+    }
+    else if (CommandType == TEXT("build_material_graph"))
+    {
+        return HandleBuildMaterialGraph(Params);
     }
     else if (CommandType == TEXT("add_material_expression"))
     {
@@ -97,6 +121,14 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCommand(const
     {
         return HandleConfigureLandscapeLayerBlend(Params);
     }
+    else if (CommandType == TEXT("begin_material_edit"))
+    {
+        return HandleBeginMaterialEdit(Params);
+    }
+    else if (CommandType == TEXT("commit_material_edit"))
+    {
+        return HandleCommitMaterialEdit(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown material graph command: %s"), *CommandType));
 }
@@ -113,190 +145,387 @@ UMaterial* FEpicUnrealMCPMaterialGraphCommands::LoadMaterial(const FString& Mate
 
 UMaterialExpression* FEpicUnrealMCPMaterialGraphCommands::FindExpressionById(UMaterial* Material, const FString& ExpressionId)
 {
-    if (!Material) return nullptr;
+    if (!Material || ExpressionId.IsEmpty()) return nullptr;
 
-    for (UMaterialExpression* Expr : Material->GetExpressions())
+    FExpressionIndex& Index = ExpressionIndices.FindOrAdd(Material);
+
+    auto Rebuild = [Material, &Index]()
+    {
+        Index.ById.Reset();
+        for (UMaterialExpression* Expr : Material->GetExpressions())
+        {
+            if (!Expr) continue;
+            // Names and GUIDs are unique; a Desc tag never shadows them
+            Index.ById.Add(Expr->GetName(), Expr);
+            if (Expr->MaterialExpressionGuid.IsValid())
+            {
+                Index.ById.Add(GetExpressionGuid(Expr), Expr);
+            }
+        }
+        for (UMaterialExpression* Expr : Material->GetExpressions())
+        {
+            if (Expr && !Expr->Desc.IsEmpty())
+            {
+                Index.ById.FindOrAdd(Expr->Desc, Expr);
+            }
+        }
+        Index.ExpressionCount = Material->GetExpressions().Num();
+        Index.bStale = false;
+    };
+
+    auto Lookup = [Material, &Index, &ExpressionId]() -> UMaterialExpression*
     {
-        if (Expr && Expr->GetName() == ExpressionId)
+        if (const TWeakObjectPtr<UMaterialExpression>* Found = Index.ById.Find(ExpressionId))
         {
-            return Expr;
+            UMaterialExpression* Expr = Found->Get();
+            if (Expr && Expr->GetOuter() == Material)
+            {
+                return Expr;
+            }
         }
+        return nullptr;
+    };
+
+    if (Index.bStale || Index.ExpressionCount != Material->GetExpressions().Num())
+    {
+        Rebuild();
+        return Lookup();
     }
 
-    // Also check by description field (fallback)
-    for (UMaterialExpression* Expr : Material->GetExpressions())
+    if (UMaterialExpression* Expr = Lookup())
     {
-        if (Expr && Expr->Desc.Contains(ExpressionId))
+        return Expr;
+    }
+
+    // Miss on a fresh index: the graph may have changed without a notification, rebuild once
+    Rebuild();
+    return Lookup();
+}
+
+void FEpicUnrealMCPMaterialGraphCommands::NoteExpressionAdded(UMaterial* Material, UMaterialExpression* Expression)
+{
+    FExpressionIndex* Index = ExpressionIndices.Find(Material);
+    if (!Index || Index->bStale || !Expression) return;
+
+    Index->ById.Add(Expression->GetName(), Expression);
+    if (Expression->MaterialExpressionGuid.IsValid())
+    {
+        Index->ById.Add(GetExpressionGuid(Expression), Expression);
+    }
+    if (!Expression->Desc.IsEmpty())
+    {
+        Index->ById.FindOrAdd(Expression->Desc, Expression);
+    }
+    Index->ExpressionCount++;
+}
+
+void FEpicUnrealMCPMaterialGraphCommands::NoteExpressionRemoved(UMaterial* Material, UMaterialExpression* Expression)
+{
+    FExpressionIndex* Index = ExpressionIndices.Find(Material);
+    if (!Index || Index->bStale || !Expression) return;
+
+    for (auto It = Index->ById.CreateIterator(); It; ++It)
+    {
+        if (It.Value() == Expression)
         {
-            return Expr;
+            It.RemoveCurrent();
         }
     }
+    Index->ExpressionCount--;
+}
 
-    return nullptr;
+FString FEpicUnrealMCPMaterialGraphCommands::GetExpressionGuid(const UMaterialExpression* Expression)
+{
+    return Expression->MaterialExpressionGuid.IsValid()
+        ? Expression->MaterialExpressionGuid.ToString(EGuidFormats::Digits)
+        : FString();
 }
 
-UMaterialExpression* FEpicUnrealMCPMaterialGraphCommands::CreateExpression(UMaterial* Material, const FString& ExpressionType, float PosX, float PosY)
+FString FEpicUnrealMCPMaterialGraphCommands::EnsureExpressionGuid(UMaterialExpression* Expression)
+{
+    if (!Expression->MaterialExpressionGuid.IsValid())
+    {
+        Expression->UpdateMaterialExpressionGuid(true, false);
+    }
+    return GetExpressionGuid(Expression);
+}
+
+void FEpicUnrealMCPMaterialGraphCommands::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    if (bApplyingOwnEdit || !Object || ExpressionIndices.Num() == 0) return;
+
+    UMaterial* Material = Cast<UMaterial>(Object);
+    if (!Material)
+    {
+        if (UMaterialExpression* Expr = Cast<UMaterialExpression>(Object))
+        {
+            Material = Cast<UMaterial>(Expr->GetOuter());
+        }
+    }
+
+    if (FExpressionIndex* Index = Material ? ExpressionIndices.Find(Material) : nullptr)
+    {
+        Index->bStale = true;
+    }
+}
+
+void FEpicUnrealMCPMaterialGraphCommands::BeginGraphEdit(UMaterial* Material)
+{
+    // An open session already issued PreEditChange once in begin_material_edit
+    if (!EditSessions.Contains(Material))
+    {
+        Material->PreEditChange(nullptr);
+    }
+}
+
+bool FEpicUnrealMCPMaterialGraphCommands::EndGraphEdit(UMaterial* Material)
+{
+    Material->MarkPackageDirty();
+
+    if (FMaterialEditSession* Session = EditSessions.Find(Material))
+    {
+        Session->EditCount++;
+        Session->LastEditTime = FPlatformTime::Seconds();
+        return true;
+    }
+
+    TGuardValue<bool> OwnEdit(bApplyingOwnEdit, true);
+    Material->PostEditChange();
+    return false;
+}
+
+void FEpicUnrealMCPMaterialGraphCommands::CommitSession(UMaterial* Material, bool bWaitForCompile, const TSharedPtr<FJsonObject>& ResultObj)
 {
-    UMaterialExpression* NewExpression = nullptr;
+    FMaterialEditSession Session;
+    EditSessions.RemoveAndCopyValue(Material, Session);
 
+    const double CompileStart = FPlatformTime::Seconds();
+    {
+        TGuardValue<bool> OwnEdit(bApplyingOwnEdit, true);
+        Material->PostEditChange();
+    }
+    Material->MarkPackageDirty();
+    const double PostEditMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+
+    if (bWaitForCompile && GShaderCompilingManager)
+    {
+        GShaderCompilingManager->FinishAllCompilation();
+    }
+    const double CompileMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+
+    if (ResultObj.IsValid())
+    {
+        ResultObj->SetNumberField(TEXT("edit_count"), Session.EditCount);
+        ResultObj->SetNumberField(TEXT("session_seconds"), Session.StartTime > 0.0 ? CompileStart - Session.StartTime : 0.0);
+        ResultObj->SetNumberField(TEXT("post_edit_ms"), PostEditMs);
+        ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+        ResultObj->SetBoolField(TEXT("compile_finished"), bWaitForCompile);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MaterialEdit: Committed %s (%d edits, compile %.1f ms)"),
+        *Material->GetPathName(), Session.EditCount, CompileMs);
+}
+
+bool FEpicUnrealMCPMaterialGraphCommands::TickEditSessions(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    TArray<TWeakObjectPtr<UMaterial>> Expired;
+    for (auto It = EditSessions.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+        else if (Now - It.Value().LastEditTime > It.Value().TimeoutSeconds)
+        {
+            Expired.Add(It.Key());
+        }
+    }
+
+    for (const TWeakObjectPtr<UMaterial>& Material : Expired)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MaterialEdit: Session on %s idle for %.0fs, auto-committing"),
+            *Material->GetPathName(), EditSessions[Material].TimeoutSeconds);
+        CommitSession(Material.Get(), false, nullptr);
+    }
+
+    if (EditSessions.Num() == 0)
+    {
+        SessionTickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+UClass* FEpicUnrealMCPMaterialGraphCommands::FindExpressionClass(const FString& ExpressionType)
+{
     // Constants
     if (ExpressionType == TEXT("Constant"))
     {
-        NewExpression = NewObject<UMaterialExpressionConstant>(Material);
+        return UMaterialExpressionConstant::StaticClass();
     }
     else if (ExpressionType == TEXT("Constant2Vector"))
     {
-        NewExpression = NewObject<UMaterialExpressionConstant2Vector>(Material);
+        return UMaterialExpressionConstant2Vector::StaticClass();
     }
     else if (ExpressionType == TEXT("Constant3Vector"))
     {
-        NewExpression = NewObject<UMaterialExpressionConstant3Vector>(Material);
+        return UMaterialExpressionConstant3Vector::StaticClass();
     }
     else if (ExpressionType == TEXT("Constant4Vector"))
     {
-        NewExpression = NewObject<UMaterialExpressionConstant4Vector>(Material);
+        return UMaterialExpressionConstant4Vector::StaticClass();
     }
     // Parameters
     else if (ExpressionType == TEXT("ScalarParameter"))
     {
-        NewExpression = NewObject<UMaterialExpressionScalarParameter>(Material);
+        return UMaterialExpressionScalarParameter::StaticClass();
     }
     else if (ExpressionType == TEXT("VectorParameter"))
     {
-        NewExpression = NewObject<UMaterialExpressionVectorParameter>(Material);
+        return UMaterialExpressionVectorParameter::StaticClass();
     }
     else if (ExpressionType == TEXT("TextureSampleParameter2D") || ExpressionType == TEXT("TextureParameter"))
     {
-        NewExpression = NewObject<UMaterialExpressionTextureSampleParameter2D>(Material);
+        return UMaterialExpressionTextureSampleParameter2D::StaticClass();
     }
     // Texture
     else if (ExpressionType == TEXT("TextureSample"))
     {
-        NewExpression = NewObject<UMaterialExpressionTextureSample>(Material);
+        return UMaterialExpressionTextureSample::StaticClass();
     }
     else if (ExpressionType == TEXT("TextureCoordinate") || ExpressionType == TEXT("TexCoord"))
     {
-        NewExpression = NewObject<UMaterialExpressionTextureCoordinate>(Material);
+        return UMaterialExpressionTextureCoordinate::StaticClass();
     }
     else if (ExpressionType == TEXT("Panner"))
     {
-        NewExpression = NewObject<UMaterialExpressionPanner>(Material);
+        return UMaterialExpressionPanner::StaticClass();
     }
     else if (ExpressionType == TEXT("Rotator"))
     {
-        NewExpression = NewObject<UMaterialExpressionRotator>(Material);
+        return UMaterialExpressionRotator::StaticClass();
     }
     // Landscape
     else if (ExpressionType == TEXT("LandscapeLayerBlend"))
     {
-        NewExpression = NewObject<UMaterialExpressionLandscapeLayerBlend>(Material);
+        return UMaterialExpressionLandscapeLayerBlend::StaticClass();
     }
     else if (ExpressionType == TEXT("LandscapeLayerCoords") || ExpressionType == TEXT("LandscapeCoords"))
     {
-        NewExpression = NewObject<UMaterialExpressionLandscapeLayerCoords>(Material);
+        return UMaterialExpressionLandscapeLayerCoords::StaticClass();
     }
     // Normal vectors
     else if (ExpressionType == TEXT("VertexNormalWS"))
     {
-        NewExpression = NewObject<UMaterialExpressionVertexNormalWS>(Material);
+        return UMaterialExpressionVertexNormalWS::StaticClass();
     }
     else if (ExpressionType == TEXT("PixelNormalWS"))
     {
-        NewExpression = NewObject<UMaterialExpressionPixelNormalWS>(Material);
+        return UMaterialExpressionPixelNormalWS::StaticClass();
     }
     // Additional math
     else if (ExpressionType == TEXT("DotProduct") || ExpressionType == TEXT("Dot"))
     {
-        NewExpression = NewObject<UMaterialExpressionDotProduct>(Material);
+        return UMaterialExpressionDotProduct::StaticClass();
     }
     else if (ExpressionType == TEXT("Saturate"))
     {
-        NewExpression = NewObject<UMaterialExpressionSaturate>(Material);
+        return UMaterialExpressionSaturate::StaticClass();
     }
     // Math
     else if (ExpressionType == TEXT("Add"))
     {
-        NewExpression = NewObject<UMaterialExpressionAdd>(Material);
+        return UMaterialExpressionAdd::StaticClass();
     }
     else if (ExpressionType == TEXT("Subtract"))
     {
-        NewExpression = NewObject<UMaterialExpressionSubtract>(Material);
+        return UMaterialExpressionSubtract::StaticClass();
     }
     else if (ExpressionType == TEXT("Multiply"))
     {
-        NewExpression = NewObject<UMaterialExpressionMultiply>(Material);
+        return UMaterialExpressionMultiply::StaticClass();
     }
     else if (ExpressionType == TEXT("Divide"))
     {
-        NewExpression = NewObject<UMaterialExpressionDivide>(Material);
+        return UMaterialExpressionDivide::StaticClass();
     }
     else if (ExpressionType == TEXT("Power"))
     {
-        NewExpression = NewObject<UMaterialExpressionPower>(Material);
+        return UMaterialExpressionPower::StaticClass();
     }
     else if (ExpressionType == TEXT("Abs"))
     {
-        NewExpression = NewObject<UMaterialExpressionAbs>(Material);
+        return UMaterialExpressionAbs::StaticClass();
     }
     else if (ExpressionType == TEXT("Clamp"))
     {
-        NewExpression = NewObject<UMaterialExpressionClamp>(Material);
+        return UMaterialExpressionClamp::StaticClass();
     }
     else if (ExpressionType == TEXT("OneMinus"))
     {
-        NewExpression = NewObject<UMaterialExpressionOneMinus>(Material);
+        return UMaterialExpressionOneMinus::StaticClass();
     }
     else if (ExpressionType == TEXT("LinearInterpolate") || ExpressionType == TEXT("Lerp"))
     {
-        NewExpression = NewObject<UMaterialExpressionLinearInterpolate>(Material);
+        return UMaterialExpressionLinearInterpolate::StaticClass();
     }
     // Trigonometry
     else if (ExpressionType == TEXT("Sine"))
     {
-        NewExpression = NewObject<UMaterialExpressionSine>(Material);
+        return UMaterialExpressionSine::StaticClass();
     }
     else if (ExpressionType == TEXT("Cosine"))
     {
-        NewExpression = NewObject<UMaterialExpressionCosine>(Material);
+        return UMaterialExpressionCosine::StaticClass();
     }
     // Utility
     else if (ExpressionType == TEXT("WorldPosition"))
     {
-        NewExpression = NewObject<UMaterialExpressionWorldPosition>(Material);
+        return UMaterialExpressionWorldPosition::StaticClass();
     }
     else if (ExpressionType == TEXT("ObjectPosition"))
     {
-        NewExpression = NewObject<UMaterialExpressionObjectPositionWS>(Material);
+        return UMaterialExpressionObjectPositionWS::StaticClass();
     }
     else if (ExpressionType == TEXT("VertexColor"))
     {
-        NewExpression = NewObject<UMaterialExpressionVertexColor>(Material);
+        return UMaterialExpressionVertexColor::StaticClass();
     }
     else if (ExpressionType == TEXT("Time"))
     {
-        NewExpression = NewObject<UMaterialExpressionTime>(Material);
+        return UMaterialExpressionTime::StaticClass();
     }
     else if (ExpressionType == TEXT("ComponentMask"))
     {
-        NewExpression = NewObject<UMaterialExpressionComponentMask>(Material);
+        return UMaterialExpressionComponentMask::StaticClass();
     }
     else if (ExpressionType == TEXT("AppendVector") || ExpressionType == TEXT("Append"))
     {
-        NewExpression = NewObject<UMaterialExpressionAppendVector>(Material);
+        return UMaterialExpressionAppendVector::StaticClass();
     }
     else if (ExpressionType == TEXT("TwoSidedSign"))
     {
-        NewExpression = NewObject<UMaterialExpressionTwoSidedSign>(Material);
+        return UMaterialExpressionTwoSidedSign::StaticClass();
     }
     else if (ExpressionType == TEXT("Noise"))
     {
-        NewExpression = NewObject<UMaterialExpressionNoise>(Material);
+        return UMaterialExpressionNoise::StaticClass();
     }
     else if (ExpressionType == TEXT("PerInstanceRandom"))
     {
-        NewExpression = NewObject<UMaterialExpressionPerInstanceRandom>(Material);
+        return UMaterialExpressionPerInstanceRandom::StaticClass();
     }
 
+    return nullptr;
+}
+
+UMaterialExpression* FEpicUnrealMCPMaterialGraphCommands::CreateExpression(UMaterial* Material, const FString& ExpressionType, float PosX, float PosY)
+{
+    UClass* ExpressionClass = FindExpressionClass(ExpressionType);
+    UMaterialExpression* NewExpression = ExpressionClass ? NewObject<UMaterialExpression>(Material, ExpressionClass) : nullptr;
+
     if (NewExpression)
     {
         NewExpression->MaterialExpressionEditorX = PosX;
@@ -470,13 +699,113 @@ FExpressionInput* FEpicUnrealMCPMaterialGraphCommands::GetExpressionInput(UMater
         }
     }
 
+    // Fallback: the expression's own input names, as reported by get_material_graph
+    for (int32 i = 0; FExpressionInput* Input = Expression->GetInput(i); i++)
+    {
+        if (Expression->GetInputName(i).ToString().Equals(InputName, ESearchCase::IgnoreCase))
+        {
+            return Input;
+        }
+    }
+
     return nullptr;
 }
 
+// Output property names accepted by connect_to_material_output / build_material_graph, in get_material_graph order
+static const TCHAR* const MaterialOutputNames[] = {
+    TEXT("BaseColor"), TEXT("Metallic"), TEXT("Specular"), TEXT("Roughness"), TEXT("Anisotropy"),
+    TEXT("EmissiveColor"), TEXT("Opacity"), TEXT("OpacityMask"), TEXT("Normal"), TEXT("Tangent"),
+    TEXT("WorldPositionOffset"), TEXT("SubsurfaceColor"), TEXT("AmbientOcclusion")
+};
+
+FExpressionInput* FEpicUnrealMCPMaterialGraphCommands::GetMaterialOutputInput(UMaterial* Material, const FString& MaterialProperty)
+{
+    UMaterialEditorOnlyData* EditorData = Material ? Material->GetEditorOnlyData() : nullptr;
+    if (!EditorData) return nullptr;
+
+    FString PropLower = MaterialProperty.ToLower();
+
+    if (PropLower == TEXT("basecolor") || PropLower == TEXT("base_color")) return &EditorData->BaseColor;
+    if (PropLower == TEXT("metallic")) return &EditorData->Metallic;
+    if (PropLower == TEXT("specular")) return &EditorData->Specular;
+    if (PropLower == TEXT("roughness")) return &EditorData->Roughness;
+    if (PropLower == TEXT("anisotropy")) return &EditorData->Anisotropy;
+    if (PropLower == TEXT("emissivecolor") || PropLower == TEXT("emissive_color") || PropLower == TEXT("emissive")) return &EditorData->EmissiveColor;
+    if (PropLower == TEXT("opacity")) return &EditorData->Opacity;
+    if (PropLower == TEXT("opacitymask") || PropLower == TEXT("opacity_mask")) return &EditorData->OpacityMask;
+    if (PropLower == TEXT("normal")) return &EditorData->Normal;
+    if (PropLower == TEXT("tangent")) return &EditorData->Tangent;
+    if (PropLower == TEXT("worldpositionoffset") || PropLower == TEXT("world_position_offset")) return &EditorData->WorldPositionOffset;
+    if (PropLower == TEXT("subsurfacecolor") || PropLower == TEXT("subsurface_color")) return &EditorData->SubsurfaceColor;
+    if (PropLower == TEXT("ambientocclusion") || PropLower == TEXT("ambient_occlusion") || PropLower == TEXT("ao")) return &EditorData->AmbientOcclusion;
+
+    return nullptr;
+}
+
+int32 FEpicUnrealMCPMaterialGraphCommands::RedirectExpressionLinks(UMaterial* Material, UMaterialExpression* From, UMaterialExpression* To)
+{
+    int32 NumLinks = 0;
+    auto Redirect = [From, To, &NumLinks](FExpressionInput* Input)
+    {
+        if (!Input || Input->Expression != From) return;
+        if (To && Input->OutputIndex < To->GetOutputs().Num())
+        {
+            Input->Expression = To;
+        }
+        else
+        {
+            Input->Expression = nullptr;
+            Input->OutputIndex = 0;
+        }
+        NumLinks++;
+    };
+
+    for (UMaterialExpression* Expr : Material->GetExpressions())
+    {
+        if (!Expr || Expr == From) continue;
+        for (int32 i = 0; FExpressionInput* Input = Expr->GetInput(i); i++)
+        {
+            Redirect(Input);
+        }
+    }
+    for (const TCHAR* OutputName : MaterialOutputNames)
+    {
+        Redirect(GetMaterialOutputInput(Material, OutputName));
+    }
+    return NumLinks;
+}
+
+uint32 FEpicUnrealMCPMaterialGraphCommands::HashExpressionState(UMaterialExpression* Expression)
+{
+    // Serialized properties cover position, parameters and input links, however they were edited
+    TArray<uint8> Bytes;
+    FObjectWriter StateWriter(Expression, Bytes);
+    return FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+}
+
+bool FEpicUnrealMCPMaterialGraphCommands::ExpressionMatchesType(UMaterialExpression* Expression, const FString& ExpressionType) const
+{
+    if (!Expression) return false;
+
+    // CreateExpression aliases -> class name suffix
+    FString TypeName = ExpressionType;
+    if (TypeName == TEXT("Lerp")) TypeName = TEXT("LinearInterpolate");
+    else if (TypeName == TEXT("TextureParameter")) TypeName = TEXT("TextureSampleParameter2D");
+    else if (TypeName == TEXT("TexCoord")) TypeName = TEXT("TextureCoordinate");
+    else if (TypeName == TEXT("LandscapeCoords")) TypeName = TEXT("LandscapeLayerCoords");
+    else if (TypeName == TEXT("Dot")) TypeName = TEXT("DotProduct");
+    else if (TypeName == TEXT("ObjectPosition")) TypeName = TEXT("ObjectPositionWS");
+    else if (TypeName == TEXT("Append")) TypeName = TEXT("AppendVector");
+
+    const FString ClassName = Expression->GetClass()->GetName();
+    return ClassName == TypeName || ClassName == (TEXT("MaterialExpression") + TypeName);
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::ExpressionToJson(UMaterialExpression* Expression)
 {
     TSharedPtr<FJsonObject> ExprObj = MakeShared<FJsonObject>();
     ExprObj->SetStringField(TEXT("id"), Expression->GetName());
+    ExprObj->SetStringField(TEXT("guid"), GetExpressionGuid(Expression));
     ExprObj->SetStringField(TEXT("type"), Expression->GetClass()->GetName());
     ExprObj->SetNumberField(TEXT("pos_x"), Expression->MaterialExpressionEditorX);
     ExprObj->SetNumberField(TEXT("pos_y"), Expression->MaterialExpressionEditorY);
@@ -742,34 +1071,541 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCreateMateria
     return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleGetMaterialGraph(const TSharedPtr<FJsonObject>& Params)
+bool FEpicUnrealMCPMaterialGraphCommands::CanStreamCommand(const FString& CommandType) const
+{
+    return CommandType == TEXT("get_material_graph");
+}
+
+bool FEpicUnrealMCPMaterialGraphCommands::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    FMCPResponseWriter& Writer, FString& OutError)
+{
+    if (CommandType == TEXT("get_material_graph"))
+    {
+        return StreamGetMaterialGraph(Params, Writer, OutError);
+    }
+    OutError = FString::Printf(TEXT("Command cannot be streamed: %s"), *CommandType);
+    return false;
+}
+
+// The only serializer for get_material_graph (HandleCommand reads it back); one expression's DOM is alive at a time
+bool FEpicUnrealMCPMaterialGraphCommands::StreamGetMaterialGraph(const TSharedPtr<FJsonObject>& Params,
+    FMCPResponseWriter& Writer, FString& OutError)
 {
     FString MaterialPath;
     if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+        OutError = TEXT("Missing 'material_path' parameter");
+        return false;
     }
 
     UMaterial* Material = LoadMaterial(MaterialPath);
     if (!Material)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+        OutError = FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath);
+        return false;
+    }
+
+    Writer.BeginObject();
+    Writer.StringField(TEXT("material_path"), MaterialPath);
+
+    int32 ExpressionCount = 0;
+    Writer.Key(TEXT("expressions"));
+    Writer.BeginArray();
+    for (UMaterialExpression* Expr : Material->GetExpressions())
+    {
+        if (Expr)
+        {
+            Writer.Object(ExpressionToJson(Expr));
+            ++ExpressionCount;
+        }
     }
+    Writer.EndArray();
+    Writer.IntField(TEXT("expression_count"), ExpressionCount);
 
-    TArray<TSharedPtr<FJsonValue>> ExpressionArray;
+    Writer.Key(TEXT("edges"));
+    Writer.BeginArray();
     for (UMaterialExpression* Expr : Material->GetExpressions())
     {
+        if (!Expr) continue;
+        for (int32 i = 0; FExpressionInput* Input = Expr->GetInput(i); i++)
+        {
+            if (!Input->Expression) continue;
+            Writer.BeginObject();
+            Writer.StringField(TEXT("source"), Input->Expression->GetName());
+            Writer.IntField(TEXT("output_index"), Input->OutputIndex);
+            Writer.StringField(TEXT("target"), Expr->GetName());
+            Writer.StringField(TEXT("input"), Expr->GetInputName(i).ToString());
+            Writer.EndObject();
+        }
+    }
+    Writer.EndArray();
+
+    Writer.Key(TEXT("outputs"));
+    Writer.BeginArray();
+    for (const TCHAR* OutputName : MaterialOutputNames)
+    {
+        FExpressionInput* Input = GetMaterialOutputInput(Material, OutputName);
+        if (!Input || !Input->Expression) continue;
+        Writer.BeginObject();
+        Writer.StringField(TEXT("source"), Input->Expression->GetName());
+        Writer.IntField(TEXT("output_index"), Input->OutputIndex);
+        Writer.StringField(TEXT("property"), OutputName);
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+
+    Writer.BoolField(TEXT("success"), true);
+    Writer.EndObject();
+    return true;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleBuildMaterialGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray;
+    if (!Params->TryGetArrayField(TEXT("nodes"), NodesArray))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'nodes' array parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>> Empty;
+    const TArray<TSharedPtr<FJsonValue>>* EdgesArray = &Empty;
+    const TArray<TSharedPtr<FJsonValue>>* OutputsArray = &Empty;
+    Params->TryGetArrayField(TEXT("edges"), EdgesArray);
+    Params->TryGetArrayField(TEXT("outputs"), OutputsArray);
+
+    bool bPrune = false;
+    bool bCreateIfMissing = true;
+    bool bWaitForCompile = true;
+    Params->TryGetBoolField(TEXT("prune"), bPrune);
+    Params->TryGetBoolField(TEXT("create_if_missing"), bCreateIfMissing);
+    Params->TryGetBoolField(TEXT("wait_for_compile"), bWaitForCompile);
+
+    UMaterial* Material = LoadMaterial(MaterialPath);
+    if (!Material && !bCreateIfMissing)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    auto AddError = [&Errors](const FString& Message)
+    {
+        Errors.Add(MakeShared<FJsonValueString>(Message));
+    };
+
+    // Index the existing graph once: document ids match expression names/GUIDs (get_material_graph output) or Desc tags (earlier builds)
+    TMap<FString, UMaterialExpression*> ExistingById;
+    if (Material)
+    {
+        for (UMaterialExpression* Expr : Material->GetExpressions())
+        {
+            if (!Expr) continue;
+            ExistingById.Add(Expr->GetName(), Expr);
+            if (Expr->MaterialExpressionGuid.IsValid())
+            {
+                ExistingById.Add(GetExpressionGuid(Expr), Expr);
+            }
+            if (!Expr->Desc.IsEmpty())
+            {
+                ExistingById.FindOrAdd(Expr->Desc, Expr);
+            }
+        }
+    }
+
+    // --- Validate the whole document before touching the graph, so a bad spec changes nothing ---
+    // Inputs are checked on the expression the node will use: the existing one if it keeps its type, else the class default
+    TMap<FString, UMaterialExpression*> ProbeById;
+    for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
+    {
+        const TSharedPtr<FJsonObject>* NodeObjPtr;
+        if (!NodeValue->TryGetObject(NodeObjPtr))
+        {
+            AddError(TEXT("Node entries must be objects"));
+            continue;
+        }
+
+        FString NodeId, NodeType;
+        if (!(*NodeObjPtr)->TryGetStringField(TEXT("id"), NodeId) || !(*NodeObjPtr)->TryGetStringField(TEXT("type"), NodeType))
+        {
+            AddError(TEXT("Node missing 'id' or 'type'"));
+            continue;
+        }
+        if (ProbeById.Contains(NodeId))
+        {
+            AddError(FString::Printf(TEXT("Duplicate node id: %s"), *NodeId));
+            continue;
+        }
+
+        UMaterialExpression* Existing = ExistingById.FindRef(NodeId);
+        if (Existing && ExpressionMatchesType(Existing, NodeType))
+        {
+            ProbeById.Add(NodeId, Existing);
+        }
+        else if (UClass* ExpressionClass = FindExpressionClass(NodeType))
+        {
+            ProbeById.Add(NodeId, ExpressionClass->GetDefaultObject<UMaterialExpression>());
+        }
+        else
+        {
+            AddError(FString::Printf(TEXT("Unknown expression type '%s' for node %s"), *NodeType, *NodeId));
+        }
+    }
+
+    for (const TSharedPtr<FJsonValue>& EdgeValue : *EdgesArray)
+    {
+        const TSharedPtr<FJsonObject>* EdgeObjPtr;
+        if (!EdgeValue->TryGetObject(EdgeObjPtr)) continue;
+
+        FString SourceId, TargetId, InputName;
+        (*EdgeObjPtr)->TryGetStringField(TEXT("source"), SourceId);
+        (*EdgeObjPtr)->TryGetStringField(TEXT("target"), TargetId);
+        (*EdgeObjPtr)->TryGetStringField(TEXT("input"), InputName);
+
+        UMaterialExpression* TargetProbe = ProbeById.FindRef(TargetId);
+        if (!ProbeById.Contains(SourceId) || !TargetProbe)
+        {
+            AddError(FString::Printf(TEXT("Edge %s -> %s.%s references an unknown node"), *SourceId, *TargetId, *InputName));
+        }
+        else if (!GetExpressionInput(TargetProbe, InputName))
+        {
+            AddError(FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *TargetId));
+        }
+    }
+
+    UMaterial* OutputProbe = Material ? Material : GetMutableDefault<UMaterial>();
+    for (const TSharedPtr<FJsonValue>& OutputValue : *OutputsArray)
+    {
+        const TSharedPtr<FJsonObject>* OutputObjPtr;
+        if (!OutputValue->TryGetObject(OutputObjPtr)) continue;
+
+        FString SourceId, Property;
+        (*OutputObjPtr)->TryGetStringField(TEXT("source"), SourceId);
+        (*OutputObjPtr)->TryGetStringField(TEXT("property"), Property);
+        if (!ProbeById.Contains(SourceId) || !GetMaterialOutputInput(OutputProbe, Property))
+        {
+            AddError(FString::Printf(TEXT("Output %s -> %s: unknown node or material property"), *SourceId, *Property));
+        }
+    }
+
+    if (Errors.Num() > 0)
+    {
+        TSharedPtr<FJsonObject> ErrorObj = FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Invalid graph document (%d errors), material left unchanged"), Errors.Num()));
+        ErrorObj->SetArrayField(TEXT("errors"), Errors);
+        return ErrorObj;
+    }
+
+    bool bCreatedMaterial = false;
+    if (!Material)
+    {
+        const FString MaterialName = FPackageName::GetShortName(MaterialPath);
+        UMaterialFactoryNew* MaterialFactory = NewObject<UMaterialFactoryNew>();
+        UPackage* Package = CreatePackage(*MaterialPath);
+        Material = Cast<UMaterial>(MaterialFactory->FactoryCreateNew(
+            UMaterial::StaticClass(), Package, *MaterialName,
+            RF_Standalone | RF_Public, nullptr, GWarn));
+        if (!Material)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to create material: %s"), *MaterialPath));
+        }
+        FAssetRegistryModule::AssetCreated(Material);
+        Package->MarkPackageDirty();
+        bCreatedMaterial = true;
+    }
+
+    TMap<FString, FBuildNodeHash>& NodeHashes = BuildNodeHashes.FindOrAdd(Material);
+    TMap<FString, UMaterialExpression*> NodesById;
+    TSet<UMaterialExpression*> Kept;
+    int32 NumCreated = 0, NumUpdated = 0, NumReplaced = 0, NumUnchanged = 0, NumDeleted = 0, NumRedirected = 0;
+
+    // PreEditChange only once something actually changes, so a no-op build costs no compile
+    bool bEditOpen = false;
+    auto EnsureEditOpen = [this, Material, &bEditOpen]()
+    {
+        if (!bEditOpen)
+        {
+            BeginGraphEdit(Material);
+            bEditOpen = true;
+        }
+    };
+
+    // --- Nodes ---
+    for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
+    {
+        const TSharedPtr<FJsonObject>& NodeObj = NodeValue->AsObject();
+        const FString NodeId = NodeObj->GetStringField(TEXT("id"));
+        const FString NodeType = NodeObj->GetStringField(TEXT("type"));
+
+        float PosX = 0.0f, PosY = 0.0f;
+        NodeObj->TryGetNumberField(TEXT("pos_x"), PosX);
+        NodeObj->TryGetNumberField(TEXT("pos_y"), PosY);
+
+        FString NodeJson;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&NodeJson);
+        FJsonSerializer::Serialize(NodeObj.ToSharedRef(), Writer);
+        const uint32 NodeHash = GetTypeHash(NodeJson);
+
+        UMaterialExpression* Expr = ExistingById.FindRef(NodeId);
+        UMaterialExpression* ReplacedExpr = nullptr;
+        if (Expr && !ExpressionMatchesType(Expr, NodeType))
+        {
+            EnsureEditOpen();
+            Material->GetExpressionCollection().RemoveExpression(Expr);
+            ReplacedExpr = Expr;
+            Expr = nullptr;
+        }
+
         if (Expr)
         {
-            ExpressionArray.Add(MakeShared<FJsonValueObject>(ExpressionToJson(Expr)));
+            // Skip only if the document node is the same and nobody edited the expression since the last build
+            const FBuildNodeHash* Prev = NodeHashes.Find(NodeId);
+            if (Prev && Prev->Spec == NodeHash && Prev->State == HashExpressionState(Expr))
+            {
+                NumUnchanged++;
+            }
+            else
+            {
+                EnsureEditOpen();
+                Expr->MaterialExpressionEditorX = PosX;
+                Expr->MaterialExpressionEditorY = PosY;
+                const TSharedPtr<FJsonObject>* NodeParams;
+                if (NodeObj->TryGetObjectField(TEXT("params"), NodeParams))
+                {
+                    ApplyExpressionParams(Expr, *NodeParams);
+                }
+                NumUpdated++;
+            }
+        }
+        else
+        {
+            EnsureEditOpen();
+            Expr = CreateExpression(Material, NodeType, PosX, PosY);
+            if (!Expr)
+            {
+                AddError(FString::Printf(TEXT("Failed to create '%s' for node %s"), *NodeType, *NodeId));
+                if (ReplacedExpr)
+                {
+                    NumRedirected += RedirectExpressionLinks(Material, ReplacedExpr, nullptr);
+                }
+                continue;
+            }
+            // Tag with the document id so the next build diffs against this node
+            Expr->Desc = NodeId;
+            const TSharedPtr<FJsonObject>* NodeParams;
+            if (NodeObj->TryGetObjectField(TEXT("params"), NodeParams))
+            {
+                ApplyExpressionParams(Expr, *NodeParams);
+            }
+            if (ReplacedExpr)
+            {
+                // Nodes outside the document (and material outputs) that read the old expression follow it to the new one
+                NumRedirected += RedirectExpressionLinks(Material, ReplacedExpr, Expr);
+                NumReplaced++;
+            }
+            else
+            {
+                NumCreated++;
+            }
+        }
+
+        NodeHashes.FindOrAdd(NodeId).Spec = NodeHash;
+        NodesById.Add(NodeId, Expr);
+        Kept.Add(Expr);
+    }
+
+    // --- Prune nodes not in the document ---
+    if (bPrune)
+    {
+        TArray<UMaterialExpression*> ToRemove;
+        for (UMaterialExpression* Expr : Material->GetExpressions())
+        {
+            if (Expr && !Kept.Contains(Expr))
+            {
+                ToRemove.Add(Expr);
+            }
+        }
+        for (UMaterialExpression* Expr : ToRemove)
+        {
+            EnsureEditOpen();
+            Material->GetExpressionCollection().RemoveExpression(Expr);
+            RedirectExpressionLinks(Material, Expr, nullptr);
+            NumDeleted++;
+        }
+        for (auto It = NodeHashes.CreateIterator(); It; ++It)
+        {
+            if (!NodesById.Contains(It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // --- Edges: connect what differs, then clear document-node inputs the document leaves unwired ---
+    int32 NumConnected = 0, NumDisconnected = 0;
+    TSet<FExpressionInput*> WiredInputs;
+    for (const TSharedPtr<FJsonValue>& EdgeValue : *EdgesArray)
+    {
+        const TSharedPtr<FJsonObject>* EdgeObjPtr;
+        if (!EdgeValue->TryGetObject(EdgeObjPtr)) continue;
+        const TSharedPtr<FJsonObject>& EdgeObj = *EdgeObjPtr;
+
+        FString SourceId, TargetId, InputName;
+        EdgeObj->TryGetStringField(TEXT("source"), SourceId);
+        EdgeObj->TryGetStringField(TEXT("target"), TargetId);
+        EdgeObj->TryGetStringField(TEXT("input"), InputName);
+        int32 OutputIndex = 0;
+        EdgeObj->TryGetNumberField(TEXT("output_index"), OutputIndex);
+
+        UMaterialExpression* SourceExpr = NodesById.FindRef(SourceId);
+        UMaterialExpression* TargetExpr = NodesById.FindRef(TargetId);
+        if (!SourceExpr || !TargetExpr)
+        {
+            AddError(FString::Printf(TEXT("Edge %s -> %s.%s references an unknown node"), *SourceId, *TargetId, *InputName));
+            continue;
+        }
+
+        FExpressionInput* Input = GetExpressionInput(TargetExpr, InputName);
+        if (!Input)
+        {
+            AddError(FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *TargetId));
+            continue;
+        }
+
+        WiredInputs.Add(Input);
+        if (Input->Expression != SourceExpr || Input->OutputIndex != OutputIndex)
+        {
+            EnsureEditOpen();
+            Input->Connect(OutputIndex, SourceExpr);
+            NumConnected++;
+        }
+    }
+
+    for (const TPair<FString, UMaterialExpression*>& Pair : NodesById)
+    {
+        for (int32 i = 0; FExpressionInput* Input = Pair.Value->GetInput(i); i++)
+        {
+            if (Input->Expression && !WiredInputs.Contains(Input))
+            {
+                EnsureEditOpen();
+                Input->Expression = nullptr;
+                NumDisconnected++;
+            }
+        }
+    }
+
+    // --- Material outputs ---
+    TSet<FExpressionInput*> WiredOutputs;
+    for (const TSharedPtr<FJsonValue>& OutputValue : *OutputsArray)
+    {
+        const TSharedPtr<FJsonObject>* OutputObjPtr;
+        if (!OutputValue->TryGetObject(OutputObjPtr)) continue;
+        const TSharedPtr<FJsonObject>& OutputObj = *OutputObjPtr;
+
+        FString SourceId, Property;
+        OutputObj->TryGetStringField(TEXT("source"), SourceId);
+        OutputObj->TryGetStringField(TEXT("property"), Property);
+        int32 OutputIndex = 0;
+        OutputObj->TryGetNumberField(TEXT("output_index"), OutputIndex);
+
+        UMaterialExpression* SourceExpr = NodesById.FindRef(SourceId);
+        FExpressionInput* OutputInput = GetMaterialOutputInput(Material, Property);
+        if (!SourceExpr || !OutputInput)
+        {
+            AddError(FString::Printf(TEXT("Output %s -> %s: unknown node or material property"), *SourceId, *Property));
+            continue;
+        }
+
+        WiredOutputs.Add(OutputInput);
+        if (OutputInput->Expression != SourceExpr || OutputInput->OutputIndex != OutputIndex)
+        {
+            EnsureEditOpen();
+            OutputInput->Connect(OutputIndex, SourceExpr);
+            NumConnected++;
+        }
+    }
+
+    if (bPrune)
+    {
+        for (const TCHAR* OutputName : MaterialOutputNames)
+        {
+            FExpressionInput* OutputInput = GetMaterialOutputInput(Material, OutputName);
+            if (OutputInput && OutputInput->Expression && !WiredOutputs.Contains(OutputInput))
+            {
+                EnsureEditOpen();
+                OutputInput->Expression = nullptr;
+                NumDisconnected++;
+            }
+        }
+    }
+
+    // --- Material-level properties ---
+    const TSharedPtr<FJsonObject>* MaterialProps;
+    if (Params->TryGetObjectField(TEXT("material"), MaterialProps))
+    {
+        bool bTwoSided = false;
+        if ((*MaterialProps)->TryGetBoolField(TEXT("two_sided"), bTwoSided) && Material->TwoSided != bTwoSided)
+        {
+            EnsureEditOpen();
+            Material->TwoSided = bTwoSided;
+        }
+    }
+
+    // --- One compile for the whole document (deferred inside an edit session) ---
+    // Nodes were created/removed/retagged in bulk: let the next lookup rebuild the index once
+    if (bEditOpen)
+    {
+        if (FExpressionIndex* Index = ExpressionIndices.Find(Material))
+        {
+            Index->bStale = true;
         }
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    const double CompileStart = FPlatformTime::Seconds();
+    bool bDeferred = false;
+    if (bEditOpen)
+    {
+        bDeferred = EndGraphEdit(Material);
+        if (!bDeferred && bWaitForCompile && GShaderCompilingManager)
+        {
+            GShaderCompilingManager->FinishAllCompilation();
+        }
+    }
+    const double CompileMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+
+    // Remember what the graph looks like now, so the next build can tell untouched nodes from edited ones
+    for (const TPair<FString, UMaterialExpression*>& Pair : NodesById)
+    {
+        NodeHashes.FindOrAdd(Pair.Key).State = HashExpressionState(Pair.Value);
+    }
+
+    TSharedPtr<FJsonObject> IdMapObj = MakeShared<FJsonObject>();
+    for (const TPair<FString, UMaterialExpression*>& Pair : NodesById)
+    {
+        IdMapObj->SetStringField(Pair.Key, bEditOpen ? EnsureExpressionGuid(Pair.Value) : GetExpressionGuid(Pair.Value));
+    }
+
     ResultObj->SetStringField(TEXT("material_path"), MaterialPath);
-    ResultObj->SetArrayField(TEXT("expressions"), ExpressionArray);
-    ResultObj->SetNumberField(TEXT("expression_count"), ExpressionArray.Num());
-    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("created_material"), bCreatedMaterial);
+    ResultObj->SetNumberField(TEXT("nodes_created"), NumCreated);
+    ResultObj->SetNumberField(TEXT("nodes_replaced"), NumReplaced);
+    ResultObj->SetNumberField(TEXT("nodes_updated"), NumUpdated);
+    ResultObj->SetNumberField(TEXT("nodes_unchanged"), NumUnchanged);
+    ResultObj->SetNumberField(TEXT("nodes_deleted"), NumDeleted);
+    ResultObj->SetNumberField(TEXT("connections_made"), NumConnected);
+    ResultObj->SetNumberField(TEXT("connections_cleared"), NumDisconnected);
+    ResultObj->SetNumberField(TEXT("connections_redirected"), NumRedirected);
+    ResultObj->SetObjectField(TEXT("id_map"), IdMapObj);
+    ResultObj->SetBoolField(TEXT("compiled"), bEditOpen && !bDeferred);
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
+    ResultObj->SetNumberField(TEXT("compile_ms"), CompileMs);
+    ResultObj->SetArrayField(TEXT("errors"), Errors);
+    ResultObj->SetBoolField(TEXT("success"), Errors.Num() == 0);
     return ResultObj;
 }
 
@@ -798,7 +1634,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
     }
 
     // Pre-edit notification
-    Material->PreEditChange(nullptr);
+    BeginGraphEdit(Material);
 
     UMaterialExpression* NewExpression = CreateExpression(Material, ExpressionType, PosX, PosY);
     if (!NewExpression)
@@ -806,9 +1642,11 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown expression type: %s"), *ExpressionType));
     }
 
-    // Store unique ID in description for reliable lookup
+    // Store unique ID in description for reliable lookup; the GUID is a second id that survives renames
     FString UniqueId = FString::Printf(TEXT("MCP_%d"), ++ExpressionCounter);
     NewExpression->Desc = UniqueId;
+    const FString ExpressionGuid = EnsureExpressionGuid(NewExpression);
+    NoteExpressionAdded(Material, NewExpression);
 
     // Apply expression-specific parameters
     const TSharedPtr<FJsonObject>* ExpressionParams;
@@ -822,12 +1660,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
         ApplyExpressionParams(NewExpression, Params);
     }
 
-    // Post-edit notification
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Post-edit notification (compile deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("expression_id"), NewExpression->GetName());
+    ResultObj->SetStringField(TEXT("guid"), ExpressionGuid);
     ResultObj->SetStringField(TEXT("mcp_id"), UniqueId);
     ResultObj->SetStringField(TEXT("expression_type"), ExpressionType);
     ResultObj->SetNumberField(TEXT("pos_x"), PosX);
@@ -885,16 +1724,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
     }
 
     // Pre-edit notification
-    Material->PreEditChange(nullptr);
+    BeginGraphEdit(Material);
 
     // Make the connection
     Input->Connect(OutputIndex, SourceExpr);
 
-    // Post-edit notification
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Post-edit notification (compile deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("source_expression_id"), SourceExpressionId);
     ResultObj->SetStringField(TEXT("target_expression_id"), TargetExpressionId);
     ResultObj->SetNumberField(TEXT("output_index"), OutputIndex);
@@ -938,96 +1777,28 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectToMate
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Expression not found: %s"), *ExpressionId));
     }
 
-    // Pre-edit notification
-    Material->PreEditChange(nullptr);
-
-    // Get the editor-only data for UE5
-    UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData();
-    if (!EditorData)
+    if (!Material->GetEditorOnlyData())
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get material editor data"));
     }
 
     // Connect to the appropriate material property
-    FString PropLower = MaterialProperty.ToLower();
-    bool bConnected = false;
-
-    if (PropLower == TEXT("basecolor") || PropLower == TEXT("base_color"))
-    {
-        EditorData->BaseColor.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("metallic"))
-    {
-        EditorData->Metallic.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("specular"))
-    {
-        EditorData->Specular.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("roughness"))
-    {
-        EditorData->Roughness.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("anisotropy"))
-    {
-        EditorData->Anisotropy.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("emissivecolor") || PropLower == TEXT("emissive_color") || PropLower == TEXT("emissive"))
-    {
-        EditorData->EmissiveColor.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("opacity"))
-    {
-        EditorData->Opacity.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("opacitymask") || PropLower == TEXT("opacity_mask"))
-    {
-        EditorData->OpacityMask.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("normal"))
-    {
-        EditorData->Normal.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("tangent"))
-    {
-        EditorData->Tangent.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("worldpositionoffset") || PropLower == TEXT("world_position_offset"))
-    {
-        EditorData->WorldPositionOffset.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("subsurfacecolor") || PropLower == TEXT("subsurface_color"))
-    {
-        EditorData->SubsurfaceColor.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-    else if (PropLower == TEXT("ambientocclusion") || PropLower == TEXT("ambient_occlusion") || PropLower == TEXT("ao"))
-    {
-        EditorData->AmbientOcclusion.Connect(OutputIndex, Expression);
-        bConnected = true;
-    }
-
-    if (!bConnected)
+    FExpressionInput* OutputInput = GetMaterialOutputInput(Material, MaterialProperty);
+    if (!OutputInput)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown material property: %s"), *MaterialProperty));
     }
 
-    // Post-edit notification
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Pre-edit notification
+    BeginGraphEdit(Material);
+
+    OutputInput->Connect(OutputIndex, Expression);
+
+    // Post-edit notification (compile deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("expression_id"), ExpressionId);
     ResultObj->SetStringField(TEXT("material_property"), MaterialProperty);
     ResultObj->SetNumberField(TEXT("output_index"), OutputIndex);
@@ -1058,7 +1829,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
     // Special case: expression_id="material" sets material-level properties
     if (ExpressionId == TEXT("material"))
     {
-        Material->PreEditChange(nullptr);
+        BeginGraphEdit(Material);
 
         const TSharedPtr<FJsonObject>* PropertiesObj;
         TSharedPtr<FJsonObject> Props;
@@ -1076,10 +1847,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
             Material->TwoSided = Props->GetBoolField(TEXT("two_sided"));
         }
 
-        Material->PostEditChange();
-        Material->MarkPackageDirty();
+        const bool bDeferred = EndGraphEdit(Material);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
         ResultObj->SetStringField(TEXT("expression_id"), TEXT("material"));
         ResultObj->SetBoolField(TEXT("success"), true);
         return ResultObj;
@@ -1092,16 +1863,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
     }
 
     // Pre-edit notification
-    Material->PreEditChange(nullptr);
+    BeginGraphEdit(Material);
 
     // Apply the properties
     ApplyExpressionParams(Expression, Params);
 
-    // Post-edit notification
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Post-edit notification (compile deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("expression_id"), ExpressionId);
     ResultObj->SetBoolField(TEXT("success"), true);
     return ResultObj;
@@ -1134,16 +1905,17 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleDeleteMateria
     }
 
     // Pre-edit notification
-    Material->PreEditChange(nullptr);
+    BeginGraphEdit(Material);
 
     // Remove the expression
+    NoteExpressionRemoved(Material, Expression);
     Material->GetExpressionCollection().RemoveExpression(Expression);
 
-    // Post-edit notification
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Post-edit notification (compile deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("deleted_expression_id"), ExpressionId);
     ResultObj->SetBoolField(TEXT("success"), true);
     return ResultObj;
@@ -1163,10 +1935,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleRecompileMate
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
     }
 
-    // Force recompilation
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Force recompilation (an open edit session is committed by this compile)
+    if (EditSessions.Contains(Material))
+    {
+        CommitSession(Material, false, nullptr);
+    }
+    else
+    {
+        TGuardValue<bool> OwnEdit(bApplyingOwnEdit, true);
+        Material->PreEditChange(nullptr);
+        Material->PostEditChange();
+        Material->MarkPackageDirty();
+    }
 
     // Save material package to disk so landscape components can create proper shader instances
     UPackage* Package = Material->GetOutermost();
@@ -1183,9 +1963,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleRecompileMate
             PlatformFile.CreateDirectoryTree(*PackageDirectory);
         }
 
-        FSavePackageArgs SaveArgs;
-        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-        bool bSaved = UPackage::SavePackage(Package, Material, *PackageFilename, SaveArgs);
+        bool bSaved = FEpicUnrealMCPPackageSaver::SavePackage(Package, Material);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("material_path"), MaterialPath);
@@ -1241,6 +2019,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConfigureLand
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Expression is not a LandscapeLayerBlend"));
     }
 
+    BeginGraphEdit(Material);
+
     // Clear existing layers
     LayerBlend->Layers.Empty();
 
@@ -1308,15 +2088,92 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConfigureLand
         }
     }
 
-    // Mark dirty and recompile
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Mark dirty and recompile (deferred inside an edit session)
+    const bool bDeferred = EndGraphEdit(Material);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("compile_deferred"), bDeferred);
     ResultObj->SetStringField(TEXT("material_path"), MaterialPath);
     ResultObj->SetStringField(TEXT("expression_id"), ExpressionId);
     ResultObj->SetNumberField(TEXT("layer_count"), LayerBlend->Layers.Num());
     ResultObj->SetBoolField(TEXT("success"), true);
     return ResultObj;
 }
+
+// ============================================
+// Edit Sessions
+// ============================================
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleBeginMaterialEdit(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    float TimeoutSeconds = 60.0f;
+    Params->TryGetNumberField(TEXT("timeout_seconds"), TimeoutSeconds);
+
+    UMaterial* Material = LoadMaterial(MaterialPath);
+    if (!Material)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    bool bAlreadyOpen = true;
+    FMaterialEditSession* Session = EditSessions.Find(Material);
+    if (!Session)
+    {
+        bAlreadyOpen = false;
+        Material->PreEditChange(nullptr);
+        Session = &EditSessions.Add(Material);
+        Session->StartTime = Now;
+    }
+    Session->LastEditTime = Now;
+    Session->TimeoutSeconds = FMath::Max(TimeoutSeconds, 1.0f);
+
+    if (!SessionTickerHandle.IsValid())
+    {
+        SessionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FEpicUnrealMCPMaterialGraphCommands::TickEditSessions), 1.0f);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("material_path"), MaterialPath);
+    ResultObj->SetBoolField(TEXT("already_open"), bAlreadyOpen);
+    ResultObj->SetNumberField(TEXT("edit_count"), Session->EditCount);
+    ResultObj->SetNumberField(TEXT("timeout_seconds"), Session->TimeoutSeconds);
+    ResultObj->SetBoolField(TEXT("success"), true);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCommitMaterialEdit(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    bool bWaitForCompile = true;
+    Params->TryGetBoolField(TEXT("wait_for_compile"), bWaitForCompile);
+
+    UMaterial* Material = LoadMaterial(MaterialPath);
+    if (!Material)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to load material: %s"), *MaterialPath));
+    }
+
+    if (!EditSessions.Contains(Material))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No open edit session for material: %s (it may have auto-committed)"), *MaterialPath));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("material_path"), MaterialPath);
+    CommitSession(Material, bWaitForCompile, ResultObj);
+    ResultObj->SetBoolField(TEXT("success"), true);
+    return ResultObj;
+}
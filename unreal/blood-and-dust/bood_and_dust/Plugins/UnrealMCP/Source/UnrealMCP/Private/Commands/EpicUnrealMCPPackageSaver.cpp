@@ -0,0 +1,320 @@
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
+#include "FileHelpers.h"
+#include "EditorAssetLibrary.h"
+#include "Containers/Ticker.h"
+
+namespace
+{
+    struct FQueuedPackage
+    {
+        TWeakObjectPtr<UObject> Asset;
+        EObjectFlags TopLevelFlags = RF_Public | RF_Standalone;
+        /** Save through UEditorAssetLibrary::SaveLoadedAsset (only if dirty, source control checkout) */
+        bool bEditorSave = false;
+    };
+
+    EMCPSavePolicy GPolicy = EMCPSavePolicy::Immediate;
+    float GDeferredIdleSeconds = 2.0f;
+    int32 GDeferredMaxQueued = 64;
+
+    TMap<TWeakObjectPtr<UPackage>, FQueuedPackage> GQueue;
+    double GLastQueueTime = 0.0;
+    FTSTicker::FDelegateHandle GTickHandle;
+
+    FString GetPackageFilename(const UPackage* Package)
+    {
+        return FPackageName::LongPackageNameToFilename(Package->GetName(),
+            Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+    }
+}
+
+bool FEpicUnrealMCPPackageSaver::SavePackage(UPackage* Package, UObject* Asset, EObjectFlags TopLevelFlags)
+{
+    if (!Package)
+    {
+        return false;
+    }
+
+    if (GPolicy == EMCPSavePolicy::Immediate)
+    {
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = TopLevelFlags;
+        return UPackage::SavePackage(Package, Asset, *GetPackageFilename(Package), SaveArgs);
+    }
+
+    Package->MarkPackageDirty();
+    FQueuedPackage& Queued = GQueue.FindOrAdd(Package);
+    Queued.Asset = Asset;
+    Queued.TopLevelFlags = TopLevelFlags;
+    OnQueued();
+    return true;
+}
+
+bool FEpicUnrealMCPPackageSaver::SaveAsset(UObject* Asset)
+{
+    if (!Asset)
+    {
+        return false;
+    }
+
+    if (GPolicy == EMCPSavePolicy::Immediate)
+    {
+        return UEditorAssetLibrary::SaveLoadedAsset(Asset);
+    }
+
+    // Not marked dirty here: SaveLoadedAsset skips clean packages and so does the flush
+    FQueuedPackage& Queued = GQueue.FindOrAdd(Asset->GetOutermost());
+    Queued.Asset = Asset;
+    Queued.bEditorSave = true;
+    OnQueued();
+    return true;
+}
+
+void FEpicUnrealMCPPackageSaver::OnQueued()
+{
+    GLastQueueTime = FPlatformTime::Seconds();
+
+    if (GPolicy == EMCPSavePolicy::Deferred)
+    {
+        // Cap what is held in memory unsaved (large textures/meshes add up quickly)
+        if (GQueue.Num() >= GDeferredMaxQueued)
+        {
+            Flush();
+        }
+        else if (!GTickHandle.IsValid())
+        {
+            GTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateStatic(&FEpicUnrealMCPPackageSaver::TickDeferred), 0.5f);
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPackageSaver::SavePackages(const TArray<UPackage*>& Packages)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<UPackage*> Saved;
+    TArray<TSharedPtr<FJsonValue>> FailedNames;
+    for (UPackage* Package : Packages)
+    {
+        if (!Package)
+        {
+            continue;
+        }
+
+        UObject* Asset = nullptr;
+        EObjectFlags TopLevelFlags = RF_Public | RF_Standalone;
+        bool bEditorSave = false;
+        if (const FQueuedPackage* Queued = GQueue.Find(Package))
+        {
+            Asset = Queued->Asset.Get();
+            TopLevelFlags = Queued->TopLevelFlags;
+            bEditorSave = Queued->bEditorSave;
+        }
+        if (!Asset)
+        {
+            Asset = Package->FindAssetInPackage();
+        }
+
+        if (bEditorSave && Asset)
+        {
+            // Same as the immediate path: clean packages are left alone, source control checkout first
+            if (!Package->IsDirty())
+            {
+                continue;
+            }
+            if (UEditorAssetLibrary::SaveLoadedAsset(Asset))
+            {
+                Saved.Add(Package);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FEpicUnrealMCPPackageSaver: Failed to save package '%s'"), *Package->GetName());
+                FailedNames.Add(MakeShared<FJsonValueString>(Package->GetName()));
+            }
+            continue;
+        }
+
+        // Async file writes: the next package serializes while this one is written to disk
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = TopLevelFlags;
+        SaveArgs.SaveFlags = SAVE_Async;
+        if (UPackage::SavePackage(Package, Asset, *GetPackageFilename(Package), SaveArgs))
+        {
+            Saved.Add(Package);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FEpicUnrealMCPPackageSaver: Failed to save package '%s'"), *Package->GetName());
+            FailedNames.Add(MakeShared<FJsonValueString>(Package->GetName()));
+        }
+    }
+
+    UPackage::WaitForAsyncFileWrites();
+
+    int64 BytesWritten = 0;
+    TArray<TSharedPtr<FJsonValue>> SavedNames;
+    for (UPackage* Package : Saved)
+    {
+        BytesWritten += FMath::Max<int64>(IFileManager::Get().FileSize(*GetPackageFilename(Package)), 0);
+        SavedNames.Add(MakeShared<FJsonValueString>(Package->GetName()));
+        GQueue.Remove(Package);
+    }
+
+    const double SaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), FailedNames.Num() == 0);
+    Result->SetNumberField(TEXT("packages_saved"), Saved.Num());
+    Result->SetNumberField(TEXT("packages_failed"), FailedNames.Num());
+    Result->SetNumberField(TEXT("bytes_written"), (double)BytesWritten);
+    Result->SetNumberField(TEXT("save_ms"), SaveMs);
+    Result->SetArrayField(TEXT("saved"), SavedNames);
+    Result->SetArrayField(TEXT("failed"), FailedNames);
+    if (FailedNames.Num() > 0)
+    {
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d package(s) failed to save"), FailedNames.Num()));
+    }
+
+    if (Saved.Num() > 0 || FailedNames.Num() > 0)
+    {
+        UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPPackageSaver: Saved %d package(s), %lld bytes in %.1f ms (%d failed)"),
+            Saved.Num(), BytesWritten, SaveMs, FailedNames.Num());
+    }
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPackageSaver::Flush(bool bIncludeUntracked)
+{
+    TArray<UPackage*> Packages;
+    for (auto It = GQueue.CreateIterator(); It; ++It)
+    {
+        if (UPackage* Package = It->Key.Get())
+        {
+            Packages.Add(Package);
+        }
+        else
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    if (bIncludeUntracked)
+    {
+        // Handlers that only MarkPackageDirty() never queue anything; pick those up too (project content only)
+        TArray<UPackage*> DirtyPackages;
+        FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+        for (UPackage* Package : DirtyPackages)
+        {
+            if (Package && Package->GetName().StartsWith(TEXT("/Game/")) && !GQueue.Contains(Package))
+            {
+                // Nobody asked for a raw save of these: go through the editor save (checkout) path
+                GQueue.Add(Package).bEditorSave = true;
+                Packages.Add(Package);
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = SavePackages(Packages);
+
+    // Failed packages stay dirty in the editor; drop them from the queue so the ticker does not retry forever
+    GQueue.Reset();
+    Result->SetStringField(TEXT("policy"), PolicyToString(GPolicy));
+    return Result;
+}
+
+EMCPSavePolicy FEpicUnrealMCPPackageSaver::GetPolicy()
+{
+    return GPolicy;
+}
+
+void FEpicUnrealMCPPackageSaver::SetPolicy(EMCPSavePolicy NewPolicy)
+{
+    GPolicy = NewPolicy;
+    if (NewPolicy == EMCPSavePolicy::Immediate && GQueue.Num() > 0)
+    {
+        Flush();
+    }
+    else if (NewPolicy == EMCPSavePolicy::Deferred && GQueue.Num() > 0 && !GTickHandle.IsValid())
+    {
+        GTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateStatic(&FEpicUnrealMCPPackageSaver::TickDeferred), 0.5f);
+    }
+}
+
+bool FEpicUnrealMCPPackageSaver::ParsePolicy(const FString& Name, EMCPSavePolicy& OutPolicy)
+{
+    if (Name.Equals(TEXT("immediate"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = EMCPSavePolicy::Immediate;
+        return true;
+    }
+    if (Name.Equals(TEXT("deferred"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = EMCPSavePolicy::Deferred;
+        return true;
+    }
+    if (Name.Equals(TEXT("on_flush"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("on-flush"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = EMCPSavePolicy::OnFlush;
+        return true;
+    }
+    return false;
+}
+
+FString FEpicUnrealMCPPackageSaver::PolicyToString(EMCPSavePolicy Policy)
+{
+    switch (Policy)
+    {
+    case EMCPSavePolicy::Deferred: return TEXT("deferred");
+    case EMCPSavePolicy::OnFlush:  return TEXT("on_flush");
+    default:                       return TEXT("immediate");
+    }
+}
+
+void FEpicUnrealMCPPackageSaver::SetDeferredLimits(float IdleSeconds, int32 MaxQueued)
+{
+    GDeferredIdleSeconds = FMath::Max(IdleSeconds, 0.1f);
+    GDeferredMaxQueued = FMath::Max(MaxQueued, 1);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPackageSaver::GetStatus()
+{
+    TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+    Status->SetBoolField(TEXT("success"), true);
+    Status->SetStringField(TEXT("policy"), PolicyToString(GPolicy));
+    Status->SetNumberField(TEXT("deferred_idle_seconds"), GDeferredIdleSeconds);
+    Status->SetNumberField(TEXT("deferred_max_queued"), GDeferredMaxQueued);
+    Status->SetNumberField(TEXT("queued_packages"), GQueue.Num());
+    return Status;
+}
+
+void FEpicUnrealMCPPackageSaver::Shutdown()
+{
+    if (GTickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(GTickHandle);
+        GTickHandle.Reset();
+    }
+    GQueue.Reset();
+}
+
+bool FEpicUnrealMCPPackageSaver::TickDeferred(float DeltaTime)
+{
+    if (GPolicy == EMCPSavePolicy::Deferred && GQueue.Num() > 0 &&
+        FPlatformTime::Seconds() - GLastQueueTime >= GDeferredIdleSeconds)
+    {
+        Flush();
+    }
+
+    if (GPolicy != EMCPSavePolicy::Deferred || GQueue.Num() == 0)
+    {
+        GTickHandle.Reset();
+        return false;
+    }
+    return true;
+}
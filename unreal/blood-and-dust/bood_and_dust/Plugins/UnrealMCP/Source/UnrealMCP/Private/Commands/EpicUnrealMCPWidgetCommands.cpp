@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPWidgetCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -348,9 +349,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPWidgetCommands::HandleCreateWidgetBlueprin
 		PlatformFile.CreateDirectoryTree(*PackageDirectory);
 	}
 
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	bool bSaved = UPackage::SavePackage(Package, WBP, *PackageFilename, SaveArgs);
+	bool bSaved = FEpicUnrealMCPPackageSaver::SavePackage(Package, WBP);
 
 	if (!bSaved)
 	{
@@ -51,15 +51,15 @@
 #include "GameFramework/InputSettings.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
-// Screenshot 2-phase capture includes
-#include "Engine/SceneCapture2D.h"
-#include "Components/SceneCaptureComponent2D.h"
-#include "Engine/TextureRenderTarget2D.h"
+// Screenshot capture rig
 #include "LevelEditorViewport.h"
-#include "IImageWrapperModule.h"
-#include "IImageWrapper.h"
-#include "Misc/FileHelper.h"
-#include "HAL/PlatformFileManager.h"
+#include "MCPCaptureRig.h"
+#include "MCPResponseWriter.h"
+#include "MCPMessagePack.h"
+#include "MCPCommandStats.h"
+#include "MCPRequestLog.h"
+#include "MCPEventHub.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 // Include our new command handler classes
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
@@ -221,285 +221,677 @@ void UEpicUnrealMCPBridge::StopServer()
 // Execute a command received from a client
 FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
-    
-    // Use TSharedPtr for the promise so the lambda is copyable (required by FTickerDelegate)
-    TSharedPtr<TPromise<FString>> Promise = MakeShared<TPromise<FString>>();
-    TFuture<FString> Future = Promise->GetFuture();
+    TArray<uint8> Response;
+    ExecuteCommandUTF8(CommandType, Params, Response);
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Response.GetData()), Response.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+namespace
+{
+    double MsSince(double StartSeconds)
+    {
+        return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+    }
+
+    // Rough heap footprint of a JSON DOM: one shared-ref'd node per value, map slots for object
+    // members and TCHAR storage for keys and strings. Only used to compare against the streamed bytes.
+    int64 EstimateJsonDomBytes(const TSharedPtr<FJsonValue>& Value);
+
+    int64 EstimateJsonDomBytes(const TSharedPtr<FJsonObject>& Object)
+    {
+        if (!Object.IsValid())
+        {
+            return 0;
+        }
+        int64 Bytes = sizeof(FJsonObject) + 16;
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values)
+        {
+            Bytes += sizeof(TPair<FString, TSharedPtr<FJsonValue>>) + 16;
+            Bytes += Pair.Key.GetAllocatedSize();
+            Bytes += EstimateJsonDomBytes(Pair.Value);
+        }
+        return Bytes;
+    }
+
+    int64 EstimateJsonDomBytes(const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid())
+        {
+            return 0;
+        }
+        int64 Bytes = sizeof(FJsonValueString) + 16;
+        switch (Value->Type)
+        {
+        case EJson::String:
+            Bytes += (Value->AsString().Len() + 1) * sizeof(TCHAR);
+            break;
+        case EJson::Array:
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                Bytes += sizeof(TSharedPtr<FJsonValue>) + EstimateJsonDomBytes(Element);
+            }
+            break;
+        case EJson::Object:
+            Bytes += EstimateJsonDomBytes(Value->AsObject());
+            break;
+        default:
+            break;
+        }
+        return Bytes;
+    }
+}
+
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::BenchmarkResponseWriter(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Command;
+    if (!Params->TryGetStringField(TEXT("command"), Command))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'command' parameter"));
+    }
+
+    // get_scene_delta streams too, but has no DOM handler to compare against
+    const bool bEditor = EditorCommands->CanStreamCommand(Command) && Command != TEXT("get_scene_delta");
+    if (!bEditor && !MaterialGraphCommands->CanStreamCommand(Command))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("'%s' has no streaming writer (supported: get_actors_in_level, find_actors_by_name, get_material_graph)"), *Command));
+    }
+
+    const TSharedPtr<FJsonObject>* CommandParamsPtr = nullptr;
+    TSharedPtr<FJsonObject> CommandParams = Params->TryGetObjectField(TEXT("params"), CommandParamsPtr)
+        ? *CommandParamsPtr : MakeShared<FJsonObject>();
+
+    int32 Iterations = 10;
+    if (Params->HasField(TEXT("iterations")))
+    {
+        Iterations = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("iterations"))), 1, 1000);
+    }
+
+    EMCPWireFormat Format = EMCPWireFormat::Json;
+    FString FormatName;
+    if (Params->TryGetStringField(TEXT("format"), FormatName) && !FMCPMessagePack::ParseWireFormat(FormatName, Format))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Unsupported format '%s' (expected json or msgpack)"), *FormatName));
+    }
+
+    // DOM path, as every command used to go: result tree -> envelope tree -> UTF-16 FString -> UTF-8.
+    // Streamed queries have no DOM handler any more, so the tree is read back from the streaming writer
+    // once and only the envelope/serialize/convert steps are timed (building the tree is not counted).
+    const TSharedPtr<FJsonObject> DomResult = bEditor
+        ? EditorCommands->HandleCommand(Command, CommandParams)
+        : MaterialGraphCommands->HandleCommand(Command, CommandParams);
+    double DomSeconds = 0.0;
+    int64 DomTreeBytes = 0;
+    int64 DomStringBytes = 0;
+    int64 DomUTF8Bytes = 0;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const double Start = FPlatformTime::Seconds();
+        TSharedPtr<FJsonObject> Envelope = MakeShared<FJsonObject>();
+        Envelope->SetStringField(TEXT("status"), TEXT("success"));
+        Envelope->SetObjectField(TEXT("result"), DomResult);
+        FString ResultString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
+        FJsonSerializer::Serialize(Envelope.ToSharedRef(), Writer);
+        FTCHARToUTF8 UTF8(*ResultString);
+        DomSeconds += FPlatformTime::Seconds() - Start;
+
+        if (i == 0)
+        {
+            DomTreeBytes = EstimateJsonDomBytes(Envelope);
+            DomStringBytes = ResultString.GetAllocatedSize();
+            DomUTF8Bytes = UTF8.Length();
+        }
+    }
+
+    // Streaming path, reusing one buffer the way the server thread does per connection
+    TArray<uint8> Buffer;
+    double StreamSeconds = 0.0;
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        const double Start = FPlatformTime::Seconds();
+        Buffer.Reset();
+        StreamCommand(Command, CommandParams, Buffer, Format);
+        StreamSeconds += FPlatformTime::Seconds() - Start;
+    }
+
+    TSharedPtr<FJsonObject> Streamed = MakeShared<FJsonObject>();
+    FString StreamError;
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        TSharedPtr<FJsonObject> Decoded;
+        if (!FMCPMessagePack::DecodeObject(Buffer.GetData(), Buffer.Num(), Decoded, StreamError))
+        {
+            StreamError = FString::Printf(TEXT("Invalid MessagePack output: %s"), *StreamError);
+        }
+        else if (Decoded->GetStringField(TEXT("status")) != TEXT("success"))
+        {
+            StreamError = Decoded->GetStringField(TEXT("error"));
+        }
+    }
+    else if (Buffer.Num() <= 12 || FMemory::Memcmp(Buffer.GetData(), "{\"status\":\"s", 12) != 0)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), Buffer.Num());
+        StreamError = FString(Converted.Length(), Converted.Get());
+    }
+    if (!StreamError.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Streaming '%s' failed: %s"), *Command, *StreamError));
+    }
+
+    TSharedPtr<FJsonObject> Dom = MakeShared<FJsonObject>();
+    Dom->SetNumberField(TEXT("ms_per_iteration"), DomSeconds * 1000.0 / Iterations);
+    Dom->SetNumberField(TEXT("tree_bytes_estimate"), static_cast<double>(DomTreeBytes));
+    Dom->SetNumberField(TEXT("utf16_string_bytes"), static_cast<double>(DomStringBytes));
+    Dom->SetNumberField(TEXT("utf8_bytes"), static_cast<double>(DomUTF8Bytes));
+
+    Streamed->SetStringField(TEXT("format"), FMCPMessagePack::WireFormatName(Format));
+    Streamed->SetNumberField(TEXT("ms_per_iteration"), StreamSeconds * 1000.0 / Iterations);
+    Streamed->SetNumberField(TEXT("buffer_bytes"), static_cast<double>(Buffer.Num()));
+    Streamed->SetNumberField(TEXT("buffer_capacity_bytes"), static_cast<double>(Buffer.GetAllocatedSize()));
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("command"), Command);
+    Result->SetNumberField(TEXT("iterations"), Iterations);
+    Result->SetObjectField(TEXT("dom"), Dom);
+    Result->SetObjectField(TEXT("streaming"), Streamed);
+    Result->SetNumberField(TEXT("speedup"), StreamSeconds > 0.0 ? DomSeconds / StreamSeconds : 0.0);
+    Result->SetNumberField(TEXT("bytes_saved"),
+        static_cast<double>(DomTreeBytes + DomStringBytes + DomUTF8Bytes - Buffer.GetAllocatedSize()));
+    return Result;
+}
+
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::GetStats(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Filter;
+    Params->TryGetStringField(TEXT("command"), Filter);
+    TSharedPtr<FJsonObject> Result = FMCPCommandStats::ToJson(Filter);
+
+    // csv: true writes to Saved/MCP/Stats, csv_path picks the file
+    bool bCsv = false;
+    FString CsvPath;
+    Params->TryGetBoolField(TEXT("csv"), bCsv);
+    if (Params->TryGetStringField(TEXT("csv_path"), CsvPath) || bCsv)
+    {
+        const FString Written = FMCPCommandStats::WriteCsv(CsvPath);
+        if (Written.IsEmpty())
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to write stats CSV: %s"), *CsvPath));
+        }
+        Result->SetStringField(TEXT("csv_path"), Written);
+    }
+
+    bool bReset = false;
+    if (Params->TryGetBoolField(TEXT("reset"), bReset) && bReset)
+    {
+        FMCPCommandStats::Reset();
+        Result->SetBoolField(TEXT("reset"), true);
+    }
+
+    // What the request log itself costs: ring memory vs. time spent writing log lines
+    Result->SetObjectField(TEXT("request_log"), FMCPRequestLog::GetStatus());
+    return Result;
+}
+
+bool UEpicUnrealMCPBridge::StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    TArray<uint8>& OutResponse, EMCPWireFormat Format, bool* bOutSucceeded)
+{
+    const bool bEditor = EditorCommands->CanStreamCommand(CommandType);
+    if (!bEditor && !MaterialGraphCommands->CanStreamCommand(CommandType))
+    {
+        return false;
+    }
+
+    const int32 EnvelopeStart = OutResponse.Num();
+    FString Error;
+    bool bWritten = false;
+    {
+        FMCPResponseWriter Writer(OutResponse, Format);
+        Writer.BeginSuccessEnvelope();
+        bWritten = bEditor
+            ? EditorCommands->StreamCommand(CommandType, Params, Writer, Error)
+            : MaterialGraphCommands->StreamCommand(CommandType, Params, Writer, Error);
+        if (bWritten)
+        {
+            Writer.EndSuccessEnvelope();
+        }
+    }
+
+    if (!bWritten)
+    {
+        OutResponse.SetNum(EnvelopeStart, EAllowShrinking::No);
+        FMCPResponseWriter(OutResponse, Format).ErrorEnvelope(Error);
+    }
+    if (bOutSucceeded)
+    {
+        *bOutSucceeded = bWritten;
+    }
+    return true;
+}
+
+void UEpicUnrealMCPBridge::ExecuteCommandUTF8(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutResponse,
+    int64 RequestBytes)
+{
+    ExecuteCommandEncoded(CommandType, Params, EMCPWireFormat::Json, OutResponse, RequestBytes);
+}
+
+void UEpicUnrealMCPBridge::ExecuteCommandEncoded(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+    EMCPWireFormat Format, TArray<uint8>& OutResponse, int64 RequestBytes)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(MCP_ExecuteCommand);
+    UE_LOG(LogTemp, Verbose, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
+
+    // The calling (server) thread blocks on the future below, so game-thread lambdas can write
+    // straight into its buffer (and its stats sample). Use TSharedPtr for the promise so the
+    // lambda is copyable (required by FTickerDelegate).
+    OutResponse.Reset();
+    TArray<uint8>* Out = &OutResponse;
+    TSharedPtr<TPromise<void>> Promise = MakeShared<TPromise<void>>();
+    TFuture<void> Future = Promise->GetFuture();
+
+    const double EnqueueTime = FPlatformTime::Seconds();
+    FMCPCommandSample Sample;
+    Sample.BytesIn = RequestBytes;
+    FMCPCommandSample* Stats = &Sample;
+    auto WaitAndRecord = [&]()
+    {
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE(MCP_WaitForGameThread);
+            Future.Wait();
+        }
+        Sample.TotalMs = MsSince(EnqueueTime);
+        Sample.BytesOut = OutResponse.Num();
+        FMCPCommandStats::Record(CommandType, Sample);
+        FMCPRequestLog::Add(CommandType, Format, Sample);
+    };
+
+    // === Thread-safe commands ===
+    // Log and telemetry reads only touch lock-protected buffers, so they run right here on the server
+    // thread: no game-thread round trip, and they still answer while the editor is busy or hitching.
+    // poll_events never needs the game thread either; a timeout_ms wait (capped at 1 s) holds this thread.
+    if (CommandType == TEXT("poll_events"))
+    {
+        const double ExecStart = FPlatformTime::Seconds();
+        {
+            FMCPResponseWriter Writer(OutResponse, Format);
+            Writer.BeginSuccessEnvelope();
+            if (FMCPEventHub::Poll(Params, Writer, Sample.Error))
+            {
+                Writer.EndSuccessEnvelope();
+            }
+        }
+        if (!Sample.Error.IsEmpty())
+        {
+            Sample.bSuccess = false;
+            OutResponse.Reset();
+            FMCPResponseWriter(OutResponse, Format).ErrorEnvelope(Sample.Error);
+        }
+        Sample.bStreamed = true;
+        Sample.ExecMs = MsSince(ExecStart);
+        Promise->SetValue();
+        WaitAndRecord();
+        return;
+    }
+    if (CommandType == TEXT("get_editor_log") ||
+        CommandType == TEXT("get_mcp_stats") ||
+        CommandType == TEXT("get_mcp_request_log") ||
+        CommandType == TEXT("set_mcp_logging") ||
+        CommandType == TEXT("subscribe") ||
+        CommandType == TEXT("unsubscribe"))
+    {
+        const double ExecStart = FPlatformTime::Seconds();
+        TSharedPtr<FJsonObject> ResultJson;
+        if (CommandType == TEXT("get_editor_log"))
+        {
+            ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+        }
+        else if (CommandType == TEXT("get_mcp_stats"))
+        {
+            ResultJson = GetStats(Params);
+        }
+        else if (CommandType == TEXT("get_mcp_request_log"))
+        {
+            ResultJson = FMCPRequestLog::Query(Params);
+        }
+        else if (CommandType == TEXT("set_mcp_logging"))
+        {
+            ResultJson = FMCPRequestLog::Configure(Params);
+        }
+        else if (CommandType == TEXT("subscribe"))
+        {
+            ResultJson = FMCPEventHub::Subscribe(Params);
+        }
+        else
+        {
+            ResultJson = FMCPEventHub::Unsubscribe(Params);
+        }
+        Sample.ExecMs = MsSince(ExecStart);
+
+        const double SerializeStart = FPlatformTime::Seconds();
+        if (ResultJson->HasField(TEXT("success")) && !ResultJson->GetBoolField(TEXT("success")))
+        {
+            Sample.bSuccess = false;
+            ResultJson->TryGetStringField(TEXT("error"), Sample.Error);
+            FMCPResponseWriter(OutResponse, Format).ErrorEnvelope(Sample.Error);
+        }
+        else
+        {
+            FMCPResponseWriter(OutResponse, Format).SuccessEnvelope(ResultJson);
+        }
+        Sample.SerializeMs = MsSince(SerializeStart);
+        Promise->SetValue();
+        WaitAndRecord();
+        return;
+    }
 
     // === Special handling for take_screenshot ===
-    // Screenshot uses a 2-phase ticker to avoid a deadlock:
-    //   Phase 0: Spawn SceneCapture2D + CaptureScene() (enqueues render commands)
-    //   Phase 1: ReadPixels() + PNG encode + save (requires render commands to be complete)
-    // Doing both in the same tick can deadlock because ReadPixels() internally calls
-    // FlushRenderingCommands() while the CaptureScene render commands are still pending.
+    // The capture runs as a ticker job on the persistent FMCPCaptureRig:
+    //   Setup tick: reuse the rig's SceneCapture2D + pooled render target, CaptureScene() and
+    //               enqueue a GPU readback copy (render commands, nothing blocks)
+    //   Later ticks: poll the readback fence; once the pixels are in system memory the
+    //               PNG/JPEG encode and file write run on a worker thread
+    // ReadPixels() is never called: it flushes rendering commands and stalls the game thread.
     if (CommandType == TEXT("take_screenshot"))
     {
-        struct FScreenshotState
+        auto SendError = [Promise, Out, Format, Stats, EnqueueTime](const FString& Error)
         {
-            int32 Phase = 0;
-            int32 FrameCount = 0;
-            ASceneCapture2D* CaptureActor = nullptr;
-            UTextureRenderTarget2D* RenderTarget = nullptr;
-            FString FilePath;
-            int32 Width = 0;
-            int32 Height = 0;
+            Stats->bSuccess = false;
+            Stats->Error = Error;
+            Stats->ExecMs = MsSince(EnqueueTime) - Stats->QueueMs;
+            FMCPResponseWriter(*Out, Format).ErrorEnvelope(Error);
+            Promise->SetValue();
         };
-        auto State = MakeShared<FScreenshotState>();
+
+        auto Job = MakeShared<TSharedPtr<FMCPCaptureJob, ESPMode::ThreadSafe>>();
 
         FTSTicker::GetCoreTicker().AddTicker(
-            FTickerDelegate::CreateLambda([this, Params, Promise, State](float DeltaTime) -> bool
+            FTickerDelegate::CreateLambda([Params, Promise, Out, Format, Job, SendError, Stats, EnqueueTime](float DeltaTime) -> bool
         {
-            if (State->Phase == 0)
+            TRACE_CPUPROFILER_EVENT_SCOPE(MCP_take_screenshot);
+            if (!Job->IsValid())
             {
-                // === Phase 0: Setup + CaptureScene ===
-                UE_LOG(LogTemp, Display, TEXT("Screenshot Phase 0: Setting up SceneCapture2D"));
-
-                if (!Params->TryGetStringField(TEXT("file_path"), State->FilePath))
-                {
-                    State->FilePath = FPaths::ProjectSavedDir() / TEXT("Screenshots") / TEXT("MCP_Screenshot.png");
-                }
-
-                State->Width = 960;
-                State->Height = 540;
+                Stats->QueueMs = MsSince(EnqueueTime);
+                FMCPCaptureOptions Options;
+                Params->TryGetStringField(TEXT("file_path"), Options.FilePath);
                 if (Params->HasField(TEXT("width")))
                 {
-                    State->Width = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("width"))), 320, 3840);
+                    Options.Width = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("width"))), 320, 3840);
                 }
                 if (Params->HasField(TEXT("height")))
                 {
-                    State->Height = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("height"))), 240, 2160);
+                    Options.Height = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("height"))), 240, 2160);
                 }
 
-                IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-                PlatformFile.CreateDirectoryTree(*FPaths::GetPath(State->FilePath));
-
-                // Get viewport camera
-                FVector CameraLocation = FVector::ZeroVector;
-                FRotator CameraRotation = FRotator::ZeroRotator;
-                float CameraFOV = 90.0f;
-                bool bFoundCamera = false;
-                FLevelEditorViewportClient* UsedClient = nullptr;
+                Params->TryGetStringField(TEXT("format"), Options.Format);
+                Options.Format = Options.Format.ToLower();
+                if (Options.Format == TEXT("jpg"))
+                {
+                    Options.Format = TEXT("jpeg");
+                }
+                if (Options.Format != TEXT("png") && Options.Format != TEXT("jpeg") && Options.Format != TEXT("bmp") && Options.Format != TEXT("raw"))
+                {
+                    SendError(FString::Printf(TEXT("Unsupported format '%s' (expected png, jpeg, bmp or raw)"), *Options.Format));
+                    return false;
+                }
+                if (Params->HasField(TEXT("quality")))
+                {
+                    Options.Quality = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("quality"))), 1, 100);
+                }
 
-                if (GEditor)
+                // output: "file" (default, original behavior), "inline" (base64 only, no disk write), "both",
+                // or "bulk" (image in a shared-memory segment, only the descriptor in the response)
+                FString Output = TEXT("file");
+                Params->TryGetStringField(TEXT("output"), Output);
+                if (Output != TEXT("file") && Output != TEXT("inline") && Output != TEXT("both") && Output != TEXT("bulk"))
                 {
-                    const TArray<FLevelEditorViewportClient*>& LevelViewports = GEditor->GetLevelViewportClients();
-                    for (FLevelEditorViewportClient* VC : LevelViewports)
-                    {
-                        if (VC && VC->IsPerspective())
-                        {
-                            CameraLocation = VC->GetViewLocation();
-                            CameraRotation = VC->GetViewRotation();
-                            CameraFOV = VC->ViewFOV;
-                            UsedClient = VC;
-                            bFoundCamera = true;
-                            break;
-                        }
-                    }
-                    if (!bFoundCamera)
-                    {
-                        for (FLevelEditorViewportClient* VC : LevelViewports)
-                        {
-                            if (VC)
-                            {
-                                CameraLocation = VC->GetViewLocation();
-                                CameraRotation = VC->GetViewRotation();
-                                CameraFOV = VC->ViewFOV;
-                                UsedClient = VC;
-                                bFoundCamera = true;
-                                break;
-                            }
-                        }
-                    }
+                    SendError(FString::Printf(TEXT("Unsupported output '%s' (expected file, inline, both or bulk)"), *Output));
+                    return false;
+                }
+                if (Options.Format == TEXT("raw") && Output != TEXT("bulk"))
+                {
+                    SendError(TEXT("format 'raw' requires output 'bulk'"));
+                    return false;
+                }
+                Options.bInline = Output == TEXT("inline") || Output == TEXT("both");
+                Options.bBulk = Output == TEXT("bulk");
+                if (Output == TEXT("inline") || Output == TEXT("bulk"))
+                {
+                    Options.FilePath.Empty();
+                }
+                else if (Options.FilePath.IsEmpty())
+                {
+                    Options.FilePath = FPaths::ProjectSavedDir() / TEXT("Screenshots") /
+                        FString::Printf(TEXT("MCP_Screenshot.%s"), Options.Format == TEXT("jpeg") ? TEXT("jpg") : *Options.Format);
                 }
 
-                if (!bFoundCamera)
+                FMCPCaptureView View;
+                if (!FMCPCaptureRig::GetEditorViewportView(View, &Options))
                 {
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), TEXT("No editor viewport camera found"));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
+                    SendError(TEXT("No editor viewport camera found"));
                     return false;
                 }
 
+                FString Error;
                 UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-                if (!World)
+                *Job = FMCPCaptureRig::Capture(World, View, Options, Error);
+                if (!Job->IsValid())
                 {
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), TEXT("No editor world available"));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
+                    SendError(Error);
                     return false;
                 }
+                return true; // Come back next tick
+            }
+
+            if (!(*Job)->Tick())
+            {
+                return true;
+            }
+
+            TSharedPtr<FJsonObject> Result = (*Job)->GetResult();
+            if (!Result->GetBoolField(TEXT("success")))
+            {
+                SendError(Result->GetStringField(TEXT("error")));
+                return false;
+            }
 
-                // Create render target
-                State->RenderTarget = NewObject<UTextureRenderTarget2D>();
-                State->RenderTarget->AddToRoot(); // Prevent GC between ticks
-                State->RenderTarget->InitCustomFormat(State->Width, State->Height, PF_B8G8R8A8, true);
-                State->RenderTarget->UpdateResourceImmediate(false);
+            FString AbsPath;
+            Result->TryGetStringField(TEXT("file_path"), AbsPath);
+            const int32 Width = static_cast<int32>(Result->GetNumberField(TEXT("width")));
+            const int32 Height = static_cast<int32>(Result->GetNumberField(TEXT("height")));
+            Result->SetStringField(TEXT("message"), AbsPath.IsEmpty()
+                ? FString::Printf(TEXT("Screenshot captured: %dx%d"), Width, Height)
+                : FString::Printf(TEXT("Screenshot saved: %dx%d to %s"), Width, Height, *AbsPath));
 
-                // Spawn capture actor
-                FActorSpawnParameters SpawnParams;
-                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-                SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
-                SpawnParams.ObjectFlags = RF_Transient;
+            Stats->ExecMs = MsSince(EnqueueTime) - Stats->QueueMs;
+            const double SerializeStart = FPlatformTime::Seconds();
+            FMCPResponseWriter(*Out, Format).SuccessEnvelope(Result);
+            Stats->SerializeMs = MsSince(SerializeStart);
+            Promise->SetValue();
 
-                State->CaptureActor = World->SpawnActor<ASceneCapture2D>(
-                    CameraLocation, CameraRotation, SpawnParams);
+            UE_LOG(LogTemp, Display, TEXT("Screenshot: %dx%d %s in %.1f ms (readback %.1f ms, encode %.1f ms)"),
+                Width, Height, *Result->GetStringField(TEXT("format")), Result->GetNumberField(TEXT("total_ms")),
+                Result->GetNumberField(TEXT("readback_ms")), Result->GetNumberField(TEXT("encode_ms")));
+            return false; // Done
+        }));
 
-                if (!State->CaptureActor)
+        WaitAndRecord();
+        return;
+    }
+
+    // === Special handling for capture_views ===
+    // Same capture rig as take_screenshot, many cameras per command: explicit views or an
+    // orbit (turntable) around an actor/point, pipelined by FMCPCaptureBatch across ticks.
+    if (CommandType == TEXT("capture_views"))
+    {
+        auto SendError = [Promise, Out, Format, Stats, EnqueueTime](const FString& Error)
+        {
+            Stats->bSuccess = false;
+            Stats->Error = Error;
+            Stats->ExecMs = MsSince(EnqueueTime) - Stats->QueueMs;
+            FMCPResponseWriter(*Out, Format).ErrorEnvelope(Error);
+            Promise->SetValue();
+        };
+
+        auto Batch = MakeShared<TSharedPtr<FMCPCaptureBatch>>();
+
+        FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateLambda([Params, Promise, Out, Format, Batch, SendError, Stats, EnqueueTime](float DeltaTime) -> bool
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE(MCP_capture_views);
+            if (!Batch->IsValid())
+            {
+                Stats->QueueMs = MsSince(EnqueueTime);
+                UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+                if (!World)
                 {
-                    State->RenderTarget->RemoveFromRoot();
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), TEXT("Failed to spawn SceneCapture2D actor"));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
+                    SendError(TEXT("No editor world available"));
                     return false;
                 }
 
-                // Configure capture
-                USceneCaptureComponent2D* CC = State->CaptureActor->GetCaptureComponent2D();
-                CC->TextureTarget = State->RenderTarget;
-                CC->CaptureSource = ESceneCaptureSource::SCS_FinalColorLDR;
-                CC->bCaptureEveryFrame = false;
-                CC->bCaptureOnMovement = false;
-                CC->bAlwaysPersistRenderingState = true;
-                CC->FOVAngle = CameraFOV;
-                CC->HiddenActors.Add(State->CaptureActor);
-
-                if (UsedClient)
+                FMCPCaptureOptions Options;
+                if (Params->HasField(TEXT("width")))
                 {
-                    FExposureSettings ExpSettings = UsedClient->ExposureSettings;
-                    if (ExpSettings.bFixed)
-                    {
-                        CC->PostProcessBlendWeight = 1.0f;
-                        CC->PostProcessSettings.bOverride_AutoExposureMethod = true;
-                        CC->PostProcessSettings.AutoExposureMethod = EAutoExposureMethod::AEM_Manual;
-                        CC->PostProcessSettings.bOverride_AutoExposureBias = true;
-                        CC->PostProcessSettings.AutoExposureBias = ExpSettings.FixedEV100;
-                    }
+                    Options.Width = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("width"))), 64, 3840);
                 }
-
-                // Enqueue capture render commands — these will be processed by
-                // the render thread BETWEEN this tick and the next tick.
-                CC->CaptureScene();
-
-                UE_LOG(LogTemp, Display, TEXT("Screenshot Phase 0 complete: CaptureScene enqueued, waiting for render"));
-                State->Phase = 1;
-                State->FrameCount = 0;
-                return true; // Come back next tick
-            }
-            else if (State->Phase == 1)
-            {
-                // Wait 2 extra frames to ensure render thread has fully
-                // processed the CaptureScene commands.
-                State->FrameCount++;
-                if (State->FrameCount < 3)
+                if (Params->HasField(TEXT("height")))
                 {
-                    return true; // Wait more frames
+                    Options.Height = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("height"))), 64, 2160);
+                }
+                Params->TryGetStringField(TEXT("format"), Options.Format);
+                Options.Format = Options.Format.ToLower();
+                if (Options.Format == TEXT("jpg"))
+                {
+                    Options.Format = TEXT("jpeg");
+                }
+                if (Options.Format != TEXT("png") && Options.Format != TEXT("jpeg") && Options.Format != TEXT("bmp"))
+                {
+                    SendError(FString::Printf(TEXT("Unsupported format '%s' (expected png, jpeg or bmp)"), *Options.Format));
+                    return false;
+                }
+                if (Params->HasField(TEXT("quality")))
+                {
+                    Options.Quality = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("quality"))), 1, 100);
                 }
 
-                // === Phase 1: ReadPixels + encode + save + cleanup ===
-                UE_LOG(LogTemp, Display, TEXT("Screenshot Phase 1: ReadPixels after %d frames"), State->FrameCount);
-
-                TArray<FColor> Bitmap;
-                bool bReadOK = false;
-
-                FTextureRenderTargetResource* RTResource = State->RenderTarget->GameThread_GetRenderTargetResource();
-                if (RTResource)
+                FString Output = TEXT("file");
+                Params->TryGetStringField(TEXT("output"), Output);
+                if (Output != TEXT("file") && Output != TEXT("inline") && Output != TEXT("both"))
                 {
-                    bReadOK = RTResource->ReadPixels(Bitmap);
+                    SendError(FString::Printf(TEXT("Unsupported output '%s' (expected file, inline or both)"), *Output));
+                    return false;
                 }
+                Options.bInline = Output != TEXT("file");
 
-                // Cleanup capture actor
-                UEditorActorSubsystem* ActorSub = GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-                if (ActorSub && State->CaptureActor)
+                FString OutputDir;
+                if (Output != TEXT("inline") && !Params->TryGetStringField(TEXT("output_dir"), OutputDir))
                 {
-                    ActorSub->DestroyActor(State->CaptureActor);
+                    OutputDir = FPaths::ProjectSavedDir() / TEXT("Screenshots") / TEXT("MCP_Views");
                 }
-                State->CaptureActor = nullptr;
+                FString Prefix = TEXT("view");
+                Params->TryGetStringField(TEXT("prefix"), Prefix);
 
-                // Remove GC root from render target
-                State->RenderTarget->RemoveFromRoot();
+                // Views inherit the editor viewport's fixed exposure, like take_screenshot
+                FMCPCaptureView ViewportView;
+                FMCPCaptureRig::GetEditorViewportView(ViewportView, &Options);
 
-                if (!bReadOK)
+                TArray<FMCPCaptureView> Views;
+                const TArray<TSharedPtr<FJsonValue>>* ViewsJson = nullptr;
+                const TSharedPtr<FJsonObject>* OrbitJson = nullptr;
+                if (Params->TryGetArrayField(TEXT("views"), ViewsJson))
                 {
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), TEXT("Failed to read pixels from render target"));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
-                    return false;
+                    for (const TSharedPtr<FJsonValue>& ViewValue : *ViewsJson)
+                    {
+                        const TSharedPtr<FJsonObject> ViewObj = ViewValue->AsObject();
+                        if (!ViewObj.IsValid())
+                        {
+                            continue;
+                        }
+                        FMCPCaptureView View;
+                        View.Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(ViewObj, TEXT("location"));
+                        View.Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(ViewObj, TEXT("rotation"));
+                        View.FOV = ViewObj->HasField(TEXT("fov")) ? ViewObj->GetNumberField(TEXT("fov")) : ViewportView.FOV;
+                        Views.Add(View);
+                    }
                 }
+                else if (Params->TryGetObjectField(TEXT("orbit"), OrbitJson))
+                {
+                    const TSharedPtr<FJsonObject>& Orbit = *OrbitJson;
 
-                // Encode to PNG
-                IImageWrapperModule& IWM = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
-                TSharedPtr<IImageWrapper> ImgWrap = IWM.CreateImageWrapper(EImageFormat::PNG);
-                if (!ImgWrap.IsValid() ||
-                    !ImgWrap->SetRaw(Bitmap.GetData(), Bitmap.Num() * sizeof(FColor),
-                                     State->Width, State->Height, ERGBFormat::BGRA, 8))
+                    FVector Center = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Orbit, TEXT("center"));
+                    float Radius = 0.0f;
+                    FString ActorName;
+                    if (Orbit->TryGetStringField(TEXT("actor"), ActorName))
+                    {
+                        AActor* Target = FEpicUnrealMCPCommonUtils::FindActorByName(World, ActorName);
+                        if (!Target)
+                        {
+                            SendError(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+                            return false;
+                        }
+                        FVector Extent;
+                        Target->GetActorBounds(false, Center, Extent);
+                        Radius = FMath::Max(Extent.Size() * 2.5f, 100.0f);
+                    }
+                    if (Orbit->HasField(TEXT("radius")))
+                    {
+                        Radius = Orbit->GetNumberField(TEXT("radius"));
+                    }
+                    if (Radius <= 0.0f)
+                    {
+                        SendError(TEXT("orbit needs 'radius' (or an 'actor' to derive it from)"));
+                        return false;
+                    }
+
+                    const int32 Count = Orbit->HasField(TEXT("count"))
+                        ? FMath::Clamp(static_cast<int32>(Orbit->GetNumberField(TEXT("count"))), 1, 360) : 36;
+                    const float Pitch = Orbit->HasField(TEXT("pitch")) ? Orbit->GetNumberField(TEXT("pitch")) : -20.0f;
+                    const float StartYaw = Orbit->HasField(TEXT("start_yaw")) ? Orbit->GetNumberField(TEXT("start_yaw")) : 0.0f;
+                    const float FOV = Orbit->HasField(TEXT("fov")) ? Orbit->GetNumberField(TEXT("fov")) : 60.0f;
+                    FMCPCaptureRig::MakeOrbitViews(Center, Radius, Pitch, Count, StartYaw, FOV, Views);
+                }
+
+                if (Views.Num() == 0)
                 {
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), TEXT("PNG encoding failed"));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
+                    SendError(TEXT("capture_views needs a non-empty 'views' array or an 'orbit' object"));
                     return false;
                 }
-
-                TArray64<uint8> PNGData = ImgWrap->GetCompressed();
-                if (PNGData.Num() == 0 || !FFileHelper::SaveArrayToFile(PNGData, *State->FilePath))
+                if (Views.Num() > 360)
                 {
-                    TSharedPtr<FJsonObject> Err = MakeShareable(new FJsonObject);
-                    Err->SetStringField(TEXT("status"), TEXT("error"));
-                    Err->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to save screenshot to: %s"), *State->FilePath));
-                    FString ErrStr;
-                    TSharedRef<TJsonWriter<>> W = TJsonWriterFactory<>::Create(&ErrStr);
-                    FJsonSerializer::Serialize(Err.ToSharedRef(), W);
-                    Promise->SetValue(ErrStr);
+                    SendError(FString::Printf(TEXT("Too many views (%d, max 360)"), Views.Num()));
                     return false;
                 }
 
-                FString AbsPath = FPaths::ConvertRelativePathToFull(State->FilePath);
-
-                TSharedPtr<FJsonObject> Resp = MakeShareable(new FJsonObject);
-                Resp->SetStringField(TEXT("status"), TEXT("success"));
-                TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-                Result->SetBoolField(TEXT("success"), true);
-                Result->SetStringField(TEXT("file_path"), AbsPath);
-                Result->SetNumberField(TEXT("width"), State->Width);
-                Result->SetNumberField(TEXT("height"), State->Height);
-                Result->SetStringField(TEXT("message"), FString::Printf(
-                    TEXT("Screenshot saved: %dx%d to %s"), State->Width, State->Height, *AbsPath));
-                Resp->SetObjectField(TEXT("result"), Result);
-
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(Resp.ToSharedRef(), Writer);
-                Promise->SetValue(ResultString);
-
-                UE_LOG(LogTemp, Display, TEXT("Screenshot Phase 1 complete: saved %dx%d to %s"),
-                    State->Width, State->Height, *AbsPath);
-                return false; // Done
+                const int32 MaxInFlight = Params->HasField(TEXT("max_in_flight"))
+                    ? FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("max_in_flight"))), 1, 16) : 4;
+
+                *Batch = MakeShared<FMCPCaptureBatch>(World, Views, Options, OutputDir, Prefix, MaxInFlight);
             }
 
-            return false;
+            if (!(*Batch)->Tick())
+            {
+                return true;
+            }
+
+            TSharedPtr<FJsonObject> Result = (*Batch)->GetResult();
+
+            Stats->ExecMs = MsSince(EnqueueTime) - Stats->QueueMs;
+            const double SerializeStart = FPlatformTime::Seconds();
+            FMCPResponseWriter(*Out, Format).SuccessEnvelope(Result);
+            Stats->SerializeMs = MsSince(SerializeStart);
+            Promise->SetValue();
+
+            UE_LOG(LogTemp, Display, TEXT("capture_views: %d/%d view(s) in %.1f ms"),
+                static_cast<int32>(Result->GetNumberField(TEXT("captured"))),
+                static_cast<int32>(Result->GetArrayField(TEXT("views")).Num()), Result->GetNumberField(TEXT("total_ms")));
+            return false; // Done
         }));
 
-        return Future.Get();
+        WaitAndRecord();
+        return;
     }
 
     // Schedule execution during the next engine tick via FTSTicker.
@@ -508,10 +900,22 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
     // internally use the task graph (Nanite building, etc.) - running them inside
     // AsyncTask(GameThread) causes a TaskGraph RecursionGuard assertion crash.
     FTSTicker::GetCoreTicker().AddTicker(
-        FTickerDelegate::CreateLambda([this, CommandType, Params, Promise](float DeltaTime) -> bool
+        FTickerDelegate::CreateLambda([this, CommandType, Params, Promise, Out, Format, Stats, EnqueueTime](float DeltaTime) -> bool
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-        
+        Stats->QueueMs = MsSince(EnqueueTime);
+        const double ExecStart = FPlatformTime::Seconds();
+        // Named after the command so every handler shows up as its own scope in Unreal Insights
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*CommandType);
+
+        // Large read-only queries write their result straight into the response buffer
+        if (StreamCommand(CommandType, Params, *Out, Format, &Stats->bSuccess))
+        {
+            Stats->bStreamed = true;
+            Stats->ExecMs = MsSince(ExecStart);
+            Promise->SetValue();
+            return false;
+        }
+
         try
         {
             TSharedPtr<FJsonObject> ResultJson;
@@ -521,6 +925,10 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                 ResultJson = MakeShareable(new FJsonObject);
                 ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
             }
+            else if (CommandType == TEXT("benchmark_response_writer"))
+            {
+                ResultJson = BenchmarkResponseWriter(Params);
+            }
             // Editor Commands (including actor manipulation)
             else if (CommandType == TEXT("get_actors_in_level") ||
                      CommandType == TEXT("find_actors_by_name") ||
@@ -556,7 +964,14 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("scatter_foliage") ||
                      CommandType == TEXT("import_sound") ||
                      CommandType == TEXT("add_anim_notify") ||
-                     CommandType == TEXT("get_editor_log"))
+                     CommandType == TEXT("import_assets_batch") ||
+                     CommandType == TEXT("get_import_batch_status") ||
+                     CommandType == TEXT("set_save_policy") ||
+                     CommandType == TEXT("flush_dirty_packages") ||
+                     CommandType == TEXT("spawn_instanced_batch") ||
+                     CommandType == TEXT("consolidate_to_instances") ||
+                     CommandType == TEXT("get_bulk_channel_info") ||
+                     CommandType == TEXT("release_bulk"))
             {
                 ResultJson = EditorCommands->HandleCommand(CommandType, Params);
             }
@@ -603,20 +1018,26 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("rename_function") ||
                      CommandType == TEXT("add_enhanced_input_action_event") ||
                      CommandType == TEXT("create_input_action") ||
-                     CommandType == TEXT("add_input_mapping"))
+                     CommandType == TEXT("add_input_mapping") ||
+                     CommandType == TEXT("begin_blueprint_edit") ||
+                     CommandType == TEXT("commit_blueprint_edit") ||
+                     CommandType == TEXT("build_blueprint_graph"))
             {
                 ResultJson = BlueprintGraphCommands->HandleCommand(CommandType, Params);
             }
             // Material Graph Commands
             else if (CommandType == TEXT("create_material_asset") ||
                      CommandType == TEXT("get_material_graph") ||
+                     CommandType == TEXT("build_material_graph") ||
                      CommandType == TEXT("add_material_expression") ||
                      CommandType == TEXT("connect_material_expressions") ||
                      CommandType == TEXT("connect_to_material_output") ||
                      CommandType == TEXT("set_material_expression_property") ||
                      CommandType == TEXT("delete_material_expression") ||
                      CommandType == TEXT("recompile_material") ||
-                     CommandType == TEXT("configure_landscape_layer_blend"))
+                     CommandType == TEXT("configure_landscape_layer_blend") ||
+                     CommandType == TEXT("begin_material_edit") ||
+                     CommandType == TEXT("commit_material_edit"))
             {
                 ResultJson = MaterialGraphCommands->HandleCommand(CommandType, Params);
             }
@@ -665,15 +1086,13 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
             }
             else
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise->SetValue(ResultString);
+                Stats->bSuccess = false;
+                Stats->Error = FString::Printf(TEXT("Unknown command: %s"), *CommandType);
+                FMCPResponseWriter(*Out, Format).ErrorEnvelope(Stats->Error);
+                Promise->SetValue();
                 return false;
             }
+            Stats->ExecMs = MsSince(ExecStart);
             
             // Check if the result contains an error
             bool bSuccess = true;
@@ -688,31 +1107,33 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                 }
             }
             
+            // Write the envelope around the handler's result directly (no wrapper object, no FString)
+            TRACE_CPUPROFILER_EVENT_SCOPE(MCP_SerializeResponse);
+            const double SerializeStart = FPlatformTime::Seconds();
+            Stats->bSuccess = bSuccess;
+            Stats->Error = ErrorMessage;
             if (bSuccess)
             {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                FMCPResponseWriter(*Out, Format).SuccessEnvelope(ResultJson);
             }
             else
             {
-                // Set error status and include the error message
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                FMCPResponseWriter(*Out, Format).ErrorEnvelope(ErrorMessage);
             }
+            Stats->SerializeMs = MsSince(SerializeStart);
         }
         catch (const std::exception& e)
         {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            Stats->bSuccess = false;
+            Stats->Error = UTF8_TO_TCHAR(e.what());
+            Stats->ExecMs = MsSince(ExecStart);
+            Out->Reset();
+            FMCPResponseWriter(*Out, Format).ErrorEnvelope(UTF8_TO_TCHAR(e.what()));
         }
-        
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise->SetValue(ResultString);
+
+        Promise->SetValue();
         return false; // Execute once, don't repeat
     }));
 
-    return Future.Get();
+    WaitAndRecord();
 }
@@ -1,5 +1,13 @@
 #include "EpicUnrealMCPModule.h"
 #include "EpicUnrealMCPBridge.h"
+#include "Commands/BlueprintGraph/BPGraphCache.h"
+#include "Commands/BlueprintGraph/BPEditSession.h"
+#include "Commands/EpicUnrealMCPPackageSaver.h"
+#include "MCPCaptureRig.h"
+#include "MCPBulkChannel.h"
+#include "MCPLogCapture.h"
+#include "MCPEventHub.h"
+#include "MCPSceneJournal.h"
 #include "Modules/ModuleManager.h"
 #include "EditorSubsystem.h"
 #include "Editor.h"
@@ -8,12 +16,26 @@
 
 void FEpicUnrealMCPModule::StartupModule()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== UnrealMCP BUILD_ID=2026-02-16-v14 LOADED ==="));
+	UE_LOG(LogTemp, Warning, TEXT("=== UnrealMCP BUILD_ID=2026-02-16-v39 LOADED ==="));
 	UE_LOG(LogTemp, Display, TEXT("Epic Unreal MCP Module has started"));
+	// Capture from here on so get_editor_log never has to re-read the log file
+	FMCPLogCapture::Start();
 }
 
 void FEpicUnrealMCPModule::ShutdownModule()
 {
+	// Graph change handlers are bound to this module's code
+	FBPGraphCache::Reset();
+	FBPEditSession::Reset();
+	FMCPCaptureRig::Reset();
+	// The deferred save ticker calls into this module
+	FEpicUnrealMCPPackageSaver::Shutdown();
+	// Bulk segments only live as long as the editor session
+	FMCPBulkChannel::ReleaseAll();
+	// Editor delegates of event subscriptions are bound to this module's code
+	FMCPEventHub::Shutdown();
+	FMCPSceneJournal::Stop();
+	FMCPLogCapture::Stop();
 	UE_LOG(LogTemp, Display, TEXT("Epic Unreal MCP Module has shut down"));
 }
 
@@ -0,0 +1,258 @@
+#include "MCPBulkChannel.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Bulk segments are little-endian arrays mapped in place");
+
+namespace
+{
+    const TCHAR* SegmentExtension = TEXT(".bin");
+
+    FString SegmentPath(const FString& Handle)
+    {
+        return FMCPBulkChannel::GetDirectory() / Handle + SegmentExtension;
+    }
+}
+
+FMCPBulkMapping::FMCPBulkMapping() = default;
+FMCPBulkMapping::~FMCPBulkMapping()
+{
+    // The region must be unmapped before its file handle closes
+    Region.Reset();
+    File.Reset();
+}
+FMCPBulkMapping::FMCPBulkMapping(FMCPBulkMapping&&) = default;
+FMCPBulkMapping& FMCPBulkMapping::operator=(FMCPBulkMapping&&) = default;
+
+FString FMCPBulkChannel::GetDirectory()
+{
+    return FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("MCP") / TEXT("Bulk"));
+}
+
+bool FMCPBulkChannel::IsValidHandle(const FString& Handle)
+{
+    if (Handle.IsEmpty() || Handle.Len() > 64)
+    {
+        return false;
+    }
+    for (TCHAR Char : Handle)
+    {
+        if (!FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('-'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32 FMCPBulkChannel::GetElementSize(const FString& Type)
+{
+    if (Type == TEXT("float32") || Type == TEXT("int32"))
+    {
+        return 4;
+    }
+    if (Type == TEXT("float64"))
+    {
+        return 8;
+    }
+    if (Type == TEXT("uint8"))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+bool FMCPBulkChannel::Map(const TSharedPtr<FJsonObject>& Descriptor, FMCPBulkMapping& OutMapping, FString& OutError)
+{
+    FString Handle;
+    if (!Descriptor.IsValid() || !Descriptor->TryGetStringField(TEXT("handle"), Handle) || !IsValidHandle(Handle))
+    {
+        OutError = TEXT("Bulk descriptor needs a valid 'handle'");
+        return false;
+    }
+
+    FString Type = TEXT("float32");
+    Descriptor->TryGetStringField(TEXT("type"), Type);
+    const int32 ElementSize = GetElementSize(Type);
+    if (ElementSize == 0)
+    {
+        OutError = FString::Printf(TEXT("Unsupported bulk type '%s' (expected float32, int32, float64 or uint8)"), *Type);
+        return false;
+    }
+
+    double CountD = -1.0;
+    double OffsetD = 0.0;
+    Descriptor->TryGetNumberField(TEXT("count"), CountD);
+    Descriptor->TryGetNumberField(TEXT("offset"), OffsetD);
+    const int64 Offset = static_cast<int64>(OffsetD);
+    if (Offset < 0)
+    {
+        OutError = TEXT("Bulk 'offset' must not be negative");
+        return false;
+    }
+
+    const FString Path = SegmentPath(Handle);
+    FOpenMappedResult Opened = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*Path);
+    if (Opened.HasError())
+    {
+        OutError = FString::Printf(TEXT("Cannot map bulk segment '%s': %s"), *Handle, *Opened.GetError().GetMessage());
+        return false;
+    }
+    TUniquePtr<IMappedFileHandle> File = Opened.StealValue();
+
+    const int64 FileSize = File->GetFileSize();
+    // count is optional: default to everything past offset
+    const int64 Count = CountD >= 0.0 ? static_cast<int64>(CountD) : (FileSize - Offset) / ElementSize;
+    const int64 Bytes = Count * ElementSize;
+    if (Offset + Bytes > FileSize)
+    {
+        OutError = FString::Printf(TEXT("Bulk segment '%s' holds %lld bytes, descriptor needs %lld"), *Handle, FileSize, Offset + Bytes);
+        return false;
+    }
+
+    OutMapping.Type = Type;
+    OutMapping.Count = Count;
+    OutMapping.Data = nullptr;
+    if (Bytes > 0)
+    {
+        OutMapping.Region.Reset(File->MapRegion(Offset, Bytes));
+        if (!OutMapping.Region.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Failed to map %lld bytes of bulk segment '%s'"), Bytes, *Handle);
+            return false;
+        }
+        OutMapping.Data = OutMapping.Region->GetMappedPtr();
+    }
+    OutMapping.File = MoveTemp(File);
+    return true;
+}
+
+bool FMCPBulkChannel::ReadFloats(const TSharedPtr<FJsonObject>& Descriptor, TArray<float>& OutValues, FString& OutError)
+{
+    FMCPBulkMapping Mapping;
+    if (!Map(Descriptor, Mapping, OutError))
+    {
+        return false;
+    }
+    if (Mapping.Count > MAX_int32)
+    {
+        OutError = TEXT("Bulk segment too large");
+        return false;
+    }
+
+    OutValues.SetNumUninitialized(static_cast<int32>(Mapping.Count));
+    if (Mapping.Type == TEXT("float32"))
+    {
+        FMemory::Memcpy(OutValues.GetData(), Mapping.Data, Mapping.Count * sizeof(float));
+    }
+    else if (Mapping.Type == TEXT("float64"))
+    {
+        TConstArrayView64<double> Values = Mapping.As<double>();
+        for (int32 i = 0; i < OutValues.Num(); ++i)
+        {
+            OutValues[i] = static_cast<float>(Values[i]);
+        }
+    }
+    else if (Mapping.Type == TEXT("int32"))
+    {
+        TConstArrayView64<int32> Values = Mapping.As<int32>();
+        for (int32 i = 0; i < OutValues.Num(); ++i)
+        {
+            OutValues[i] = static_cast<float>(Values[i]);
+        }
+    }
+    else
+    {
+        OutError = FString::Printf(TEXT("Expected a numeric bulk segment, got %s"), *Mapping.Type);
+        return false;
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> FMCPBulkChannel::Write(const void* Data, int64 Bytes, const FString& Type, FString& OutError)
+{
+    const int32 ElementSize = GetElementSize(Type);
+    if (ElementSize == 0 || Bytes % ElementSize != 0)
+    {
+        OutError = FString::Printf(TEXT("Invalid bulk write (%lld bytes of %s)"), Bytes, *Type);
+        return nullptr;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.CreateDirectoryTree(*GetDirectory());
+
+    const FString Handle = TEXT("ue_") + FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+    const FString Path = SegmentPath(Handle);
+
+    // Write under a temporary name so the client never maps a half-written segment
+    const FString TempPath = Path + TEXT(".tmp");
+    {
+        TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*TempPath));
+        if (!File.IsValid() || (Bytes > 0 && !File->Write(static_cast<const uint8*>(Data), Bytes)))
+        {
+            File.Reset();
+            PlatformFile.DeleteFile(*TempPath);
+            OutError = FString::Printf(TEXT("Failed to write bulk segment: %s"), *Path);
+            return nullptr;
+        }
+    }
+    if (!PlatformFile.MoveFile(*Path, *TempPath))
+    {
+        PlatformFile.DeleteFile(*TempPath);
+        OutError = FString::Printf(TEXT("Failed to publish bulk segment: %s"), *Path);
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Descriptor = MakeShared<FJsonObject>();
+    Descriptor->SetStringField(TEXT("handle"), Handle);
+    Descriptor->SetStringField(TEXT("type"), Type);
+    Descriptor->SetNumberField(TEXT("count"), static_cast<double>(Bytes / ElementSize));
+    Descriptor->SetNumberField(TEXT("offset"), 0);
+    Descriptor->SetStringField(TEXT("path"), Path);
+    return Descriptor;
+}
+
+bool FMCPBulkChannel::Release(const FString& Handle)
+{
+    return IsValidHandle(Handle) && FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*SegmentPath(Handle));
+}
+
+int32 FMCPBulkChannel::ReleaseAll()
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    TArray<FString> Files;
+    PlatformFile.FindFiles(Files, *GetDirectory(), nullptr);
+
+    int32 Removed = 0;
+    for (const FString& File : Files)
+    {
+        if (PlatformFile.DeleteFile(*File))
+        {
+            ++Removed;
+        }
+    }
+    return Removed;
+}
+
+TArray<TSharedPtr<FJsonValue>> FMCPBulkChannel::ListSegments(int64& OutTotalBytes)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    TArray<FString> Files;
+    PlatformFile.FindFiles(Files, *GetDirectory(), SegmentExtension);
+
+    TArray<TSharedPtr<FJsonValue>> Segments;
+    OutTotalBytes = 0;
+    for (const FString& File : Files)
+    {
+        const int64 Size = PlatformFile.FileSize(*File);
+        OutTotalBytes += FMath::Max<int64>(Size, 0);
+
+        TSharedPtr<FJsonObject> Segment = MakeShared<FJsonObject>();
+        Segment->SetStringField(TEXT("handle"), FPaths::GetBaseFilename(File));
+        Segment->SetNumberField(TEXT("bytes"), static_cast<double>(Size));
+        Segments.Add(MakeShared<FJsonValueObject>(Segment));
+    }
+    return Segments;
+}
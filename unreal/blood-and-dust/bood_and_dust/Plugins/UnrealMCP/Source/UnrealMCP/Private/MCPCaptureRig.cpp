@@ -0,0 +1,513 @@
+#include "MCPCaptureRig.h"
+#include "MCPBulkChannel.h"
+#include "Editor.h"
+#include "LevelEditorViewport.h"
+#include "Engine/SceneCapture2D.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RHIGPUReadback.h"
+#include "RenderingThread.h"
+#include "IImageWrapperModule.h"
+#include "IImageWrapper.h"
+#include "Async/Async.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace
+{
+    // A readback that never completes (device lost, RT resized underneath) must not hang the command
+    constexpr double ReadbackTimeoutSeconds = 10.0;
+    constexpr int32 MaxPooledTargets = 4;
+
+    TWeakObjectPtr<ASceneCapture2D> GCaptureActor;
+    // Rooted render targets, most recently used last
+    TArray<UTextureRenderTarget2D*> GTargetPool;
+
+    ASceneCapture2D* GetCaptureActor(UWorld* World)
+    {
+        ASceneCapture2D* Actor = GCaptureActor.Get();
+        if (Actor && Actor->GetWorld() == World)
+        {
+            return Actor;
+        }
+        if (Actor)
+        {
+            Actor->Destroy();
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnParams.ObjectFlags = RF_Transient;
+        SpawnParams.bTemporaryEditorActor = true;
+        SpawnParams.bHideFromSceneOutliner = true;
+
+        Actor = World->SpawnActor<ASceneCapture2D>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+        if (!Actor)
+        {
+            return nullptr;
+        }
+
+        USceneCaptureComponent2D* CC = Actor->GetCaptureComponent2D();
+        CC->CaptureSource = ESceneCaptureSource::SCS_FinalColorLDR;
+        CC->bCaptureEveryFrame = false;
+        CC->bCaptureOnMovement = false;
+        CC->bAlwaysPersistRenderingState = true;
+        CC->HiddenActors.Add(Actor);
+
+        GCaptureActor = Actor;
+        UE_LOG(LogTemp, Display, TEXT("MCPCaptureRig: Spawned capture actor in %s"), *World->GetName());
+        return Actor;
+    }
+
+    UTextureRenderTarget2D* GetRenderTarget(int32 Width, int32 Height)
+    {
+        for (int32 i = 0; i < GTargetPool.Num(); ++i)
+        {
+            UTextureRenderTarget2D* Target = GTargetPool[i];
+            if (Target->SizeX == Width && Target->SizeY == Height)
+            {
+                GTargetPool.RemoveAt(i);
+                GTargetPool.Add(Target);
+                return Target;
+            }
+        }
+
+        if (GTargetPool.Num() >= MaxPooledTargets)
+        {
+            GTargetPool[0]->RemoveFromRoot();
+            GTargetPool.RemoveAt(0);
+        }
+
+        UTextureRenderTarget2D* Target = NewObject<UTextureRenderTarget2D>();
+        Target->AddToRoot();
+        Target->InitCustomFormat(Width, Height, PF_B8G8R8A8, true);
+        Target->UpdateResourceImmediate(false);
+        GTargetPool.Add(Target);
+        return Target;
+    }
+
+    TSharedPtr<FJsonObject> EncodeCapture(IImageWrapperModule* ImageWrapper, TArray<FColor>& Pixels, const FMCPCaptureOptions& Options)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+
+        // Scene capture alpha is not meaningful; keep screenshots opaque
+        for (FColor& Pixel : Pixels)
+        {
+            Pixel.A = 255;
+        }
+
+        // Raw pixels go straight into shared memory, no encode
+        if (Options.Format.Equals(TEXT("raw"), ESearchCase::IgnoreCase))
+        {
+            FString Error;
+            TSharedPtr<FJsonObject> Descriptor = FMCPBulkChannel::Write(Pixels.GetData(), Pixels.Num() * sizeof(FColor), TEXT("uint8"), Error);
+            if (!Descriptor.IsValid())
+            {
+                Result->SetBoolField(TEXT("success"), false);
+                Result->SetStringField(TEXT("error"), Error);
+                return Result;
+            }
+            Descriptor->SetStringField(TEXT("pixel_format"), TEXT("BGRA8"));
+            Result->SetBoolField(TEXT("success"), true);
+            Result->SetObjectField(TEXT("bulk"), Descriptor);
+            Result->SetStringField(TEXT("format"), TEXT("raw"));
+            Result->SetNumberField(TEXT("width"), Options.Width);
+            Result->SetNumberField(TEXT("height"), Options.Height);
+            Result->SetNumberField(TEXT("bytes"), (double)(Pixels.Num() * sizeof(FColor)));
+            Result->SetNumberField(TEXT("encode_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            return Result;
+        }
+
+        EImageFormat Format = EImageFormat::PNG;
+        if (Options.Format.Equals(TEXT("jpeg"), ESearchCase::IgnoreCase) || Options.Format.Equals(TEXT("jpg"), ESearchCase::IgnoreCase))
+        {
+            Format = EImageFormat::JPEG;
+        }
+        else if (Options.Format.Equals(TEXT("bmp"), ESearchCase::IgnoreCase))
+        {
+            Format = EImageFormat::BMP;
+        }
+
+        TSharedPtr<IImageWrapper> Wrapper = ImageWrapper->CreateImageWrapper(Format);
+        if (!Wrapper.IsValid() ||
+            !Wrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Options.Width, Options.Height, ERGBFormat::BGRA, 8))
+        {
+            Result->SetBoolField(TEXT("success"), false);
+            Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%s encoding failed"), *Options.Format.ToUpper()));
+            return Result;
+        }
+
+        const TArray64<uint8> Encoded = Wrapper->GetCompressed(Format == EImageFormat::JPEG ? FMath::Clamp(Options.Quality, 1, 100) : 0);
+        if (Encoded.Num() == 0)
+        {
+            Result->SetBoolField(TEXT("success"), false);
+            Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%s encoding produced no data"), *Options.Format.ToUpper()));
+            return Result;
+        }
+
+        if (!Options.FilePath.IsEmpty())
+        {
+            FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*FPaths::GetPath(Options.FilePath));
+            if (!FFileHelper::SaveArrayToFile(Encoded, *Options.FilePath))
+            {
+                Result->SetBoolField(TEXT("success"), false);
+                Result->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to save screenshot to: %s"), *Options.FilePath));
+                return Result;
+            }
+            Result->SetStringField(TEXT("file_path"), FPaths::ConvertRelativePathToFull(Options.FilePath));
+        }
+
+        if (Options.bInline)
+        {
+            Result->SetStringField(TEXT("image_base64"), FBase64::Encode(Encoded.GetData(), (uint32)Encoded.Num()));
+        }
+
+        if (Options.bBulk)
+        {
+            FString Error;
+            TSharedPtr<FJsonObject> Descriptor = FMCPBulkChannel::Write(Encoded.GetData(), Encoded.Num(), TEXT("uint8"), Error);
+            if (!Descriptor.IsValid())
+            {
+                Result->SetBoolField(TEXT("success"), false);
+                Result->SetStringField(TEXT("error"), Error);
+                return Result;
+            }
+            Result->SetObjectField(TEXT("bulk"), Descriptor);
+        }
+
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetStringField(TEXT("format"), Format == EImageFormat::JPEG ? TEXT("jpeg") : (Format == EImageFormat::BMP ? TEXT("bmp") : TEXT("png")));
+        Result->SetNumberField(TEXT("width"), Options.Width);
+        Result->SetNumberField(TEXT("height"), Options.Height);
+        Result->SetNumberField(TEXT("bytes"), (double)Encoded.Num());
+        Result->SetNumberField(TEXT("encode_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        return Result;
+    }
+}
+
+bool FMCPCaptureJob::Tick()
+{
+    if (Result.IsValid())
+    {
+        return true;
+    }
+
+    if (!bEncoding)
+    {
+        if (bPixelsReady.load())
+        {
+            ReadbackMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+            bEncoding = true;
+            Encode = Async(EAsyncExecution::ThreadPool, [Self = AsShared()]()
+            {
+                return EncodeCapture(Self->ImageWrapper, Self->Pixels, Self->Options);
+            });
+        }
+        else if (FPlatformTime::Seconds() - StartTime > ReadbackTimeoutSeconds)
+        {
+            Fail(TEXT("Timed out waiting for GPU readback"));
+            return true;
+        }
+        else if (!bPollInFlight.exchange(true))
+        {
+            // Fence checks and Lock() belong on the render thread
+            ENQUEUE_RENDER_COMMAND(MCPCapturePollReadback)([Self = AsShared()](FRHICommandListImmediate& RHICmdList)
+            {
+                Self->PollReadback_RenderThread();
+                Self->bPollInFlight = false;
+            });
+        }
+    }
+
+    if (bEncoding && Encode.IsReady())
+    {
+        Result = Encode.Get();
+        Result->SetNumberField(TEXT("readback_ms"), ReadbackMs);
+        Result->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        Pixels.Empty();
+        return true;
+    }
+    return false;
+}
+
+void FMCPCaptureJob::PollReadback_RenderThread()
+{
+    if (bPixelsReady.load() || !Readback->IsReady())
+    {
+        return;
+    }
+
+    int32 RowPitchInPixels = 0;
+    const FColor* Source = static_cast<const FColor*>(Readback->Lock(RowPitchInPixels));
+    if (Source)
+    {
+        // Staging rows are padded to the RHI's pitch
+        Pixels.SetNumUninitialized(Options.Width * Options.Height);
+        for (int32 Row = 0; Row < Options.Height; ++Row)
+        {
+            FMemory::Memcpy(&Pixels[Row * Options.Width], Source + Row * RowPitchInPixels, Options.Width * sizeof(FColor));
+        }
+    }
+    Readback->Unlock();
+
+    bPixelsReady = true;
+}
+
+void FMCPCaptureJob::Fail(const FString& Error)
+{
+    Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), false);
+    Result->SetStringField(TEXT("error"), Error);
+}
+
+TSharedPtr<FMCPCaptureJob, ESPMode::ThreadSafe> FMCPCaptureRig::Capture(UWorld* World, const FMCPCaptureView& View,
+    const FMCPCaptureOptions& Options, FString& OutError)
+{
+    if (!World)
+    {
+        OutError = TEXT("No editor world available");
+        return nullptr;
+    }
+
+    ASceneCapture2D* Actor = GetCaptureActor(World);
+    if (!Actor)
+    {
+        OutError = TEXT("Failed to spawn SceneCapture2D actor");
+        return nullptr;
+    }
+
+    UTextureRenderTarget2D* RenderTarget = GetRenderTarget(Options.Width, Options.Height);
+    FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+    if (!RTResource)
+    {
+        OutError = TEXT("Render target has no resource");
+        return nullptr;
+    }
+
+    Actor->SetActorLocationAndRotation(View.Location, View.Rotation);
+
+    USceneCaptureComponent2D* CC = Actor->GetCaptureComponent2D();
+    CC->TextureTarget = RenderTarget;
+    CC->FOVAngle = View.FOV;
+    CC->PostProcessBlendWeight = Options.bFixedExposure ? 1.0f : 0.0f;
+    CC->PostProcessSettings.bOverride_AutoExposureMethod = Options.bFixedExposure;
+    CC->PostProcessSettings.AutoExposureMethod = EAutoExposureMethod::AEM_Manual;
+    CC->PostProcessSettings.bOverride_AutoExposureBias = Options.bFixedExposure;
+    CC->PostProcessSettings.AutoExposureBias = Options.FixedEV100;
+
+    TSharedPtr<FMCPCaptureJob, ESPMode::ThreadSafe> Job = MakeShared<FMCPCaptureJob, ESPMode::ThreadSafe>();
+    Job->Options = Options;
+    Job->ImageWrapper = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+    Job->Readback = MakeShared<FRHIGPUTextureReadback>(TEXT("MCPCaptureReadback"));
+    Job->StartTime = FPlatformTime::Seconds();
+
+    // Enqueues the scene render; the copy below is ordered after it on the render thread
+    CC->CaptureScene();
+
+    ENQUEUE_RENDER_COMMAND(MCPCaptureEnqueueCopy)([Readback = Job->Readback, RTResource](FRHICommandListImmediate& RHICmdList)
+    {
+        Readback->EnqueueCopy(RHICmdList, RTResource->GetRenderTargetTexture());
+    });
+
+    return Job;
+}
+
+bool FMCPCaptureRig::GetEditorViewportView(FMCPCaptureView& OutView, FMCPCaptureOptions* OutOptions)
+{
+    if (!GEditor)
+    {
+        return false;
+    }
+
+    FLevelEditorViewportClient* UsedClient = nullptr;
+    const TArray<FLevelEditorViewportClient*>& LevelViewports = GEditor->GetLevelViewportClients();
+    for (FLevelEditorViewportClient* VC : LevelViewports)
+    {
+        if (VC && VC->IsPerspective())
+        {
+            UsedClient = VC;
+            break;
+        }
+    }
+    if (!UsedClient)
+    {
+        for (FLevelEditorViewportClient* VC : LevelViewports)
+        {
+            if (VC)
+            {
+                UsedClient = VC;
+                break;
+            }
+        }
+    }
+    if (!UsedClient)
+    {
+        return false;
+    }
+
+    OutView.Location = UsedClient->GetViewLocation();
+    OutView.Rotation = UsedClient->GetViewRotation();
+    OutView.FOV = UsedClient->ViewFOV;
+
+    if (OutOptions)
+    {
+        const FExposureSettings& ExpSettings = UsedClient->ExposureSettings;
+        OutOptions->bFixedExposure = ExpSettings.bFixed;
+        OutOptions->FixedEV100 = ExpSettings.FixedEV100;
+    }
+    return true;
+}
+
+void FMCPCaptureRig::MakeOrbitViews(const FVector& Center, float Radius, float Pitch, int32 Count, float StartYaw, float FOV,
+    TArray<FMCPCaptureView>& OutViews)
+{
+    OutViews.Reserve(OutViews.Num() + Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FRotator LookRotation(Pitch, StartYaw + 360.0f * i / Count, 0.0f);
+
+        FMCPCaptureView View;
+        View.Location = Center - LookRotation.Vector() * Radius;
+        View.Rotation = LookRotation;
+        View.FOV = FOV;
+        OutViews.Add(View);
+    }
+}
+
+void FMCPCaptureRig::Reset()
+{
+    if (ASceneCapture2D* Actor = GCaptureActor.Get())
+    {
+        Actor->Destroy();
+    }
+    GCaptureActor.Reset();
+
+    for (UTextureRenderTarget2D* Target : GTargetPool)
+    {
+        Target->RemoveFromRoot();
+    }
+    GTargetPool.Reset();
+}
+
+FMCPCaptureBatch::FMCPCaptureBatch(UWorld* InWorld, const TArray<FMCPCaptureView>& InViews, const FMCPCaptureOptions& InOptions,
+    const FString& InOutputDir, const FString& InPrefix, int32 InMaxInFlight)
+    : World(InWorld)
+    , Views(InViews)
+    , Options(InOptions)
+    , OutputDir(InOutputDir)
+    , Prefix(InPrefix)
+    , MaxInFlight(FMath::Max(InMaxInFlight, 1))
+{
+    Jobs.SetNum(Views.Num());
+    ViewResults.SetNum(Views.Num());
+    StartTime = FPlatformTime::Seconds();
+}
+
+bool FMCPCaptureBatch::Tick()
+{
+    if (Result.IsValid())
+    {
+        return true;
+    }
+
+    int32 InFlight = 0;
+    int32 Finished = 0;
+    for (int32 i = 0; i < NextView; ++i)
+    {
+        if (ViewResults[i].IsValid())
+        {
+            ++Finished;
+        }
+        else if (Jobs[i]->Tick())
+        {
+            ViewResults[i] = Jobs[i]->GetResult();
+            Jobs[i].Reset();
+            ++Finished;
+        }
+        else
+        {
+            ++InFlight;
+        }
+    }
+
+    // Every capture shares the rig's actor and render target; render commands run in order,
+    // so the next view can be rendered as soon as the previous readback copy is enqueued
+    const FString Extension = Options.Format == TEXT("jpeg") ? TEXT("jpg") : Options.Format;
+    while (InFlight < MaxInFlight && NextView < Views.Num())
+    {
+        const int32 Index = NextView++;
+
+        FMCPCaptureOptions ViewOptions = Options;
+        ViewOptions.FilePath = OutputDir.IsEmpty()
+            ? FString()
+            : OutputDir / FString::Printf(TEXT("%s_%03d.%s"), *Prefix, Index, *Extension);
+
+        FString Error;
+        Jobs[Index] = FMCPCaptureRig::Capture(World.Get(), Views[Index], ViewOptions, Error);
+        if (!Jobs[Index].IsValid())
+        {
+            ViewResults[Index] = MakeShared<FJsonObject>();
+            ViewResults[Index]->SetBoolField(TEXT("success"), false);
+            ViewResults[Index]->SetStringField(TEXT("error"), Error);
+            ++Finished;
+            continue;
+        }
+        ++InFlight;
+    }
+
+    if (Finished < Views.Num())
+    {
+        return false;
+    }
+
+    int32 Captured = 0;
+    TArray<TSharedPtr<FJsonValue>> ViewArray;
+    for (int32 i = 0; i < Views.Num(); ++i)
+    {
+        TSharedPtr<FJsonObject> ViewResult = ViewResults[i];
+        ViewResult->SetNumberField(TEXT("index"), i);
+
+        TArray<TSharedPtr<FJsonValue>> Location;
+        Location.Add(MakeShared<FJsonValueNumber>(Views[i].Location.X));
+        Location.Add(MakeShared<FJsonValueNumber>(Views[i].Location.Y));
+        Location.Add(MakeShared<FJsonValueNumber>(Views[i].Location.Z));
+        ViewResult->SetArrayField(TEXT("location"), Location);
+
+        TArray<TSharedPtr<FJsonValue>> Rotation;
+        Rotation.Add(MakeShared<FJsonValueNumber>(Views[i].Rotation.Pitch));
+        Rotation.Add(MakeShared<FJsonValueNumber>(Views[i].Rotation.Yaw));
+        Rotation.Add(MakeShared<FJsonValueNumber>(Views[i].Rotation.Roll));
+        ViewResult->SetArrayField(TEXT("rotation"), Rotation);
+
+        if (ViewResult->GetBoolField(TEXT("success")))
+        {
+            ++Captured;
+        }
+        ViewArray.Add(MakeShared<FJsonValueObject>(ViewResult));
+    }
+
+    const double TotalMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), Captured == Views.Num());
+    Result->SetNumberField(TEXT("captured"), Captured);
+    Result->SetNumberField(TEXT("failed"), Views.Num() - Captured);
+    Result->SetNumberField(TEXT("width"), Options.Width);
+    Result->SetNumberField(TEXT("height"), Options.Height);
+    Result->SetStringField(TEXT("format"), Options.Format);
+    Result->SetNumberField(TEXT("total_ms"), TotalMs);
+    Result->SetNumberField(TEXT("ms_per_view"), Views.Num() > 0 ? TotalMs / Views.Num() : 0.0);
+    Result->SetArrayField(TEXT("views"), ViewArray);
+    if (!OutputDir.IsEmpty())
+    {
+        Result->SetStringField(TEXT("output_dir"), FPaths::ConvertRelativePathToFull(OutputDir));
+    }
+    if (Captured < Views.Num())
+    {
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d of %d view(s) failed"), Views.Num() - Captured, Views.Num()));
+    }
+    return true;
+}
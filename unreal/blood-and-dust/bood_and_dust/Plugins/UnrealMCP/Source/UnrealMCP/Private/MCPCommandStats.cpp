@@ -0,0 +1,194 @@
+#include "MCPCommandStats.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // Smallest bucket bound; everything faster lands in bucket 0
+    constexpr double HistogramBaseMs = 0.001;
+    constexpr double BucketsPerOctave = 4.0;
+
+    struct FStatsState
+    {
+        FCriticalSection Lock;
+        TMap<FString, FMCPCommandStatsEntry> Commands;
+        double StartSeconds = FPlatformTime::Seconds();
+    };
+
+    FStatsState& GetState()
+    {
+        static FStatsState State;
+        return State;
+    }
+
+    double BucketUpperBound(int32 Bucket)
+    {
+        return HistogramBaseMs * FMath::Pow(2.0, (Bucket + 1) / BucketsPerOctave);
+    }
+}
+
+void FMCPLatencyHistogram::Add(double Ms)
+{
+    Ms = FMath::Max(Ms, 0.0);
+    const int32 Bucket = Ms <= HistogramBaseMs
+        ? 0
+        : FMath::Clamp(FMath::FloorToInt32(FMath::Log2(Ms / HistogramBaseMs) * BucketsPerOctave), 0, NumBuckets - 1);
+    ++Buckets[Bucket];
+    ++Count;
+    SumMs += Ms;
+    MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+double FMCPLatencyHistogram::Percentile(double P) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+    const int64 Rank = FMath::Max<int64>(1, FMath::CeilToInt64(Count * P / 100.0));
+    int64 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Rank)
+        {
+            // The bucket bound can overshoot the largest sample actually seen
+            return FMath::Min(BucketUpperBound(Bucket), MaxMs);
+        }
+    }
+    return MaxMs;
+}
+
+TSharedPtr<FJsonObject> FMCPLatencyHistogram::ToJson() const
+{
+    TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+    Object->SetNumberField(TEXT("mean_ms"), Count > 0 ? SumMs / Count : 0.0);
+    Object->SetNumberField(TEXT("p50_ms"), Percentile(50.0));
+    Object->SetNumberField(TEXT("p95_ms"), Percentile(95.0));
+    Object->SetNumberField(TEXT("p99_ms"), Percentile(99.0));
+    Object->SetNumberField(TEXT("max_ms"), MaxMs);
+    return Object;
+}
+
+void FMCPCommandStats::Record(const FString& CommandType, const FMCPCommandSample& Sample)
+{
+    FStatsState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+
+    FMCPCommandStatsEntry& Entry = State.Commands.FindOrAdd(CommandType);
+    ++Entry.Count;
+    Entry.Errors += Sample.bSuccess ? 0 : 1;
+    Entry.Streamed += Sample.bStreamed ? 1 : 0;
+    Entry.BytesIn += Sample.BytesIn;
+    Entry.BytesOut += Sample.BytesOut;
+    Entry.MaxBytesOut = FMath::Max(Entry.MaxBytesOut, Sample.BytesOut);
+    Entry.Queue.Add(Sample.QueueMs);
+    Entry.Exec.Add(Sample.ExecMs);
+    Entry.Serialize.Add(Sample.SerializeMs);
+    Entry.Total.Add(Sample.TotalMs);
+}
+
+TSharedPtr<FJsonObject> FMCPCommandStats::ToJson(const FString& CommandFilter)
+{
+    FStatsState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+
+    TArray<const TPair<FString, FMCPCommandStatsEntry>*> Sorted;
+    for (const TPair<FString, FMCPCommandStatsEntry>& Pair : State.Commands)
+    {
+        if (CommandFilter.IsEmpty() || Pair.Key.Contains(CommandFilter))
+        {
+            Sorted.Add(&Pair);
+        }
+    }
+    Sorted.Sort([](const TPair<FString, FMCPCommandStatsEntry>& A, const TPair<FString, FMCPCommandStatsEntry>& B)
+    {
+        return A.Value.Total.Percentile(95.0) > B.Value.Total.Percentile(95.0);
+    });
+
+    int64 TotalCount = 0;
+    int64 TotalErrors = 0;
+    int64 TotalBytesIn = 0;
+    int64 TotalBytesOut = 0;
+    TArray<TSharedPtr<FJsonValue>> Commands;
+    for (const TPair<FString, FMCPCommandStatsEntry>* Pair : Sorted)
+    {
+        const FMCPCommandStatsEntry& Entry = Pair->Value;
+        TotalCount += Entry.Count;
+        TotalErrors += Entry.Errors;
+        TotalBytesIn += Entry.BytesIn;
+        TotalBytesOut += Entry.BytesOut;
+
+        TSharedPtr<FJsonObject> Command = MakeShared<FJsonObject>();
+        Command->SetStringField(TEXT("command"), Pair->Key);
+        Command->SetNumberField(TEXT("count"), static_cast<double>(Entry.Count));
+        Command->SetNumberField(TEXT("errors"), static_cast<double>(Entry.Errors));
+        Command->SetNumberField(TEXT("streamed"), static_cast<double>(Entry.Streamed));
+        Command->SetNumberField(TEXT("bytes_in"), static_cast<double>(Entry.BytesIn));
+        Command->SetNumberField(TEXT("bytes_out"), static_cast<double>(Entry.BytesOut));
+        Command->SetNumberField(TEXT("max_bytes_out"), static_cast<double>(Entry.MaxBytesOut));
+        Command->SetObjectField(TEXT("queue"), Entry.Queue.ToJson());
+        Command->SetObjectField(TEXT("exec"), Entry.Exec.ToJson());
+        Command->SetObjectField(TEXT("serialize"), Entry.Serialize.ToJson());
+        Command->SetObjectField(TEXT("total"), Entry.Total.ToJson());
+        Commands.Add(MakeShared<FJsonValueObject>(Command));
+    }
+
+    const double UptimeSeconds = FPlatformTime::Seconds() - State.StartSeconds;
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetNumberField(TEXT("uptime_s"), UptimeSeconds);
+    Result->SetNumberField(TEXT("total_commands"), static_cast<double>(TotalCount));
+    Result->SetNumberField(TEXT("total_errors"), static_cast<double>(TotalErrors));
+    Result->SetNumberField(TEXT("total_bytes_in"), static_cast<double>(TotalBytesIn));
+    Result->SetNumberField(TEXT("total_bytes_out"), static_cast<double>(TotalBytesOut));
+    Result->SetNumberField(TEXT("commands_per_minute"), UptimeSeconds > 0.0 ? TotalCount * 60.0 / UptimeSeconds : 0.0);
+    Result->SetArrayField(TEXT("commands"), Commands);
+    return Result;
+}
+
+FString FMCPCommandStats::WriteCsv(const FString& FilePath)
+{
+    FString Csv = TEXT("command,count,errors,streamed,bytes_in,bytes_out,max_bytes_out");
+    for (const TCHAR* Phase : {TEXT("queue"), TEXT("exec"), TEXT("serialize"), TEXT("total")})
+    {
+        Csv += FString::Printf(TEXT(",%s_mean_ms,%s_p50_ms,%s_p95_ms,%s_p99_ms,%s_max_ms"), Phase, Phase, Phase, Phase, Phase);
+    }
+    Csv += LINE_TERMINATOR;
+
+    {
+        FStatsState& State = GetState();
+        FScopeLock ScopeLock(&State.Lock);
+        for (const TPair<FString, FMCPCommandStatsEntry>& Pair : State.Commands)
+        {
+            const FMCPCommandStatsEntry& Entry = Pair.Value;
+            Csv += FString::Printf(TEXT("%s,%lld,%lld,%lld,%lld,%lld,%lld"), *Pair.Key, Entry.Count, Entry.Errors, Entry.Streamed,
+                Entry.BytesIn, Entry.BytesOut, Entry.MaxBytesOut);
+            for (const FMCPLatencyHistogram* Histogram : {&Entry.Queue, &Entry.Exec, &Entry.Serialize, &Entry.Total})
+            {
+                Csv += FString::Printf(TEXT(",%.3f,%.3f,%.3f,%.3f,%.3f"),
+                    Histogram->Count > 0 ? Histogram->SumMs / Histogram->Count : 0.0,
+                    Histogram->Percentile(50.0), Histogram->Percentile(95.0), Histogram->Percentile(99.0), Histogram->MaxMs);
+            }
+            Csv += LINE_TERMINATOR;
+        }
+    }
+
+    const FString Path = FPaths::ConvertRelativePathToFull(FilePath.IsEmpty()
+        ? FPaths::ProjectSavedDir() / TEXT("MCP") / TEXT("Stats") / FString::Printf(TEXT("mcp_stats_%s.csv"), *FDateTime::Now().ToString())
+        : FilePath);
+    FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*FPaths::GetPath(Path));
+    return FFileHelper::SaveStringToFile(Csv, *Path) ? Path : FString();
+}
+
+void FMCPCommandStats::Reset()
+{
+    FStatsState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+    State.Commands.Reset();
+    State.StartSeconds = FPlatformTime::Seconds();
+}
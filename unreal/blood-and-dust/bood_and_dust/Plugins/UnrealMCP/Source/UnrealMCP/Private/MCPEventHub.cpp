@@ -0,0 +1,873 @@
+#include "MCPEventHub.h"
+#include "MCPLogCapture.h"
+#include "MCPResponseWriter.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Containers/Ticker.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/Material.h"
+#include "MaterialShared.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "ShaderCompiler.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+namespace
+{
+    struct FMCPEvent
+    {
+        EMCPEventType Type = EMCPEventType::Log;
+        /** Unix time in seconds */
+        double Time = 0.0;
+        /** Actor or asset path; empty for the shader queue and log lines */
+        FString Path;
+        /** Actor name, file name, or log category */
+        FString Name;
+        FString Label;
+        FString Class;
+        FTransform Transform;
+        /** Shader jobs, compile error count, or log cursor */
+        int64 Value = 0;
+        bool bSuccess = true;
+        FString Message;
+        ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+        /** Events folded into this one */
+        int32 Coalesced = 0;
+        /** Spawned and deleted within one batch: never delivered */
+        bool bCancelled = false;
+    };
+
+    struct FSubscription
+    {
+        int64 Id = 0;
+        uint32 EventMask = 0;
+        TArray<FName> LogCategories;
+        ELogVerbosity::Type LogVerbosity = ELogVerbosity::Log;
+        double BatchSeconds = 0.1;
+        int32 MaxBatch = 500;
+        bool bPush = true;
+
+        TArray<FMCPEvent> Pending;
+        /** Coalescing key -> index in Pending */
+        TMap<FString, int32> PendingByKey;
+        /** Pending events that are not cancelled */
+        int32 Live = 0;
+        double FirstPendingTime = 0.0;
+        double LastActivity = 0.0;
+        int64 LogCursor = 0;
+
+        // Since the last batch, then over the subscription's life
+        int64 Coalesced = 0;
+        int64 Dropped = 0;
+        int64 Delivered = 0;
+        int64 Batches = 0;
+        int64 TotalCoalesced = 0;
+        int64 TotalDropped = 0;
+    };
+
+    /** Per subscription; a client that stops reading loses the newest events, not the editor's memory */
+    constexpr int32 MaxPending = 10000;
+    constexpr double PullExpirySeconds = 600.0;
+    /** poll_events waits on the single server thread, which answers no other client meanwhile */
+    constexpr double MaxPollWaitMs = 1000.0;
+    constexpr float ShaderQueueInterval = 0.25f;
+
+    struct FEventHubState
+    {
+        FCriticalSection Lock;
+        TMap<int64, FSubscription> Subscriptions;
+        int64 NextId = 1;
+        /** Union of the subscriptions' event masks; read by the delegates without the lock */
+        std::atomic<uint32> WantedMask{0};
+        std::atomic<int32> PushCount{0};
+        std::atomic<bool> bBindRequested{false};
+        /** One-shot ticker that binds the delegates; added from the server thread, so set under the lock */
+        FTSTicker::FDelegateHandle BindTicker;
+        /** Wakes poll_events when events arrive */
+        FEvent* Wake = nullptr;
+
+        // Game thread only
+        bool bBound = false;
+        FDelegateHandle ActorAddedHandle;
+        FDelegateHandle ActorDeletedHandle;
+        FDelegateHandle ActorMovedHandle;
+        FDelegateHandle PackageSavedHandle;
+        FDelegateHandle BlueprintPreCompileHandle;
+        FDelegateHandle BlueprintCompiledHandle;
+        FDelegateHandle MaterialCompiledHandle;
+        FTSTicker::FDelegateHandle ShaderQueueTicker;
+        TArray<TWeakObjectPtr<UBlueprint>> CompilingBlueprints;
+        int32 LastShaderJobs = -1;
+    };
+
+    FEventHubState& GetState()
+    {
+        static FEventHubState State;
+        return State;
+    }
+
+    constexpr uint32 EventBit(EMCPEventType Type)
+    {
+        return 1u << static_cast<uint32>(Type);
+    }
+
+    bool IsWanted(EMCPEventType Type)
+    {
+        return (GetState().WantedMask.load(std::memory_order_relaxed) & EventBit(Type)) != 0;
+    }
+
+    /** Caller holds the lock */
+    void UpdateMasks(FEventHubState& State)
+    {
+        uint32 Mask = 0;
+        int32 Push = 0;
+        for (const TPair<int64, FSubscription>& Pair : State.Subscriptions)
+        {
+            Mask |= Pair.Value.EventMask;
+            Push += Pair.Value.bPush ? 1 : 0;
+        }
+        State.WantedMask = Mask;
+        State.PushCount = Push;
+    }
+
+    /** Caller holds the lock */
+    void ExpireIdlePullSubscriptions(FEventHubState& State, double Now)
+    {
+        bool bRemoved = false;
+        for (auto It = State.Subscriptions.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().bPush && Now - It.Value().LastActivity > PullExpirySeconds)
+            {
+                It.RemoveCurrent();
+                bRemoved = true;
+            }
+        }
+        if (bRemoved)
+        {
+            UpdateMasks(State);
+        }
+    }
+
+    /** Events with the same key fold into one; log lines never do */
+    FString CoalesceKey(const FMCPEvent& Event)
+    {
+        switch (Event.Type)
+        {
+        case EMCPEventType::ActorSpawned:
+        case EMCPEventType::ActorDeleted:
+        case EMCPEventType::ActorMoved:
+            return TEXT("actor:") + Event.Path;
+        case EMCPEventType::ShaderQueue:
+            return TEXT("shader_queue");
+        case EMCPEventType::Log:
+            return FString();
+        default:
+            return FString::Printf(TEXT("%d:%s"), static_cast<int32>(Event.Type), *Event.Path);
+        }
+    }
+
+    /** Caller holds the lock */
+    void AddEvent(FSubscription& Sub, const FMCPEvent& Event, double Now)
+    {
+        const FString Key = CoalesceKey(Event);
+        if (!Key.IsEmpty())
+        {
+            if (const int32* Index = Sub.PendingByKey.Find(Key))
+            {
+                FMCPEvent& Existing = Sub.Pending[*Index];
+                if (Event.Type == EMCPEventType::ActorMoved &&
+                    (Existing.Type == EMCPEventType::ActorSpawned || Existing.Type == EMCPEventType::ActorMoved))
+                {
+                    // Only the final transform matters (and a new actor is reported where it ended up)
+                    Existing.Transform = Event.Transform;
+                    Existing.Time = Event.Time;
+                    ++Existing.Coalesced;
+                    ++Sub.Coalesced;
+                    return;
+                }
+                if (Event.Type == EMCPEventType::ActorDeleted && Existing.Type == EMCPEventType::ActorSpawned)
+                {
+                    // The subscriber never saw this actor
+                    Sub.Coalesced += Existing.Coalesced + 2;
+                    Existing.bCancelled = true;
+                    --Sub.Live;
+                    Sub.PendingByKey.Remove(Key);
+                    return;
+                }
+                if (Event.Type == Existing.Type || (Event.Type == EMCPEventType::ActorDeleted && Existing.Type == EMCPEventType::ActorMoved))
+                {
+                    // Saves, compile results, queue sizes: the latest one wins
+                    const int32 Folded = Existing.Coalesced + 1;
+                    Existing = Event;
+                    Existing.Coalesced = Folded;
+                    ++Sub.Coalesced;
+                    return;
+                }
+                // Re-spawned after a delete: both are reported
+            }
+        }
+
+        if (Sub.Live >= MaxPending)
+        {
+            ++Sub.Dropped;
+            return;
+        }
+        if (Sub.Pending.Num() == 0)
+        {
+            Sub.FirstPendingTime = Now;
+        }
+        if (!Key.IsEmpty())
+        {
+            Sub.PendingByKey.Add(Key, Sub.Pending.Num());
+        }
+        Sub.Pending.Add(Event);
+        ++Sub.Live;
+    }
+
+    /** Editor delegates fire on the game thread; this is the only place they touch shared state */
+    void Enqueue(const FMCPEvent& Event)
+    {
+        FEventHubState& State = GetState();
+        bool bAdded = false;
+        {
+            FScopeLock ScopeLock(&State.Lock);
+            const double Now = FPlatformTime::Seconds();
+            for (TPair<int64, FSubscription>& Pair : State.Subscriptions)
+            {
+                if (Pair.Value.EventMask & EventBit(Event.Type))
+                {
+                    AddEvent(Pair.Value, Event, Now);
+                    bAdded = true;
+                }
+            }
+        }
+        if (bAdded && State.Wake)
+        {
+            State.Wake->Trigger();
+        }
+    }
+
+    /** Log lines are pulled from FMCPLogCapture when a batch is due, not pushed per line. Caller holds the lock */
+    void CollectLogLines(FSubscription& Sub, double Now)
+    {
+        if (!(Sub.EventMask & EventBit(EMCPEventType::Log)))
+        {
+            return;
+        }
+
+        TArray<FMCPLogLine> Lines;
+        Sub.LogCursor = FMCPLogCapture::Get().CopySince(Sub.LogCursor, MaxPending, Lines);
+        for (const FMCPLogLine& Line : Lines)
+        {
+            if (Line.Verbosity > Sub.LogVerbosity || (Sub.LogCategories.Num() > 0 && !Sub.LogCategories.Contains(Line.Category)))
+            {
+                continue;
+            }
+            FMCPEvent Event;
+            Event.Type = EMCPEventType::Log;
+            Event.Time = Line.Timestamp.ToUnixTimestampDecimal();
+            Event.Name = Line.Category.ToString();
+            Event.Verbosity = Line.Verbosity;
+            Event.Message = Line.Message;
+            Event.Value = Line.Seq;
+            AddEvent(Sub, Event, Now);
+        }
+    }
+
+    /** Caller holds the lock */
+    bool IsBatchDue(FSubscription& Sub, double Now)
+    {
+        CollectLogLines(Sub, Now);
+        if (Sub.Live == 0 && Sub.Dropped == 0)
+        {
+            return false;
+        }
+        return Now - Sub.FirstPendingTime >= Sub.BatchSeconds || Sub.Live >= Sub.MaxBatch;
+    }
+
+    void WriteEvent(FMCPResponseWriter& Writer, const FMCPEvent& Event)
+    {
+        Writer.BeginObject();
+        Writer.StringField(TEXT("event"), FMCPEventHub::EventTypeToString(Event.Type));
+        Writer.NumberField(TEXT("time"), Event.Time);
+        switch (Event.Type)
+        {
+        case EMCPEventType::ActorSpawned:
+        case EMCPEventType::ActorMoved:
+            Writer.StringField(TEXT("path"), Event.Path);
+            Writer.StringField(TEXT("name"), Event.Name);
+            Writer.StringField(TEXT("label"), Event.Label);
+            Writer.StringField(TEXT("class"), Event.Class);
+            Writer.VectorField(TEXT("location"), Event.Transform.GetLocation());
+            Writer.RotatorField(TEXT("rotation"), Event.Transform.Rotator());
+            Writer.VectorField(TEXT("scale"), Event.Transform.GetScale3D());
+            break;
+        case EMCPEventType::ActorDeleted:
+            Writer.StringField(TEXT("path"), Event.Path);
+            Writer.StringField(TEXT("name"), Event.Name);
+            Writer.StringField(TEXT("label"), Event.Label);
+            Writer.StringField(TEXT("class"), Event.Class);
+            break;
+        case EMCPEventType::AssetSaved:
+            Writer.StringField(TEXT("path"), Event.Path);
+            Writer.StringField(TEXT("file"), Event.Name);
+            break;
+        case EMCPEventType::BlueprintCompiled:
+        case EMCPEventType::MaterialCompiled:
+            Writer.StringField(TEXT("path"), Event.Path);
+            Writer.StringField(TEXT("name"), Event.Name);
+            Writer.BoolField(TEXT("success"), Event.bSuccess);
+            Writer.IntField(TEXT("errors"), Event.Value);
+            if (!Event.Message.IsEmpty())
+            {
+                Writer.StringField(TEXT("message"), Event.Message);
+            }
+            break;
+        case EMCPEventType::ShaderQueue:
+            Writer.IntField(TEXT("jobs"), Event.Value);
+            break;
+        case EMCPEventType::Log:
+            Writer.IntField(TEXT("cursor"), Event.Value);
+            Writer.StringField(TEXT("category"), Event.Name);
+            Writer.StringField(TEXT("verbosity"), ToString(Event.Verbosity));
+            Writer.StringField(TEXT("message"), Event.Message);
+            break;
+        default:
+            break;
+        }
+        if (Event.Coalesced > 0)
+        {
+            Writer.IntField(TEXT("coalesced"), Event.Coalesced);
+        }
+        Writer.EndObject();
+    }
+
+    /** Write up to MaxBatch pending events as fields of the open object and drop them. Caller holds the lock */
+    void WriteBatch(FSubscription& Sub, FMCPResponseWriter& Writer, double Now)
+    {
+        Writer.IntField(TEXT("subscription_id"), Sub.Id);
+        Writer.Key(TEXT("events"));
+        Writer.BeginArray();
+        int32 Written = 0;
+        int32 Consumed = 0;
+        for (; Consumed < Sub.Pending.Num() && Written < Sub.MaxBatch; ++Consumed)
+        {
+            if (!Sub.Pending[Consumed].bCancelled)
+            {
+                WriteEvent(Writer, Sub.Pending[Consumed]);
+                ++Written;
+            }
+        }
+        Writer.EndArray();
+        Writer.IntField(TEXT("coalesced"), Sub.Coalesced);
+        Writer.IntField(TEXT("dropped"), Sub.Dropped);
+
+        Sub.Pending.RemoveAt(0, Consumed, EAllowShrinking::No);
+        Sub.PendingByKey.Reset();
+        Sub.Live = 0;
+        for (int32 i = 0; i < Sub.Pending.Num(); ++i)
+        {
+            if (!Sub.Pending[i].bCancelled)
+            {
+                ++Sub.Live;
+                const FString Key = CoalesceKey(Sub.Pending[i]);
+                if (!Key.IsEmpty())
+                {
+                    Sub.PendingByKey.Add(Key, i);
+                }
+            }
+        }
+        Writer.IntField(TEXT("pending"), Sub.Live);
+
+        Sub.Delivered += Written;
+        ++Sub.Batches;
+        Sub.TotalCoalesced += Sub.Coalesced;
+        Sub.TotalDropped += Sub.Dropped;
+        Sub.Coalesced = 0;
+        Sub.Dropped = 0;
+        Sub.LastActivity = Now;
+        // Whatever did not fit is already due
+    }
+
+    // ---- Editor delegates (game thread) ----
+
+    bool IsTrackedActor(const AActor* Actor)
+    {
+        // Skips preview/PIE worlds and helper actors such as the screenshot capture rig
+        if (!Actor || Actor->HasAnyFlags(RF_Transient | RF_ClassDefaultObject))
+        {
+            return false;
+        }
+        const UWorld* World = Actor->GetWorld();
+        return World && World->WorldType == EWorldType::Editor;
+    }
+
+    void EnqueueActorEvent(EMCPEventType Type, AActor* Actor)
+    {
+        if (!IsWanted(Type) || !IsTrackedActor(Actor))
+        {
+            return;
+        }
+        FMCPEvent Event;
+        Event.Type = Type;
+        Event.Time = FDateTime::UtcNow().ToUnixTimestampDecimal();
+        Event.Path = Actor->GetPathName();
+        Event.Name = Actor->GetName();
+        Event.Label = Actor->GetActorLabel();
+        Event.Class = Actor->GetClass()->GetName();
+        Event.Transform = Actor->GetActorTransform();
+        Enqueue(Event);
+    }
+
+    void OnActorAdded(AActor* Actor)
+    {
+        EnqueueActorEvent(EMCPEventType::ActorSpawned, Actor);
+    }
+
+    void OnActorDeleted(AActor* Actor)
+    {
+        EnqueueActorEvent(EMCPEventType::ActorDeleted, Actor);
+    }
+
+    void OnActorMoved(AActor* Actor)
+    {
+        EnqueueActorEvent(EMCPEventType::ActorMoved, Actor);
+    }
+
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+    {
+        if (!IsWanted(EMCPEventType::AssetSaved) || !Package || SaveContext.IsProceduralSave())
+        {
+            return;
+        }
+        FMCPEvent Event;
+        Event.Type = EMCPEventType::AssetSaved;
+        Event.Time = FDateTime::UtcNow().ToUnixTimestampDecimal();
+        Event.Path = Package->GetName();
+        Event.Name = FPaths::GetCleanFilename(PackageFileName);
+        Enqueue(Event);
+    }
+
+    void OnBlueprintPreCompile(UBlueprint* Blueprint)
+    {
+        if (IsWanted(EMCPEventType::BlueprintCompiled) && Blueprint)
+        {
+            GetState().CompilingBlueprints.AddUnique(Blueprint);
+        }
+    }
+
+    /** OnBlueprintCompiled carries no Blueprint, so report the ones seen in OnBlueprintPreCompile */
+    void OnBlueprintCompiled()
+    {
+        FEventHubState& State = GetState();
+        TArray<TWeakObjectPtr<UBlueprint>> Compiled = MoveTemp(State.CompilingBlueprints);
+        State.CompilingBlueprints.Reset();
+        for (const TWeakObjectPtr<UBlueprint>& Weak : Compiled)
+        {
+            const UBlueprint* Blueprint = Weak.Get();
+            if (!Blueprint)
+            {
+                continue;
+            }
+            FMCPEvent Event;
+            Event.Type = EMCPEventType::BlueprintCompiled;
+            Event.Time = FDateTime::UtcNow().ToUnixTimestampDecimal();
+            Event.Path = Blueprint->GetPathName();
+            Event.Name = Blueprint->GetName();
+            Event.bSuccess = Blueprint->Status != BS_Error;
+            Event.Value = Blueprint->Status == BS_Error ? 1 : 0;
+            Event.Message = Blueprint->Status == BS_Error ? TEXT("error")
+                : Blueprint->Status == BS_UpToDateWithWarnings ? TEXT("warnings") : TEXT("up_to_date");
+            Enqueue(Event);
+        }
+    }
+
+    void OnMaterialCompiled(UMaterialInterface* MaterialInterface)
+    {
+        if (!IsWanted(EMCPEventType::MaterialCompiled) || !MaterialInterface)
+        {
+            return;
+        }
+        FMCPEvent Event;
+        Event.Type = EMCPEventType::MaterialCompiled;
+        Event.Time = FDateTime::UtcNow().ToUnixTimestampDecimal();
+        Event.Path = MaterialInterface->GetPathName();
+        Event.Name = MaterialInterface->GetName();
+        if (UMaterial* Material = MaterialInterface->GetMaterial())
+        {
+            if (const FMaterialResource* Resource = Material->GetMaterialResource(GMaxRHIFeatureLevel))
+            {
+                const TArray<FString>& Errors = Resource->GetCompileErrors();
+                Event.Value = Errors.Num();
+                Event.bSuccess = Errors.Num() == 0;
+                if (Errors.Num() > 0)
+                {
+                    Event.Message = Errors[0];
+                }
+            }
+        }
+        Enqueue(Event);
+    }
+
+    bool SampleShaderQueue(float DeltaTime)
+    {
+        FEventHubState& State = GetState();
+        if (!IsWanted(EMCPEventType::ShaderQueue) || !GShaderCompilingManager)
+        {
+            State.LastShaderJobs = -1;
+            return true;
+        }
+        const int32 Jobs = GShaderCompilingManager->GetNumRemainingJobs();
+        if (Jobs != State.LastShaderJobs)
+        {
+            State.LastShaderJobs = Jobs;
+            FMCPEvent Event;
+            Event.Type = EMCPEventType::ShaderQueue;
+            Event.Time = FDateTime::UtcNow().ToUnixTimestampDecimal();
+            Event.Value = Jobs;
+            Enqueue(Event);
+        }
+        return true;
+    }
+
+    void BindDelegates()
+    {
+        FEventHubState& State = GetState();
+        if (State.bBound || !GEngine)
+        {
+            return;
+        }
+        State.ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&OnActorAdded);
+        State.ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&OnActorDeleted);
+        State.ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&OnActorMoved);
+        State.PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&OnPackageSaved);
+        if (GEditor)
+        {
+            State.BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddStatic(&OnBlueprintPreCompile);
+            State.BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&OnBlueprintCompiled);
+        }
+        State.MaterialCompiledHandle = UMaterial::OnMaterialCompilationFinished().AddStatic(&OnMaterialCompiled);
+        State.ShaderQueueTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&SampleShaderQueue), ShaderQueueInterval);
+        State.bBound = true;
+    }
+
+    /** Editor delegates may only be bound on the game thread; subscribe runs on the server thread */
+    void RequestBinding()
+    {
+        FEventHubState& State = GetState();
+        if (!State.bBindRequested.exchange(true))
+        {
+            FScopeLock ScopeLock(&State.Lock);
+            State.BindTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime) -> bool
+            {
+                BindDelegates();
+                return false;
+            }));
+        }
+    }
+}
+
+bool FMCPEventHub::ParseEventType(const FString& Name, EMCPEventType& OutType)
+{
+    for (uint8 i = 0; i < static_cast<uint8>(EMCPEventType::Num); ++i)
+    {
+        if (Name.Equals(EventTypeToString(static_cast<EMCPEventType>(i)), ESearchCase::IgnoreCase))
+        {
+            OutType = static_cast<EMCPEventType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+const TCHAR* FMCPEventHub::EventTypeToString(EMCPEventType Type)
+{
+    switch (Type)
+    {
+    case EMCPEventType::ActorSpawned: return TEXT("actor_spawned");
+    case EMCPEventType::ActorDeleted: return TEXT("actor_deleted");
+    case EMCPEventType::ActorMoved: return TEXT("actor_moved");
+    case EMCPEventType::AssetSaved: return TEXT("asset_saved");
+    case EMCPEventType::BlueprintCompiled: return TEXT("blueprint_compiled");
+    case EMCPEventType::MaterialCompiled: return TEXT("material_compiled");
+    case EMCPEventType::ShaderQueue: return TEXT("shader_queue");
+    case EMCPEventType::Log: return TEXT("log");
+    default: return TEXT("unknown");
+    }
+}
+
+TSharedPtr<FJsonObject> FMCPEventHub::Subscribe(const TSharedPtr<FJsonObject>& Params)
+{
+    FSubscription Sub;
+
+    const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+    if (Params->TryGetArrayField(TEXT("events"), Events) && Events->Num() > 0)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Events)
+        {
+            EMCPEventType Type;
+            if (Value->AsString() == TEXT("all"))
+            {
+                Sub.EventMask |= EventBit(EMCPEventType::Num) - 1;
+            }
+            else if (ParseEventType(Value->AsString(), Type))
+            {
+                Sub.EventMask |= EventBit(Type);
+            }
+            else
+            {
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                    TEXT("Unknown event '%s' (actor_spawned, actor_deleted, actor_moved, asset_saved, blueprint_compiled, material_compiled, shader_queue, log, all)"),
+                    *Value->AsString()));
+            }
+        }
+    }
+    else
+    {
+        // Everything but the log, which is opt-in (or implied by log_categories)
+        Sub.EventMask = (EventBit(EMCPEventType::Num) - 1) & ~EventBit(EMCPEventType::Log);
+    }
+
+    FString Categories;
+    if (Params->TryGetStringField(TEXT("log_categories"), Categories) && !Categories.IsEmpty())
+    {
+        TArray<FString> Names;
+        Categories.ParseIntoArray(Names, TEXT(","), true);
+        for (const FString& Name : Names)
+        {
+            Sub.LogCategories.Add(FName(*Name.TrimStartAndEnd()));
+        }
+        Sub.EventMask |= EventBit(EMCPEventType::Log);
+    }
+    FString Verbosity;
+    if (Params->TryGetStringField(TEXT("log_verbosity"), Verbosity) && !Verbosity.IsEmpty())
+    {
+        Sub.LogVerbosity = ParseLogVerbosityFromString(Verbosity);
+        if (Sub.LogVerbosity == ELogVerbosity::NoLogging)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown log_verbosity '%s' (Fatal, Error, Warning, Display, Log, Verbose, VeryVerbose)"), *Verbosity));
+        }
+    }
+
+    double BatchMs = 100.0;
+    Params->TryGetNumberField(TEXT("batch_ms"), BatchMs);
+    Sub.BatchSeconds = FMath::Clamp(BatchMs, 0.0, 10000.0) / 1000.0;
+    double MaxBatch = 500.0;
+    Params->TryGetNumberField(TEXT("max_batch"), MaxBatch);
+    Sub.MaxBatch = FMath::Clamp(static_cast<int32>(MaxBatch), 1, MaxPending);
+    Params->TryGetBoolField(TEXT("push"), Sub.bPush);
+
+    // Only lines logged from now on
+    TArray<FMCPLogLine> None;
+    Sub.LogCursor = FMCPLogCapture::Get().CopySince(0, 0, None);
+
+    FEventHubState& State = GetState();
+    {
+        FScopeLock ScopeLock(&State.Lock);
+        if (!State.Wake)
+        {
+            State.Wake = FPlatformProcess::GetSynchEventFromPool(false);
+        }
+        const double Now = FPlatformTime::Seconds();
+        ExpireIdlePullSubscriptions(State, Now);
+        Sub.Id = State.NextId++;
+        Sub.LastActivity = Now;
+        State.Subscriptions.Add(Sub.Id, Sub);
+        UpdateMasks(State);
+    }
+    RequestBinding();
+
+    TArray<TSharedPtr<FJsonValue>> EventNames;
+    for (uint8 i = 0; i < static_cast<uint8>(EMCPEventType::Num); ++i)
+    {
+        if (Sub.EventMask & EventBit(static_cast<EMCPEventType>(i)))
+        {
+            EventNames.Add(MakeShared<FJsonValueString>(EventTypeToString(static_cast<EMCPEventType>(i))));
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetNumberField(TEXT("subscription_id"), static_cast<double>(Sub.Id));
+    Result->SetArrayField(TEXT("events"), EventNames);
+    Result->SetStringField(TEXT("delivery"), Sub.bPush ? TEXT("push") : TEXT("poll_events"));
+    Result->SetNumberField(TEXT("batch_ms"), Sub.BatchSeconds * 1000.0);
+    Result->SetNumberField(TEXT("max_batch"), Sub.MaxBatch);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPEventHub::Unsubscribe(const TSharedPtr<FJsonObject>& Params)
+{
+    double IdD = 0.0;
+    if (!Params->TryGetNumberField(TEXT("subscription_id"), IdD))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'subscription_id' parameter"));
+    }
+
+    FEventHubState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+    FSubscription Sub;
+    if (!State.Subscriptions.RemoveAndCopyValue(static_cast<int64>(IdD), Sub))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No subscription %lld"), static_cast<int64>(IdD)));
+    }
+    UpdateMasks(State);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetNumberField(TEXT("subscription_id"), static_cast<double>(Sub.Id));
+    Result->SetNumberField(TEXT("delivered"), static_cast<double>(Sub.Delivered));
+    Result->SetNumberField(TEXT("batches"), static_cast<double>(Sub.Batches));
+    Result->SetNumberField(TEXT("coalesced"), static_cast<double>(Sub.TotalCoalesced + Sub.Coalesced));
+    Result->SetNumberField(TEXT("dropped"), static_cast<double>(Sub.TotalDropped + Sub.Dropped));
+    Result->SetNumberField(TEXT("undelivered"), Sub.Live);
+    return Result;
+}
+
+bool FMCPEventHub::Poll(const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError)
+{
+    double IdD = 0.0;
+    if (!Params->TryGetNumberField(TEXT("subscription_id"), IdD))
+    {
+        OutError = TEXT("Missing 'subscription_id' parameter");
+        return false;
+    }
+    const int64 Id = static_cast<int64>(IdD);
+    double TimeoutMs = 0.0;
+    Params->TryGetNumberField(TEXT("timeout_ms"), TimeoutMs);
+    // Kept short: the server thread serves nobody else while it waits here
+    const double Deadline = FPlatformTime::Seconds() + FMath::Clamp(TimeoutMs, 0.0, MaxPollWaitMs) / 1000.0;
+
+    FEventHubState& State = GetState();
+    while (true)
+    {
+        double WaitSeconds = 0.0;
+        {
+            FScopeLock ScopeLock(&State.Lock);
+            const double Now = FPlatformTime::Seconds();
+            ExpireIdlePullSubscriptions(State, Now);
+            FSubscription* Sub = State.Subscriptions.Find(Id);
+            if (!Sub)
+            {
+                OutError = FString::Printf(TEXT("No subscription %lld (unsubscribed, or expired after %.0f s without a poll)"), Id, PullExpirySeconds);
+                return false;
+            }
+            if (Sub->bPush)
+            {
+                OutError = FString::Printf(TEXT("Subscription %lld delivers by push"), Id);
+                return false;
+            }
+            Sub->LastActivity = Now;
+
+            if (IsBatchDue(*Sub, Now) || Now >= Deadline)
+            {
+                Writer.BeginObject();
+                WriteBatch(*Sub, Writer, Now);
+                Writer.EndObject();
+                return true;
+            }
+            // Until the open batch is due, else until the deadline; log lines are checked every 50 ms
+            WaitSeconds = Deadline - Now;
+            if (Sub->Live > 0)
+            {
+                WaitSeconds = FMath::Min(WaitSeconds, Sub->FirstPendingTime + Sub->BatchSeconds - Now);
+            }
+            if (Sub->EventMask & EventBit(EMCPEventType::Log))
+            {
+                WaitSeconds = FMath::Min(WaitSeconds, 0.05);
+            }
+        }
+        State.Wake->Wait(FMath::Max(1, FMath::CeilToInt(WaitSeconds * 1000.0)));
+    }
+}
+
+bool FMCPEventHub::HasPushSubscriptions()
+{
+    return GetState().PushCount.load(std::memory_order_relaxed) > 0;
+}
+
+bool FMCPEventHub::TakePushMessage(TArray<uint8>& OutMessage, EMCPWireFormat Format)
+{
+    FEventHubState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+    const double Now = FPlatformTime::Seconds();
+    for (TPair<int64, FSubscription>& Pair : State.Subscriptions)
+    {
+        if (Pair.Value.bPush && IsBatchDue(Pair.Value, Now))
+        {
+            FMCPResponseWriter Writer(OutMessage, Format);
+            Writer.BeginObject();
+            Writer.StringField(TEXT("type"), TEXT("event"));
+            WriteBatch(Pair.Value, Writer, Now);
+            Writer.EndObject();
+            return true;
+        }
+    }
+    return false;
+}
+
+void FMCPEventHub::OnConnectionClosed()
+{
+    FEventHubState& State = GetState();
+    if (State.PushCount.load() == 0)
+    {
+        return;
+    }
+    FScopeLock ScopeLock(&State.Lock);
+    for (auto It = State.Subscriptions.CreateIterator(); It; ++It)
+    {
+        if (It.Value().bPush)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    UpdateMasks(State);
+}
+
+void FMCPEventHub::Shutdown()
+{
+    FEventHubState& State = GetState();
+    if (State.bBound)
+    {
+        if (GEngine)
+        {
+            GEngine->OnLevelActorAdded().Remove(State.ActorAddedHandle);
+            GEngine->OnLevelActorDeleted().Remove(State.ActorDeletedHandle);
+            GEngine->OnActorMoved().Remove(State.ActorMovedHandle);
+        }
+        if (GEditor)
+        {
+            GEditor->OnBlueprintPreCompile().Remove(State.BlueprintPreCompileHandle);
+            GEditor->OnBlueprintCompiled().Remove(State.BlueprintCompiledHandle);
+        }
+        UPackage::PackageSavedWithContextEvent.Remove(State.PackageSavedHandle);
+        UMaterial::OnMaterialCompilationFinished().Remove(State.MaterialCompiledHandle);
+        FTSTicker::GetCoreTicker().RemoveTicker(State.ShaderQueueTicker);
+        State.bBound = false;
+    }
+    State.CompilingBlueprints.Reset();
+
+    FScopeLock ScopeLock(&State.Lock);
+    // A subscribe right before shutdown may still have the binding ticker queued
+    if (State.BindTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(State.BindTicker);
+        State.BindTicker.Reset();
+    }
+    State.bBindRequested = false;
+    State.Subscriptions.Reset();
+    UpdateMasks(State);
+    if (State.Wake)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(State.Wake);
+        State.Wake = nullptr;
+    }
+}
@@ -0,0 +1,440 @@
+#include "MCPLogCapture.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "HAL/PlatformFileManager.h"
+#include "Internationalization/Regex.h"
+#include "Misc/App.h"
+#include "Misc/OutputDeviceHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    /** Line filters shared by the ring buffer and the file reader */
+    struct FLogFilter
+    {
+        FString Substring;
+        TOptional<FRegexPattern> Regex;
+        TArray<FName> Categories;
+        ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All;
+
+        bool IsEmpty() const
+        {
+            return Substring.IsEmpty() && !Regex.IsSet() && Categories.Num() == 0 && MaxVerbosity == ELogVerbosity::All;
+        }
+
+        bool Matches(FName Category, ELogVerbosity::Type Verbosity, const FString& Text) const
+        {
+            if (Verbosity > MaxVerbosity)
+            {
+                return false;
+            }
+            if (Categories.Num() > 0 && !Categories.Contains(Category))
+            {
+                return false;
+            }
+            if (!Substring.IsEmpty() && !Text.Contains(Substring))
+            {
+                return false;
+            }
+            if (Regex.IsSet())
+            {
+                FRegexMatcher Matcher(Regex.GetValue(), Text);
+                return Matcher.FindNext();
+            }
+            return true;
+        }
+    };
+
+    bool ParseFilter(const TSharedPtr<FJsonObject>& Params, FLogFilter& OutFilter, FString& OutError)
+    {
+        Params->TryGetStringField(TEXT("filter"), OutFilter.Substring);
+
+        FString Regex;
+        if (Params->TryGetStringField(TEXT("regex"), Regex) && !Regex.IsEmpty())
+        {
+            OutFilter.Regex.Emplace(Regex);
+        }
+
+        FString Categories;
+        if (Params->TryGetStringField(TEXT("category"), Categories))
+        {
+            TArray<FString> Names;
+            Categories.ParseIntoArray(Names, TEXT(","), true);
+            for (const FString& Name : Names)
+            {
+                OutFilter.Categories.Add(FName(*Name.TrimStartAndEnd()));
+            }
+        }
+
+        FString Verbosity;
+        if (Params->TryGetStringField(TEXT("verbosity"), Verbosity) && !Verbosity.IsEmpty())
+        {
+            OutFilter.MaxVerbosity = ParseLogVerbosityFromString(Verbosity);
+            if (OutFilter.MaxVerbosity == ELogVerbosity::NoLogging && !Verbosity.Equals(TEXT("NoLogging"), ESearchCase::IgnoreCase))
+            {
+                OutError = FString::Printf(TEXT("Unknown verbosity '%s' (Fatal, Error, Warning, Display, Log, Verbose, VeryVerbose)"), *Verbosity);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int32 ParseNumLines(const TSharedPtr<FJsonObject>& Params)
+    {
+        double NumLines = 200.0;
+        Params->TryGetNumberField(TEXT("num_lines"), NumLines);
+        return FMath::Clamp(static_cast<int32>(NumLines), 1, 5000);
+    }
+
+    /** Recover category and verbosity from a log file line ("[time][frame]Category: Verbosity: text") */
+    void ParseFileLine(const FString& Line, FName& OutCategory, ELogVerbosity::Type& OutVerbosity)
+    {
+        OutCategory = NAME_None;
+        OutVerbosity = ELogVerbosity::Log;
+
+        int32 Pos = 0;
+        for (int32 Group = 0; Group < 2 && Pos < Line.Len() && Line[Pos] == TEXT('['); ++Group)
+        {
+            const int32 Close = Line.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+            if (Close == INDEX_NONE)
+            {
+                return;
+            }
+            Pos = Close + 1;
+        }
+
+        const int32 CategoryEnd = Line.Find(TEXT(": "), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+        if (CategoryEnd == INDEX_NONE || CategoryEnd - Pos > 64)
+        {
+            return;
+        }
+        const FString Category = Line.Mid(Pos, CategoryEnd - Pos);
+        if (Category.IsEmpty() || Category.Contains(TEXT(" ")))
+        {
+            return;
+        }
+        OutCategory = FName(*Category);
+
+        const int32 VerbosityStart = CategoryEnd + 2;
+        const int32 VerbosityEnd = Line.Find(TEXT(": "), ESearchCase::CaseSensitive, ESearchDir::FromStart, VerbosityStart);
+        if (VerbosityEnd != INDEX_NONE && VerbosityEnd - VerbosityStart <= 11)
+        {
+            const ELogVerbosity::Type Parsed = ParseLogVerbosityFromString(Line.Mid(VerbosityStart, VerbosityEnd - VerbosityStart));
+            if (Parsed != ELogVerbosity::NoLogging)
+            {
+                OutVerbosity = Parsed;
+            }
+        }
+    }
+}
+
+FMCPLogCapture& FMCPLogCapture::Get()
+{
+    static FMCPLogCapture Instance;
+    return Instance;
+}
+
+void FMCPLogCapture::Start()
+{
+    FMCPLogCapture& Capture = Get();
+    if (!Capture.bRegistered && GLog)
+    {
+        GLog->AddOutputDevice(&Capture);
+        Capture.bRegistered = true;
+    }
+}
+
+void FMCPLogCapture::Stop()
+{
+    FMCPLogCapture& Capture = Get();
+    if (Capture.bRegistered && GLog)
+    {
+        GLog->RemoveOutputDevice(&Capture);
+    }
+    Capture.bRegistered = false;
+}
+
+void FMCPLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+    Serialize(V, Verbosity, Category, -1.0);
+}
+
+void FMCPLogCapture::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category, double Time)
+{
+    // Called from whichever thread logged; never log from here
+    FMCPLogLine Line;
+    Line.Timestamp = FDateTime::Now();
+    Line.Category = Category;
+    Line.Verbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+    const int32 Length = FCString::Strlen(V);
+    Line.Message = Length > MaxMessageLength ? FString(MaxMessageLength, V) + TEXT("...") : FString(Length, V);
+
+    FScopeLock ScopeLock(&Lock);
+    Line.Seq = NextSeq++;
+    if (Lines.Num() < Capacity)
+    {
+        Lines.Add(MoveTemp(Line));
+    }
+    else
+    {
+        Lines[Head] = MoveTemp(Line);
+        Head = (Head + 1) % Capacity;
+    }
+}
+
+int64 FMCPLogCapture::CopySince(int64 Cursor, int32 MaxLines, TArray<FMCPLogLine>& OutLines) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const int32 Num = Lines.Num();
+    if (Num == 0)
+    {
+        return NextSeq - 1;
+    }
+
+    // Seq is contiguous, so the first line after Cursor is found by arithmetic instead of a scan
+    const int64 OldestSeq = NextSeq - Num;
+    const int32 Skip = static_cast<int32>(FMath::Clamp<int64>(Cursor + 1 - OldestSeq, 0, Num));
+    const int32 Count = FMath::Min(Num - Skip, MaxLines);
+    OutLines.Reserve(OutLines.Num() + Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        OutLines.Add(Lines[(Head + Skip + i) % Num]);
+    }
+    return Count > 0 ? OutLines.Last().Seq : NextSeq - 1;
+}
+
+FString FMCPLogCapture::FormatLine(const FMCPLogLine& Line)
+{
+    return FString::Printf(TEXT("[%s]%s"), *Line.Timestamp.ToString(TEXT("%Y.%m.%d-%H.%M.%S:%s")),
+        *FOutputDeviceHelper::FormatLogLine(Line.Verbosity, Line.Category, *Line.Message, ELogTimes::None));
+}
+
+TSharedPtr<FJsonObject> FMCPLogCapture::Query(const TSharedPtr<FJsonObject>& Params) const
+{
+    FLogFilter Filter;
+    FString Error;
+    if (!ParseFilter(Params, Filter, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    const int32 NumLines = ParseNumLines(Params);
+    double CursorD = -1.0;
+    const bool bIncremental = Params->TryGetNumberField(TEXT("cursor"), CursorD) && CursorD >= 0.0;
+    const int64 Cursor = bIncremental ? static_cast<int64>(CursorD) : 0;
+    bool bStructured = false;
+    Params->TryGetBoolField(TEXT("structured"), bStructured);
+
+    // Snapshot under the lock, filter outside it so loggers on other threads never wait on a regex
+    TArray<FMCPLogLine> Snapshot;
+    int64 OldestSeq = 0;
+    int64 NewestSeq = 0;
+    {
+        FScopeLock ScopeLock(&Lock);
+        OldestSeq = NextSeq - Lines.Num();
+        NewestSeq = NextSeq - 1;
+    }
+    if (bIncremental)
+    {
+        CopySince(Cursor, Filter.IsEmpty() ? NumLines + 1 : Capacity, Snapshot);
+    }
+    else
+    {
+        // Unfiltered tails only need the last num_lines
+        CopySince(Filter.IsEmpty() ? NewestSeq - NumLines : 0, Capacity, Snapshot);
+    }
+
+    TArray<const FMCPLogLine*> Matches;
+    int64 NextCursor = bIncremental ? FMath::Max(Cursor, OldestSeq - 1) : NewestSeq;
+    bool bHasMore = false;
+    for (const FMCPLogLine& Line : Snapshot)
+    {
+        if (Filter.Matches(Line.Category, Line.Verbosity, Line.Message))
+        {
+            if (bIncremental && Matches.Num() == NumLines)
+            {
+                // Resume from the last returned line next time
+                bHasMore = true;
+                break;
+            }
+            Matches.Add(&Line);
+        }
+        NextCursor = FMath::Max(NextCursor, Line.Seq);
+    }
+    if (bHasMore)
+    {
+        NextCursor = Matches.Last()->Seq;
+    }
+    if (!bIncremental && Matches.Num() > NumLines)
+    {
+        Matches.RemoveAt(0, Matches.Num() - NumLines);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("source"), TEXT("memory"));
+    Result->SetNumberField(TEXT("total_lines"), static_cast<double>(NewestSeq - OldestSeq + 1));
+    Result->SetNumberField(TEXT("returned_lines"), Matches.Num());
+    Result->SetNumberField(TEXT("next_cursor"), static_cast<double>(NextCursor));
+    Result->SetBoolField(TEXT("has_more"), bHasMore);
+    if (bIncremental && Cursor + 1 < OldestSeq)
+    {
+        // The ring wrapped past the caller's cursor; those lines are only in the file now
+        Result->SetNumberField(TEXT("lines_dropped"), static_cast<double>(OldestSeq - Cursor - 1));
+    }
+    if (!Filter.Substring.IsEmpty())
+    {
+        Result->SetStringField(TEXT("filter"), Filter.Substring);
+    }
+
+    if (bStructured)
+    {
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        Entries.Reserve(Matches.Num());
+        for (const FMCPLogLine* Line : Matches)
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetNumberField(TEXT("cursor"), static_cast<double>(Line->Seq));
+            Entry->SetStringField(TEXT("time"), Line->Timestamp.ToIso8601());
+            Entry->SetStringField(TEXT("category"), Line->Category.ToString());
+            Entry->SetStringField(TEXT("verbosity"), ToString(Line->Verbosity));
+            Entry->SetStringField(TEXT("message"), Line->Message);
+            Entries.Add(MakeShared<FJsonValueObject>(Entry));
+        }
+        Result->SetArrayField(TEXT("entries"), Entries);
+    }
+    else
+    {
+        // Joined into a single string (more compact than a JSON array)
+        FString Joined;
+        for (const FMCPLogLine* Line : Matches)
+        {
+            if (!Joined.IsEmpty())
+            {
+                Joined += TEXT("\n");
+            }
+            Joined += FormatLine(*Line);
+        }
+        Result->SetStringField(TEXT("lines"), Joined);
+    }
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPLogCapture::TailFile(const TSharedPtr<FJsonObject>& Params)
+{
+    FLogFilter Filter;
+    FString Error;
+    if (!ParseFilter(Params, Filter, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    const int32 NumLines = ParseNumLines(Params);
+    double MaxBytesD = 1024.0 * 1024.0;
+    Params->TryGetNumberField(TEXT("max_bytes"), MaxBytesD);
+    const int64 MaxBytes = FMath::Clamp<int64>(static_cast<int64>(MaxBytesD), 4096, 16 * 1024 * 1024);
+
+    const FString LogFilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir() / FApp::GetProjectName() + TEXT(".log"));
+    // The engine keeps the log open for writing; OpenRead with bAllowWrite shares it
+    TUniquePtr<IFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*LogFilePath, true));
+    if (!File.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Log file not found at: %s"), *LogFilePath));
+    }
+    const int64 FileSize = File->Size();
+
+    double OffsetD = -1.0;
+    const bool bIncremental = Params->TryGetNumberField(TEXT("offset"), OffsetD) && OffsetD >= 0.0;
+    int64 Offset = bIncremental ? static_cast<int64>(OffsetD) : FMath::Max<int64>(FileSize - MaxBytes, 0);
+    bool bRestarted = false;
+    if (Offset > FileSize)
+    {
+        // A new session started a new file
+        Offset = 0;
+        bRestarted = true;
+    }
+
+    const int64 ReadSize = FMath::Min(MaxBytes, FileSize - Offset);
+    TArray<uint8> Data;
+    Data.SetNumUninitialized(static_cast<int32>(ReadSize));
+    if (ReadSize > 0 && (!File->Seek(Offset) || !File->Read(Data.GetData(), ReadSize)))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to read log file: %s"), *LogFilePath));
+    }
+
+    // Only whole lines; a tail read that starts mid-line skips the partial first line
+    int32 Start = 0;
+    if (Offset == 0 && Data.Num() >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+    {
+        Start = 3;
+    }
+    else if (!bIncremental && Offset > 0)
+    {
+        const int32 FirstNewline = Data.Find('\n');
+        Start = FirstNewline == INDEX_NONE ? Data.Num() : FirstNewline + 1;
+    }
+
+    TArray<FString> Matches;
+    int64 NextOffset = Offset + Start;
+    int32 LinesScanned = 0;
+    bool bHasMore = false;
+    for (int32 Pos = Start; Pos < Data.Num();)
+    {
+        int32 End = Pos;
+        while (End < Data.Num() && Data[End] != '\n')
+        {
+            ++End;
+        }
+        if (End == Data.Num())
+        {
+            // Partial last line: left for the next read
+            break;
+        }
+
+        int32 LineEnd = End;
+        if (LineEnd > Pos && Data[LineEnd - 1] == '\r')
+        {
+            --LineEnd;
+        }
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Pos), LineEnd - Pos);
+        FString Line(Converted.Length(), Converted.Get());
+        ++LinesScanned;
+
+        FName Category;
+        ELogVerbosity::Type Verbosity;
+        ParseFileLine(Line, Category, Verbosity);
+        if (Filter.Matches(Category, Verbosity, Line))
+        {
+            if (bIncremental && Matches.Num() == NumLines)
+            {
+                bHasMore = true;
+                break;
+            }
+            Matches.Add(MoveTemp(Line));
+        }
+        Pos = End + 1;
+        NextOffset = Offset + Pos;
+    }
+    if (!bIncremental && Matches.Num() > NumLines)
+    {
+        Matches.RemoveAt(0, Matches.Num() - NumLines);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("source"), TEXT("file"));
+    Result->SetStringField(TEXT("log_file"), LogFilePath);
+    Result->SetNumberField(TEXT("file_bytes"), static_cast<double>(FileSize));
+    Result->SetNumberField(TEXT("lines_scanned"), LinesScanned);
+    Result->SetNumberField(TEXT("returned_lines"), Matches.Num());
+    Result->SetNumberField(TEXT("next_offset"), static_cast<double>(NextOffset));
+    Result->SetBoolField(TEXT("has_more"), bHasMore || NextOffset < FileSize);
+    if (bRestarted)
+    {
+        Result->SetBoolField(TEXT("restarted"), true);
+    }
+    if (!Filter.Substring.IsEmpty())
+    {
+        Result->SetStringField(TEXT("filter"), Filter.Substring);
+    }
+    Result->SetStringField(TEXT("lines"), FString::Join(Matches, TEXT("\n")));
+    return Result;
+}
@@ -0,0 +1,327 @@
+#include "MCPMessagePack.h"
+#include "Misc/Base64.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Packed MessagePack arrays are copied as little-endian memory");
+
+namespace
+{
+    // Cursor over one MessagePack message; every read is bounds checked
+    struct FMsgPackReader
+    {
+        const uint8* Data;
+        int32 Size;
+        int32 Pos = 0;
+        FString Error;
+
+        static constexpr int32 MaxDepth = 64;
+
+        bool Fail(const FString& Message)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = FString::Printf(TEXT("%s (at byte %d)"), *Message, Pos);
+            }
+            return false;
+        }
+
+        bool Need(int64 Count)
+        {
+            return Count >= 0 && Pos + Count <= Size ? true : Fail(TEXT("Truncated MessagePack data"));
+        }
+
+        uint64 ReadBE(int32 Bytes)
+        {
+            uint64 Value = 0;
+            for (int32 i = 0; i < Bytes; ++i)
+            {
+                Value = (Value << 8) | Data[Pos++];
+            }
+            return Value;
+        }
+
+        bool ReadLength(int32 Bytes, uint32& OutLength)
+        {
+            if (!Need(Bytes))
+            {
+                return false;
+            }
+            OutLength = static_cast<uint32>(ReadBE(Bytes));
+            return true;
+        }
+
+        bool ReadString(uint32 Length, FString& Out)
+        {
+            if (!Need(Length))
+            {
+                return false;
+            }
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Pos), Length);
+            Out = FString(Converted.Length(), Converted.Get());
+            Pos += Length;
+            return true;
+        }
+
+        template <typename T>
+        TSharedPtr<FJsonValue> ReadPackedArray(uint32 Length)
+        {
+            if (Length % sizeof(T) != 0)
+            {
+                Fail(TEXT("Packed array size is not a multiple of its element size"));
+                return nullptr;
+            }
+            const int32 Count = Length / sizeof(T);
+            TArray<TSharedPtr<FJsonValue>> Values;
+            Values.Reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                T Element;
+                FMemory::Memcpy(&Element, Data + Pos + i * sizeof(T), sizeof(T));
+                Values.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Element)));
+            }
+            Pos += Length;
+            return MakeShared<FJsonValueArray>(Values);
+        }
+
+        TSharedPtr<FJsonValue> ReadExt(uint32 Length)
+        {
+            if (!Need(1 + static_cast<int64>(Length)))
+            {
+                return nullptr;
+            }
+            const int8 Type = static_cast<int8>(Data[Pos++]);
+            switch (Type)
+            {
+            case FMCPMessagePack::ExtFloat32Array: return ReadPackedArray<float>(Length);
+            case FMCPMessagePack::ExtInt32Array: return ReadPackedArray<int32>(Length);
+            case FMCPMessagePack::ExtFloat64Array: return ReadPackedArray<double>(Length);
+            default:
+                Fail(FString::Printf(TEXT("Unsupported MessagePack ext type %d"), Type));
+                return nullptr;
+            }
+        }
+
+        TSharedPtr<FJsonValue> ReadArray(uint32 Count, int32 Depth)
+        {
+            // Every element takes at least one byte, so a count larger than the rest is corrupt
+            if (!Need(Count))
+            {
+                return nullptr;
+            }
+            TArray<TSharedPtr<FJsonValue>> Values;
+            Values.Reserve(Count);
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                TSharedPtr<FJsonValue> Element = ReadValue(Depth + 1);
+                if (!Element.IsValid())
+                {
+                    return nullptr;
+                }
+                Values.Add(Element);
+            }
+            return MakeShared<FJsonValueArray>(Values);
+        }
+
+        TSharedPtr<FJsonObject> ReadMap(uint32 Count, int32 Depth)
+        {
+            if (!Need(static_cast<int64>(Count) * 2))
+            {
+                return nullptr;
+            }
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                TSharedPtr<FJsonValue> Key = ReadValue(Depth + 1);
+                if (!Key.IsValid())
+                {
+                    return nullptr;
+                }
+                if (Key->Type != EJson::String)
+                {
+                    Fail(TEXT("MessagePack map keys must be strings"));
+                    return nullptr;
+                }
+                TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                Object->SetField(Key->AsString(), Value);
+            }
+            return Object;
+        }
+
+        TSharedPtr<FJsonValue> ReadValue(int32 Depth)
+        {
+            if (Depth > MaxDepth)
+            {
+                Fail(TEXT("MessagePack data nested too deeply"));
+                return nullptr;
+            }
+            if (!Need(1))
+            {
+                return nullptr;
+            }
+
+            const uint8 Tag = Data[Pos++];
+            uint32 Length = 0;
+            FString String;
+
+            if (Tag <= 0x7f)
+            {
+                return MakeShared<FJsonValueNumber>(Tag);
+            }
+            if (Tag >= 0xe0)
+            {
+                return MakeShared<FJsonValueNumber>(static_cast<int8>(Tag));
+            }
+            if ((Tag & 0xf0) == 0x80)
+            {
+                TSharedPtr<FJsonObject> Object = ReadMap(Tag & 0x0f, Depth);
+                return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+            }
+            if ((Tag & 0xf0) == 0x90)
+            {
+                return ReadArray(Tag & 0x0f, Depth);
+            }
+            if ((Tag & 0xe0) == 0xa0)
+            {
+                return ReadString(Tag & 0x1f, String) ? MakeShared<FJsonValueString>(String) : nullptr;
+            }
+
+            switch (Tag)
+            {
+            case 0xc0: return MakeShared<FJsonValueNull>();
+            case 0xc2: return MakeShared<FJsonValueBoolean>(false);
+            case 0xc3: return MakeShared<FJsonValueBoolean>(true);
+
+            case 0xc4: case 0xc5: case 0xc6:
+            {
+                // Raw bytes: handlers already take binary payloads as base64 strings
+                if (!ReadLength(1 << (Tag - 0xc4), Length) || !Need(Length))
+                {
+                    return nullptr;
+                }
+                FString Encoded = FBase64::Encode(Data + Pos, Length);
+                Pos += Length;
+                return MakeShared<FJsonValueString>(Encoded);
+            }
+
+            case 0xc7: case 0xc8: case 0xc9:
+                return ReadLength(1 << (Tag - 0xc7), Length) ? ReadExt(Length) : nullptr;
+            case 0xd4: case 0xd5: case 0xd6: case 0xd7: case 0xd8:
+                return ReadExt(1u << (Tag - 0xd4));
+
+            case 0xca:
+            {
+                if (!Need(4))
+                {
+                    return nullptr;
+                }
+                const uint32 Bits = static_cast<uint32>(ReadBE(4));
+                float Value;
+                FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+                return MakeShared<FJsonValueNumber>(Value);
+            }
+            case 0xcb:
+            {
+                if (!Need(8))
+                {
+                    return nullptr;
+                }
+                const uint64 Bits = ReadBE(8);
+                double Value;
+                FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+                return MakeShared<FJsonValueNumber>(Value);
+            }
+
+            case 0xcc: case 0xcd: case 0xce: case 0xcf:
+            {
+                const int32 Bytes = 1 << (Tag - 0xcc);
+                if (!Need(Bytes))
+                {
+                    return nullptr;
+                }
+                return MakeShared<FJsonValueNumber>(static_cast<double>(ReadBE(Bytes)));
+            }
+            case 0xd0: case 0xd1: case 0xd2: case 0xd3:
+            {
+                const int32 Bytes = 1 << (Tag - 0xd0);
+                if (!Need(Bytes))
+                {
+                    return nullptr;
+                }
+                // Sign-extend from the encoded width
+                const uint64 Raw = ReadBE(Bytes);
+                const int32 Shift = 64 - Bytes * 8;
+                const int64 Value = static_cast<int64>(Raw << Shift) >> Shift;
+                return MakeShared<FJsonValueNumber>(static_cast<double>(Value));
+            }
+
+            case 0xd9: case 0xda: case 0xdb:
+                return ReadLength(1 << (Tag - 0xd9), Length) && ReadString(Length, String)
+                    ? MakeShared<FJsonValueString>(String) : nullptr;
+
+            case 0xdc: case 0xdd:
+                return ReadLength(Tag == 0xdc ? 2 : 4, Length) ? ReadArray(Length, Depth) : nullptr;
+
+            case 0xde: case 0xdf:
+            {
+                if (!ReadLength(Tag == 0xde ? 2 : 4, Length))
+                {
+                    return nullptr;
+                }
+                TSharedPtr<FJsonObject> Object = ReadMap(Length, Depth);
+                return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+            }
+
+            default:
+                Pos--;
+                Fail(FString::Printf(TEXT("Invalid MessagePack tag 0x%02x"), Tag));
+                return nullptr;
+            }
+        }
+    };
+}
+
+bool FMCPMessagePack::DecodeObject(const uint8* Data, int32 Size, TSharedPtr<FJsonObject>& OutObject, FString& OutError)
+{
+    FMsgPackReader Reader{Data, Size};
+    TSharedPtr<FJsonValue> Value = Reader.ReadValue(0);
+    if (!Value.IsValid())
+    {
+        OutError = Reader.Error;
+        return false;
+    }
+    if (Value->Type != EJson::Object)
+    {
+        OutError = TEXT("MessagePack message must be a map");
+        return false;
+    }
+    if (Reader.Pos != Size)
+    {
+        OutError = FString::Printf(TEXT("%d trailing bytes after MessagePack message"), Size - Reader.Pos);
+        return false;
+    }
+    OutObject = Value->AsObject();
+    return true;
+}
+
+bool FMCPMessagePack::ParseWireFormat(const FString& Name, EMCPWireFormat& OutFormat)
+{
+    if (Name.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+    {
+        OutFormat = EMCPWireFormat::Json;
+        return true;
+    }
+    if (Name.Equals(TEXT("msgpack"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("messagepack"), ESearchCase::IgnoreCase))
+    {
+        OutFormat = EMCPWireFormat::MessagePack;
+        return true;
+    }
+    return false;
+}
+
+const TCHAR* FMCPMessagePack::WireFormatName(EMCPWireFormat Format)
+{
+    return Format == EMCPWireFormat::MessagePack ? TEXT("msgpack") : TEXT("json");
+}
@@ -0,0 +1,284 @@
+#include "MCPRequestLog.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    struct FRequestLogState
+    {
+        FCriticalSection Lock;
+        /** Ring storage; Records[(Head + i) % Num] is the i-th oldest once full */
+        TArray<FMCPRequestRecord> Records;
+        int32 Head = 0;
+        int32 Capacity = 1024;
+        int64 NextId = 1;
+
+        EMCPLogMode Mode = EMCPLogMode::Sampled;
+        int32 SampleEvery = 50;
+        double SlowMs = 500.0;
+
+        // Cost of the log itself, reported by GetStatus
+        double RecordSeconds = 0.0;
+        double LogSeconds = 0.0;
+        int64 LinesWritten = 0;
+        int64 LinesSuppressed = 0;
+    };
+
+    FRequestLogState& GetState()
+    {
+        static FRequestLogState State;
+        return State;
+    }
+
+    /** Oldest-first view over the ring, without copying it */
+    template <typename FunctorType>
+    void ForEachRecord(const FRequestLogState& State, FunctorType&& Functor)
+    {
+        const int32 Num = State.Records.Num();
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Functor(State.Records[(State.Head + i) % Num]);
+        }
+    }
+
+    bool ShouldLog(const FRequestLogState& State, const FMCPRequestRecord& Record)
+    {
+        const bool bNotable = !Record.Sample.bSuccess || Record.Sample.TotalMs >= State.SlowMs;
+        switch (State.Mode)
+        {
+        case EMCPLogMode::Off: return false;
+        case EMCPLogMode::Errors: return bNotable;
+        case EMCPLogMode::Sampled: return bNotable || Record.Id % FMath::Max(State.SampleEvery, 1) == 0;
+        default: return true;
+        }
+    }
+
+    TSharedPtr<FJsonObject> RecordToJson(const FMCPRequestRecord& Record)
+    {
+        const FMCPCommandSample& Sample = Record.Sample;
+        TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("id"), static_cast<double>(Record.Id));
+        Object->SetStringField(TEXT("time"), Record.Timestamp.ToIso8601());
+        Object->SetStringField(TEXT("command"), Record.Command);
+        Object->SetStringField(TEXT("format"), FMCPMessagePack::WireFormatName(Record.Format));
+        Object->SetBoolField(TEXT("success"), Sample.bSuccess);
+        if (!Sample.Error.IsEmpty())
+        {
+            Object->SetStringField(TEXT("error"), Sample.Error);
+        }
+        Object->SetBoolField(TEXT("streamed"), Sample.bStreamed);
+        Object->SetNumberField(TEXT("bytes_in"), static_cast<double>(Sample.BytesIn));
+        Object->SetNumberField(TEXT("bytes_out"), static_cast<double>(Sample.BytesOut));
+        Object->SetNumberField(TEXT("queue_ms"), Sample.QueueMs);
+        Object->SetNumberField(TEXT("exec_ms"), Sample.ExecMs);
+        Object->SetNumberField(TEXT("serialize_ms"), Sample.SerializeMs);
+        Object->SetNumberField(TEXT("total_ms"), Sample.TotalMs);
+        return Object;
+    }
+
+    void Resize(FRequestLogState& State, int32 NewCapacity)
+    {
+        // Unroll the ring oldest-first, keeping the newest records that still fit
+        TArray<FMCPRequestRecord> Ordered;
+        Ordered.Reserve(FMath::Min(State.Records.Num(), NewCapacity));
+        const int32 Skip = FMath::Max(State.Records.Num() - NewCapacity, 0);
+        int32 Index = 0;
+        ForEachRecord(State, [&](const FMCPRequestRecord& Record)
+        {
+            if (Index++ >= Skip)
+            {
+                Ordered.Add(Record);
+            }
+        });
+        State.Records = MoveTemp(Ordered);
+        State.Head = 0;
+        State.Capacity = NewCapacity;
+    }
+}
+
+int64 FMCPRequestLog::Add(const FString& Command, EMCPWireFormat Format, const FMCPCommandSample& Sample)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    FRequestLogState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+
+    FMCPRequestRecord Record;
+    Record.Id = State.NextId++;
+    Record.Timestamp = FDateTime::UtcNow();
+    Record.Command = Command;
+    Record.Format = Format;
+    Record.Sample = Sample;
+
+    const bool bLog = ShouldLog(State, Record);
+    const int64 Id = Record.Id;
+    if (State.Records.Num() < State.Capacity)
+    {
+        State.Records.Add(MoveTemp(Record));
+    }
+    else
+    {
+        // Full: overwrite the oldest
+        State.Records[State.Head] = MoveTemp(Record);
+        State.Head = (State.Head + 1) % State.Capacity;
+    }
+    const double LogStart = FPlatformTime::Seconds();
+    State.RecordSeconds += LogStart - StartTime;
+
+    if (!bLog)
+    {
+        ++State.LinesSuppressed;
+        return Id;
+    }
+
+    if (Sample.bSuccess && Sample.TotalMs < State.SlowMs)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCP #%lld %s ok %.1f ms (queue %.1f, exec %.1f, serialize %.1f) in %lld B out %lld B"),
+            Id, *Command, Sample.TotalMs, Sample.QueueMs, Sample.ExecMs, Sample.SerializeMs, Sample.BytesIn, Sample.BytesOut);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCP #%lld %s %s %.1f ms (queue %.1f, exec %.1f, serialize %.1f) in %lld B out %lld B%s%s"),
+            Id, *Command, Sample.bSuccess ? TEXT("slow") : TEXT("FAILED"), Sample.TotalMs, Sample.QueueMs, Sample.ExecMs,
+            Sample.SerializeMs, Sample.BytesIn, Sample.BytesOut, Sample.Error.IsEmpty() ? TEXT("") : TEXT(": "), *Sample.Error);
+    }
+    ++State.LinesWritten;
+    State.LogSeconds += FPlatformTime::Seconds() - LogStart;
+    return Id;
+}
+
+TSharedPtr<FJsonObject> FMCPRequestLog::Query(const TSharedPtr<FJsonObject>& Params)
+{
+    double SinceId = 0.0;
+    FString CommandFilter;
+    bool bErrorsOnly = false;
+    double MinTotalMs = 0.0;
+    int32 Limit = 100;
+    Params->TryGetNumberField(TEXT("since_id"), SinceId);
+    Params->TryGetStringField(TEXT("command"), CommandFilter);
+    Params->TryGetBoolField(TEXT("errors_only"), bErrorsOnly);
+    Params->TryGetNumberField(TEXT("min_total_ms"), MinTotalMs);
+    if (Params->HasField(TEXT("limit")))
+    {
+        Limit = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("limit"))), 1, 10000);
+    }
+
+    FRequestLogState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+
+    TArray<const FMCPRequestRecord*> Matches;
+    ForEachRecord(State, [&](const FMCPRequestRecord& Record)
+    {
+        if (Record.Id > static_cast<int64>(SinceId)
+            && (CommandFilter.IsEmpty() || Record.Command.Contains(CommandFilter))
+            && (!bErrorsOnly || !Record.Sample.bSuccess)
+            && Record.Sample.TotalMs >= MinTotalMs)
+        {
+            Matches.Add(&Record);
+        }
+    });
+
+    TArray<TSharedPtr<FJsonValue>> Records;
+    for (int32 i = FMath::Max(Matches.Num() - Limit, 0); i < Matches.Num(); ++i)
+    {
+        Records.Add(MakeShared<FJsonValueObject>(RecordToJson(*Matches[i])));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetArrayField(TEXT("records"), Records);
+    Result->SetNumberField(TEXT("matched"), Matches.Num());
+    Result->SetBoolField(TEXT("truncated"), Matches.Num() > Limit);
+    // Pass back as since_id to poll for newer requests only
+    Result->SetNumberField(TEXT("last_id"), static_cast<double>(State.NextId - 1));
+    Result->SetNumberField(TEXT("oldest_id"), State.Records.Num() > 0 ? static_cast<double>(State.NextId - State.Records.Num()) : 0.0);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPRequestLog::Configure(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ModeName;
+    EMCPLogMode Mode = EMCPLogMode::Sampled;
+    if (Params->TryGetStringField(TEXT("mode"), ModeName) && !ParseMode(ModeName, Mode))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown log mode '%s' (off, errors, sampled, all)"), *ModeName));
+    }
+
+    {
+        FRequestLogState& State = GetState();
+        FScopeLock ScopeLock(&State.Lock);
+        if (!ModeName.IsEmpty())
+        {
+            State.Mode = Mode;
+        }
+        if (Params->HasField(TEXT("sample_every")))
+        {
+            State.SampleEvery = FMath::Max(static_cast<int32>(Params->GetNumberField(TEXT("sample_every"))), 1);
+        }
+        Params->TryGetNumberField(TEXT("slow_ms"), State.SlowMs);
+        if (Params->HasField(TEXT("capacity")))
+        {
+            const int32 Capacity = FMath::Clamp(static_cast<int32>(Params->GetNumberField(TEXT("capacity"))), 16, 100000);
+            if (Capacity != State.Capacity)
+            {
+                Resize(State, Capacity);
+            }
+        }
+    }
+    return GetStatus();
+}
+
+TSharedPtr<FJsonObject> FMCPRequestLog::GetStatus()
+{
+    FRequestLogState& State = GetState();
+    FScopeLock ScopeLock(&State.Lock);
+
+    int64 StringBytes = 0;
+    ForEachRecord(State, [&](const FMCPRequestRecord& Record)
+    {
+        StringBytes += Record.Command.GetAllocatedSize() + Record.Sample.Error.GetAllocatedSize();
+    });
+    const int64 Recorded = State.NextId - 1;
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("mode"), ModeToString(State.Mode));
+    Result->SetNumberField(TEXT("sample_every"), State.SampleEvery);
+    Result->SetNumberField(TEXT("slow_ms"), State.SlowMs);
+    Result->SetNumberField(TEXT("capacity"), State.Capacity);
+    Result->SetNumberField(TEXT("records"), State.Records.Num());
+    Result->SetNumberField(TEXT("record_bytes"), static_cast<double>(sizeof(FMCPRequestRecord)));
+    Result->SetNumberField(TEXT("memory_bytes"), static_cast<double>(State.Records.GetAllocatedSize() + StringBytes));
+    Result->SetNumberField(TEXT("memory_bytes_at_capacity"),
+        State.Records.Num() > 0
+            ? static_cast<double>(State.Capacity) * (sizeof(FMCPRequestRecord) + static_cast<double>(StringBytes) / State.Records.Num())
+            : static_cast<double>(State.Capacity) * sizeof(FMCPRequestRecord));
+    Result->SetNumberField(TEXT("requests_recorded"), static_cast<double>(Recorded));
+    Result->SetNumberField(TEXT("record_us_mean"), Recorded > 0 ? State.RecordSeconds * 1e6 / Recorded : 0.0);
+    Result->SetNumberField(TEXT("log_lines_written"), static_cast<double>(State.LinesWritten));
+    Result->SetNumberField(TEXT("log_lines_suppressed"), static_cast<double>(State.LinesSuppressed));
+    Result->SetNumberField(TEXT("log_us_per_line"), State.LinesWritten > 0 ? State.LogSeconds * 1e6 / State.LinesWritten : 0.0);
+    Result->SetNumberField(TEXT("log_ms_total"), State.LogSeconds * 1000.0);
+    return Result;
+}
+
+bool FMCPRequestLog::ParseMode(const FString& Name, EMCPLogMode& OutMode)
+{
+    if (Name.Equals(TEXT("off"), ESearchCase::IgnoreCase)) { OutMode = EMCPLogMode::Off; return true; }
+    if (Name.Equals(TEXT("errors"), ESearchCase::IgnoreCase)) { OutMode = EMCPLogMode::Errors; return true; }
+    if (Name.Equals(TEXT("sampled"), ESearchCase::IgnoreCase)) { OutMode = EMCPLogMode::Sampled; return true; }
+    if (Name.Equals(TEXT("all"), ESearchCase::IgnoreCase)) { OutMode = EMCPLogMode::All; return true; }
+    return false;
+}
+
+FString FMCPRequestLog::ModeToString(EMCPLogMode Mode)
+{
+    switch (Mode)
+    {
+    case EMCPLogMode::Off: return TEXT("off");
+    case EMCPLogMode::Errors: return TEXT("errors");
+    case EMCPLogMode::All: return TEXT("all");
+    default: return TEXT("sampled");
+    }
+}
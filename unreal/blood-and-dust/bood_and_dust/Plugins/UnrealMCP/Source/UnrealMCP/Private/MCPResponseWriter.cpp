@@ -0,0 +1,517 @@
+#include "MCPResponseWriter.h"
+#include "Algo/AllOf.h"
+
+FMCPResponseWriter::FMCPResponseWriter(TArray<uint8>& InBuffer, EMCPWireFormat InFormat)
+    : Buffer(InBuffer)
+    , Format(InFormat)
+{
+}
+
+void FMCPResponseWriter::Separator()
+{
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+    if (Containers.Num() > 0)
+    {
+        FContainer& Container = Containers.Last();
+        if (Format == EMCPWireFormat::Json && Container.Count > 0)
+        {
+            Buffer.Add(',');
+        }
+        ++Container.Count;
+    }
+}
+
+void FMCPResponseWriter::BeginContainer(uint8 PackTag, ANSICHAR JsonChar)
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        // map32/array32 with the count filled in by EndContainer
+        Buffer.Add(PackTag);
+        Containers.Add({Buffer.Num(), 0});
+        Buffer.AddZeroed(4);
+    }
+    else
+    {
+        Buffer.Add(static_cast<uint8>(JsonChar));
+        Containers.Add({INDEX_NONE, 0});
+    }
+}
+
+void FMCPResponseWriter::EndContainer(ANSICHAR JsonChar)
+{
+    check(Containers.Num() > 0);
+    const FContainer Container = Containers.Pop(EAllowShrinking::No);
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        uint8* Header = Buffer.GetData() + Container.HeaderOffset;
+        Header[0] = static_cast<uint8>(Container.Count >> 24);
+        Header[1] = static_cast<uint8>(Container.Count >> 16);
+        Header[2] = static_cast<uint8>(Container.Count >> 8);
+        Header[3] = static_cast<uint8>(Container.Count);
+    }
+    else
+    {
+        Buffer.Add(static_cast<uint8>(JsonChar));
+    }
+}
+
+void FMCPResponseWriter::Raw(const ANSICHAR* Text)
+{
+    Buffer.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+}
+
+void FMCPResponseWriter::Escaped(FStringView Text)
+{
+    Buffer.Add('"');
+    AppendUTF8(Text, true);
+    Buffer.Add('"');
+}
+
+void FMCPResponseWriter::AppendUTF8(FStringView Text, bool bJsonEscape)
+{
+    const int32 Len = Text.Len();
+    for (int32 i = 0; i < Len; ++i)
+    {
+        uint32 Char = static_cast<uint32>(Text[i]);
+        if (bJsonEscape)
+        {
+            switch (Char)
+            {
+            case '"':  Raw("\\\""); continue;
+            case '\\': Raw("\\\\"); continue;
+            case '\b': Raw("\\b"); continue;
+            case '\f': Raw("\\f"); continue;
+            case '\n': Raw("\\n"); continue;
+            case '\r': Raw("\\r"); continue;
+            case '\t': Raw("\\t"); continue;
+            default: break;
+            }
+
+            if (Char < 0x20)
+            {
+                ANSICHAR Escape[8];
+                FCStringAnsi::Snprintf(Escape, sizeof(Escape), "\\u%04x", Char);
+                Raw(Escape);
+                continue;
+            }
+        }
+
+        // UTF-16 TCHAR (Windows): combine surrogate pairs into one code point
+        if (Char >= 0xD800 && Char <= 0xDBFF && i + 1 < Len)
+        {
+            const uint32 Low = static_cast<uint32>(Text[i + 1]);
+            if (Low >= 0xDC00 && Low <= 0xDFFF)
+            {
+                Char = 0x10000 + ((Char - 0xD800) << 10) + (Low - 0xDC00);
+                ++i;
+            }
+        }
+
+        if (Char < 0x80)
+        {
+            Buffer.Add(static_cast<uint8>(Char));
+        }
+        else if (Char < 0x800)
+        {
+            Buffer.Add(static_cast<uint8>(0xC0 | (Char >> 6)));
+            Buffer.Add(static_cast<uint8>(0x80 | (Char & 0x3F)));
+        }
+        else if (Char < 0x10000)
+        {
+            Buffer.Add(static_cast<uint8>(0xE0 | (Char >> 12)));
+            Buffer.Add(static_cast<uint8>(0x80 | ((Char >> 6) & 0x3F)));
+            Buffer.Add(static_cast<uint8>(0x80 | (Char & 0x3F)));
+        }
+        else
+        {
+            Buffer.Add(static_cast<uint8>(0xF0 | (Char >> 18)));
+            Buffer.Add(static_cast<uint8>(0x80 | ((Char >> 12) & 0x3F)));
+            Buffer.Add(static_cast<uint8>(0x80 | ((Char >> 6) & 0x3F)));
+            Buffer.Add(static_cast<uint8>(0x80 | (Char & 0x3F)));
+        }
+    }
+}
+
+void FMCPResponseWriter::PackBigEndian(uint64 Value, int32 Bytes)
+{
+    for (int32 Shift = (Bytes - 1) * 8; Shift >= 0; Shift -= 8)
+    {
+        Buffer.Add(static_cast<uint8>(Value >> Shift));
+    }
+}
+
+void FMCPResponseWriter::PackString(FStringView Text)
+{
+    // The UTF-8 length is only known after encoding: write the bytes, then slot the smallest
+    // header in front of them (only this string's bytes move)
+    const int32 Start = Buffer.Num();
+    AppendUTF8(Text, false);
+    const uint32 Length = static_cast<uint32>(Buffer.Num() - Start);
+
+    uint8 Header[5];
+    int32 HeaderSize;
+    if (Length < 32)
+    {
+        Header[0] = static_cast<uint8>(0xa0 | Length);
+        HeaderSize = 1;
+    }
+    else if (Length <= 0xff)
+    {
+        Header[0] = 0xd9;
+        Header[1] = static_cast<uint8>(Length);
+        HeaderSize = 2;
+    }
+    else if (Length <= 0xffff)
+    {
+        Header[0] = 0xda;
+        Header[1] = static_cast<uint8>(Length >> 8);
+        Header[2] = static_cast<uint8>(Length);
+        HeaderSize = 3;
+    }
+    else
+    {
+        Header[0] = 0xdb;
+        Header[1] = static_cast<uint8>(Length >> 24);
+        Header[2] = static_cast<uint8>(Length >> 16);
+        Header[3] = static_cast<uint8>(Length >> 8);
+        Header[4] = static_cast<uint8>(Length);
+        HeaderSize = 5;
+    }
+    Buffer.Insert(Header, HeaderSize, Start);
+}
+
+void FMCPResponseWriter::PackExt(int8 Type, const void* Data, int32 Size)
+{
+    Buffer.Add(0xc9);
+    PackBigEndian(static_cast<uint32>(Size), 4);
+    Buffer.Add(static_cast<uint8>(Type));
+    Buffer.Append(static_cast<const uint8*>(Data), Size);
+}
+
+void FMCPResponseWriter::BeginObject()
+{
+    BeginContainer(0xdf, '{');
+}
+
+void FMCPResponseWriter::EndObject()
+{
+    EndContainer('}');
+}
+
+void FMCPResponseWriter::BeginArray()
+{
+    BeginContainer(0xdd, '[');
+}
+
+void FMCPResponseWriter::EndArray()
+{
+    EndContainer(']');
+}
+
+void FMCPResponseWriter::Key(FStringView Name)
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        PackString(Name);
+    }
+    else
+    {
+        Escaped(Name);
+        Buffer.Add(':');
+    }
+    bAfterKey = true;
+}
+
+void FMCPResponseWriter::String(FStringView Value)
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        PackString(Value);
+    }
+    else
+    {
+        Escaped(Value);
+    }
+}
+
+void FMCPResponseWriter::Number(double Value)
+{
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        // Integral values (counts, indices) go out as ints, like %.17g prints them in JSON
+        if (FMath::IsFinite(Value) && Value == FMath::RoundToDouble(Value) && FMath::Abs(Value) < 9.0e18)
+        {
+            Int(static_cast<int64>(Value));
+            return;
+        }
+        Separator();
+        if (!FMath::IsFinite(Value))
+        {
+            Buffer.Add(0xc0);
+            return;
+        }
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        Buffer.Add(0xcb);
+        PackBigEndian(Bits, 8);
+        return;
+    }
+
+    Separator();
+    if (!FMath::IsFinite(Value))
+    {
+        // Not representable in JSON
+        Raw("null");
+        return;
+    }
+    ANSICHAR Text[32];
+    FCStringAnsi::Snprintf(Text, sizeof(Text), "%.17g", Value);
+    Raw(Text);
+}
+
+void FMCPResponseWriter::Int(int64 Value)
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        if (Value >= 0 && Value <= 0x7f)
+        {
+            Buffer.Add(static_cast<uint8>(Value));
+        }
+        else if (Value < 0 && Value >= -32)
+        {
+            Buffer.Add(static_cast<uint8>(static_cast<int8>(Value)));
+        }
+        else if (Value >= MIN_int32 && Value <= MAX_int32)
+        {
+            Buffer.Add(0xd2);
+            PackBigEndian(static_cast<uint32>(static_cast<int32>(Value)), 4);
+        }
+        else
+        {
+            Buffer.Add(0xd3);
+            PackBigEndian(static_cast<uint64>(Value), 8);
+        }
+        return;
+    }
+
+    ANSICHAR Text[24];
+    FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld", static_cast<long long>(Value));
+    Raw(Text);
+}
+
+void FMCPResponseWriter::Bool(bool Value)
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        Buffer.Add(Value ? 0xc3 : 0xc2);
+        return;
+    }
+    Raw(Value ? "true" : "false");
+}
+
+void FMCPResponseWriter::Null()
+{
+    Separator();
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        Buffer.Add(0xc0);
+        return;
+    }
+    Raw("null");
+}
+
+void FMCPResponseWriter::Vector(const FVector& Value)
+{
+    BeginArray();
+    Number(Value.X);
+    Number(Value.Y);
+    Number(Value.Z);
+    EndArray();
+}
+
+void FMCPResponseWriter::Rotator(const FRotator& Value)
+{
+    BeginArray();
+    Number(Value.Pitch);
+    Number(Value.Yaw);
+    Number(Value.Roll);
+    EndArray();
+}
+
+void FMCPResponseWriter::FloatArray(TConstArrayView<float> Values)
+{
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        Separator();
+        PackExt(FMCPMessagePack::ExtFloat32Array, Values.GetData(), Values.Num() * sizeof(float));
+        return;
+    }
+    BeginArray();
+    for (float Value : Values)
+    {
+        Number(Value);
+    }
+    EndArray();
+}
+
+void FMCPResponseWriter::IntArray(TConstArrayView<int32> Values)
+{
+    if (Format == EMCPWireFormat::MessagePack)
+    {
+        Separator();
+        PackExt(FMCPMessagePack::ExtInt32Array, Values.GetData(), Values.Num() * sizeof(int32));
+        return;
+    }
+    BeginArray();
+    for (int32 Value : Values)
+    {
+        Int(Value);
+    }
+    EndArray();
+}
+
+void FMCPResponseWriter::PackNumberArray(const TArray<TSharedPtr<FJsonValue>>& Values)
+{
+    // Narrowest packed type that holds every element exactly
+    bool bAllInt32 = true;
+    bool bAllFloat32 = true;
+    for (const TSharedPtr<FJsonValue>& Element : Values)
+    {
+        const double Value = Element->AsNumber();
+        bAllInt32 &= Value == FMath::RoundToDouble(Value) && Value >= MIN_int32 && Value <= MAX_int32;
+        bAllFloat32 &= static_cast<double>(static_cast<float>(Value)) == Value;
+    }
+
+    Separator();
+    if (bAllInt32)
+    {
+        TArray<int32> Packed;
+        Packed.Reserve(Values.Num());
+        for (const TSharedPtr<FJsonValue>& Element : Values)
+        {
+            Packed.Add(static_cast<int32>(Element->AsNumber()));
+        }
+        PackExt(FMCPMessagePack::ExtInt32Array, Packed.GetData(), Packed.Num() * sizeof(int32));
+    }
+    else if (bAllFloat32)
+    {
+        TArray<float> Packed;
+        Packed.Reserve(Values.Num());
+        for (const TSharedPtr<FJsonValue>& Element : Values)
+        {
+            Packed.Add(static_cast<float>(Element->AsNumber()));
+        }
+        PackExt(FMCPMessagePack::ExtFloat32Array, Packed.GetData(), Packed.Num() * sizeof(float));
+    }
+    else
+    {
+        TArray<double> Packed;
+        Packed.Reserve(Values.Num());
+        for (const TSharedPtr<FJsonValue>& Element : Values)
+        {
+            Packed.Add(Element->AsNumber());
+        }
+        PackExt(FMCPMessagePack::ExtFloat64Array, Packed.GetData(), Packed.Num() * sizeof(double));
+    }
+}
+
+void FMCPResponseWriter::Value(const TSharedPtr<FJsonValue>& InValue)
+{
+    if (!InValue.IsValid())
+    {
+        Null();
+        return;
+    }
+
+    switch (InValue->Type)
+    {
+    case EJson::String:
+        String(InValue->AsString());
+        break;
+    case EJson::Number:
+        Number(InValue->AsNumber());
+        break;
+    case EJson::Boolean:
+        Bool(InValue->AsBool());
+        break;
+    case EJson::Array:
+    {
+        const TArray<TSharedPtr<FJsonValue>>& Elements = InValue->AsArray();
+        if (Format == EMCPWireFormat::MessagePack && Elements.Num() >= FMCPMessagePack::PackedArrayMinLength
+            && Algo::AllOf(Elements, [](const TSharedPtr<FJsonValue>& Element)
+            {
+                return Element.IsValid() && Element->Type == EJson::Number && FMath::IsFinite(Element->AsNumber());
+            }))
+        {
+            PackNumberArray(Elements);
+            break;
+        }
+        BeginArray();
+        for (const TSharedPtr<FJsonValue>& Element : Elements)
+        {
+            Value(Element);
+        }
+        EndArray();
+        break;
+    }
+    case EJson::Object:
+        Object(InValue->AsObject());
+        break;
+    default:
+        Null();
+        break;
+    }
+}
+
+void FMCPResponseWriter::Object(const TSharedPtr<FJsonObject>& InObject)
+{
+    if (!InObject.IsValid())
+    {
+        Null();
+        return;
+    }
+
+    BeginObject();
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : InObject->Values)
+    {
+        Key(Pair.Key);
+        Value(Pair.Value);
+    }
+    EndObject();
+}
+
+void FMCPResponseWriter::BeginSuccessEnvelope()
+{
+    BeginObject();
+    StringField(TEXT("status"), TEXT("success"));
+    Key(TEXT("result"));
+}
+
+void FMCPResponseWriter::EndSuccessEnvelope()
+{
+    EndObject();
+}
+
+void FMCPResponseWriter::SuccessEnvelope(const TSharedPtr<FJsonObject>& Result)
+{
+    BeginSuccessEnvelope();
+    Object(Result);
+    EndSuccessEnvelope();
+}
+
+void FMCPResponseWriter::ErrorEnvelope(FStringView Error)
+{
+    BeginObject();
+    StringField(TEXT("status"), TEXT("error"));
+    StringField(TEXT("error"), Error);
+    EndObject();
+}
@@ -0,0 +1,383 @@
+#include "MCPSceneJournal.h"
+#include "MCPResponseWriter.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Versions at which each kind of change last happened to one actor (0: never since the journal started) */
+    struct FActorJournalEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FString Name;
+        FString Class;
+        int64 AddedVersion = 0;
+        int64 RemovedVersion = 0;
+        int64 TransformVersion = 0;
+        int64 ComponentsVersion = 0;
+        int64 PropertiesVersion = 0;
+
+        int64 LastVersion() const
+        {
+            return FMath::Max(FMath::Max(AddedVersion, RemovedVersion),
+                FMath::Max(TransformVersion, FMath::Max(ComponentsVersion, PropertiesVersion)));
+        }
+    };
+
+    enum class EActorChange : uint8
+    {
+        Added,
+        Removed,
+        Transform,
+        Components,
+        Properties
+    };
+
+    /** Past this many touched actors the journal is truncated rather than grown */
+    constexpr int32 MaxEntries = 50000;
+
+    struct FSceneJournalState
+    {
+        bool bStarted = false;
+        /** Deltas can be answered for since >= BaseVersion */
+        int64 BaseVersion = 0;
+        int64 Version = 0;
+        FString TruncationReason;
+        TMap<TObjectKey<AActor>, FActorJournalEntry> Entries;
+
+        FDelegateHandle ActorAddedHandle;
+        FDelegateHandle ActorDeletedHandle;
+        FDelegateHandle ActorMovedHandle;
+        FDelegateHandle ObjectModifiedHandle;
+        FDelegateHandle PropertyChangedHandle;
+        FDelegateHandle MapChangeHandle;
+        FDelegateHandle UndoRedoHandle;
+    };
+
+    FSceneJournalState& GetState()
+    {
+        static FSceneJournalState State;
+        return State;
+    }
+
+    UWorld* GetEditorWorld()
+    {
+        return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    }
+
+    bool IsTrackedActor(const AActor* Actor)
+    {
+        // Same set as the snapshot: the editor world, without transient helpers (capture rig etc.)
+        return Actor && !Actor->HasAnyFlags(RF_Transient | RF_ClassDefaultObject) && Actor->GetWorld() == GetEditorWorld();
+    }
+
+    void Truncate(const TCHAR* Reason)
+    {
+        FSceneJournalState& State = GetState();
+        State.Entries.Reset();
+        State.BaseVersion = ++State.Version;
+        State.TruncationReason = Reason;
+    }
+
+    void Record(AActor* Actor, EActorChange Change)
+    {
+        FSceneJournalState& State = GetState();
+        if (!IsTrackedActor(Actor))
+        {
+            return;
+        }
+
+        FActorJournalEntry& Entry = State.Entries.FindOrAdd(Actor);
+        if (Entry.Name.IsEmpty())
+        {
+            Entry.Actor = Actor;
+            Entry.Name = Actor->GetName();
+            Entry.Class = Actor->GetClass()->GetName();
+        }
+
+        const int64 Version = ++State.Version;
+        switch (Change)
+        {
+        case EActorChange::Added: Entry.AddedVersion = Version; break;
+        case EActorChange::Removed: Entry.RemovedVersion = Version; break;
+        case EActorChange::Transform: Entry.TransformVersion = Version; break;
+        case EActorChange::Components: Entry.ComponentsVersion = Version; break;
+        default: Entry.PropertiesVersion = Version; break;
+        }
+
+        if (State.Entries.Num() > MaxEntries)
+        {
+            Truncate(TEXT("journal full"));
+        }
+    }
+
+    void OnActorAdded(AActor* Actor)
+    {
+        Record(Actor, EActorChange::Added);
+    }
+
+    void OnActorDeleted(AActor* Actor)
+    {
+        Record(Actor, EActorChange::Removed);
+    }
+
+    void OnActorMoved(AActor* Actor)
+    {
+        Record(Actor, EActorChange::Transform);
+    }
+
+    void OnObjectModified(UObject* Object)
+    {
+        // Modify() precedes the edit; the delta reads the actor's state when it is requested
+        if (AActor* Actor = Cast<AActor>(Object))
+        {
+            Record(Actor, EActorChange::Properties);
+        }
+        else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+        {
+            Record(Component->GetOwner(), EActorChange::Components);
+        }
+    }
+
+    void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+    {
+        // Transform edits in the details panel land on the root component
+        const USceneComponent* SceneComponent = Cast<USceneComponent>(Object);
+        if (SceneComponent && SceneComponent->GetOwner() && SceneComponent->GetOwner()->GetRootComponent() == SceneComponent)
+        {
+            const FName Property = Event.GetMemberPropertyName();
+            if (Property == USceneComponent::GetRelativeLocationPropertyName() ||
+                Property == USceneComponent::GetRelativeRotationPropertyName() ||
+                Property == USceneComponent::GetRelativeScale3DPropertyName())
+            {
+                Record(SceneComponent->GetOwner(), EActorChange::Transform);
+                return;
+            }
+        }
+        OnObjectModified(Object);
+    }
+
+    void OnMapChange(uint32 MapChangeFlags)
+    {
+        Truncate(TEXT("map changed"));
+    }
+
+    void OnUndoRedo()
+    {
+        // A transaction can restore any number of actors without per-actor notifications
+        Truncate(TEXT("undo/redo"));
+    }
+
+    void Start()
+    {
+        FSceneJournalState& State = GetState();
+        if (State.bStarted || !GEngine)
+        {
+            return;
+        }
+        State.ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&OnActorAdded);
+        State.ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&OnActorDeleted);
+        State.ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&OnActorMoved);
+        State.ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&OnObjectModified);
+        State.PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&OnObjectPropertyChanged);
+        State.MapChangeHandle = FEditorDelegates::MapChange.AddStatic(&OnMapChange);
+        State.UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&OnUndoRedo);
+
+        // Versions from an earlier editor session are always older than this one's
+        State.Version = FMath::Max(State.Version, static_cast<int64>(FDateTime::UtcNow().ToUnixTimestamp()) * 1000);
+        State.BaseVersion = State.Version;
+        State.TruncationReason = TEXT("journal started");
+        State.bStarted = true;
+    }
+
+    void WriteComponents(FMCPResponseWriter& Writer, const AActor* Actor)
+    {
+        TInlineComponentArray<UActorComponent*> Components(Actor);
+        Writer.Key(TEXT("components"));
+        Writer.BeginArray();
+        for (const UActorComponent* Component : Components)
+        {
+            Writer.BeginObject();
+            Writer.StringField(TEXT("name"), Component->GetName());
+            Writer.StringField(TEXT("class"), Component->GetClass()->GetName());
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+    }
+}
+
+int64 FMCPSceneJournal::GetVersion()
+{
+    return GetState().Version;
+}
+
+bool FMCPSceneJournal::WriteDelta(const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError)
+{
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        OutError = TEXT("Failed to get editor world");
+        return false;
+    }
+    Start();
+    FSceneJournalState& State = GetState();
+
+    bool bComponents = true;
+    Params->TryGetBoolField(TEXT("components"), bComponents);
+
+    double SinceD = -1.0;
+    const bool bHasSince = Params->TryGetNumberField(TEXT("since"), SinceD) && SinceD >= 0.0;
+    const int64 Since = static_cast<int64>(SinceD);
+    FString FullReason;
+    if (!bHasSince)
+    {
+        FullReason = TEXT("no since version");
+    }
+    else if (Since < State.BaseVersion)
+    {
+        FullReason = FString::Printf(TEXT("journal truncated (%s)"), *State.TruncationReason);
+    }
+    else if (Since > State.Version)
+    {
+        FullReason = TEXT("since is newer than the scene version");
+    }
+
+    Writer.BeginObject();
+    Writer.IntField(TEXT("version"), State.Version);
+
+    if (!FullReason.IsEmpty())
+    {
+        Writer.BoolField(TEXT("full"), true);
+        Writer.StringField(TEXT("reason"), FullReason);
+        Writer.Key(TEXT("actors"));
+        Writer.BeginArray();
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (IsTrackedActor(*It))
+            {
+                FEpicUnrealMCPCommonUtils::WriteActor(Writer, *It);
+            }
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+        return true;
+    }
+
+    // Sorted into the three lists first: removals are written before additions, so an actor deleted
+    // and re-created under the same name applies in order
+    TArray<const FActorJournalEntry*> Removed;
+    TArray<const FActorJournalEntry*> Added;
+    TArray<const FActorJournalEntry*> Changed;
+    for (const TPair<TObjectKey<AActor>, FActorJournalEntry>& Pair : State.Entries)
+    {
+        const FActorJournalEntry& Entry = Pair.Value;
+        if (Entry.LastVersion() <= Since)
+        {
+            continue;
+        }
+        const bool bRemoved = Entry.RemovedVersion > Entry.AddedVersion || !IsValid(Entry.Actor.Get());
+        if (bRemoved)
+        {
+            // Created and destroyed in between: the caller never knew it
+            if (Entry.AddedVersion <= Since)
+            {
+                Removed.Add(&Entry);
+            }
+        }
+        else if (Entry.AddedVersion > Since)
+        {
+            Added.Add(&Entry);
+        }
+        else
+        {
+            Changed.Add(&Entry);
+        }
+    }
+
+    Writer.BoolField(TEXT("full"), false);
+    Writer.IntField(TEXT("since"), Since);
+
+    Writer.Key(TEXT("removed"));
+    Writer.BeginArray();
+    for (const FActorJournalEntry* Entry : Removed)
+    {
+        Writer.String(Entry->Name);
+    }
+    Writer.EndArray();
+
+    Writer.Key(TEXT("added"));
+    Writer.BeginArray();
+    for (const FActorJournalEntry* Entry : Added)
+    {
+        FEpicUnrealMCPCommonUtils::WriteActor(Writer, Entry->Actor.Get());
+    }
+    Writer.EndArray();
+
+    Writer.Key(TEXT("changed"));
+    Writer.BeginArray();
+    for (const FActorJournalEntry* Entry : Changed)
+    {
+        const AActor* Actor = Entry->Actor.Get();
+        const bool bTransform = Entry->TransformVersion > Since;
+        const bool bComponentsChanged = Entry->ComponentsVersion > Since;
+        Writer.BeginObject();
+        Writer.StringField(TEXT("name"), Entry->Name);
+        Writer.StringField(TEXT("class"), Entry->Class);
+        Writer.Key(TEXT("changes"));
+        Writer.BeginArray();
+        if (bTransform)
+        {
+            Writer.String(TEXT("transform"));
+        }
+        if (bComponentsChanged)
+        {
+            Writer.String(TEXT("components"));
+        }
+        if (Entry->PropertiesVersion > Since)
+        {
+            Writer.String(TEXT("properties"));
+        }
+        Writer.EndArray();
+        if (bTransform)
+        {
+            FEpicUnrealMCPCommonUtils::WriteActorTransform(Writer, Actor);
+        }
+        if (bComponentsChanged && bComponents)
+        {
+            WriteComponents(Writer, Actor);
+        }
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+
+    Writer.EndObject();
+    return true;
+}
+
+void FMCPSceneJournal::Stop()
+{
+    FSceneJournalState& State = GetState();
+    if (!State.bStarted)
+    {
+        return;
+    }
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(State.ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(State.ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(State.ActorMovedHandle);
+    }
+    FCoreUObjectDelegates::OnObjectModified.Remove(State.ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(State.PropertyChangedHandle);
+    FEditorDelegates::MapChange.Remove(State.MapChangeHandle);
+    FEditorDelegates::PostUndoRedo.Remove(State.UndoRedoHandle);
+    State.Entries.Reset();
+    State.bStarted = false;
+}
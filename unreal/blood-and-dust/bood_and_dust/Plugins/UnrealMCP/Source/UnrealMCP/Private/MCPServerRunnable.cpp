@@ -10,6 +10,9 @@
 #include "JsonObjectConverter.h"
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTime.h"
+#include "MCPResponseWriter.h"
+#include "MCPEventHub.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 FMCPServerRunnable::FMCPServerRunnable(UEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
@@ -53,9 +56,35 @@ uint32 FMCPServerRunnable::Run()
                 ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
                 ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
                 
+                // Every connection starts in JSON until the client negotiates otherwise
+                WireFormat = EMCPWireFormat::Json;
+
                 uint8 Buffer[8192];
                 while (bRunning)
                 {
+                    // Only connections that subscribed with push stop blocking in Recv
+                    if (FMCPEventHub::HasPushSubscriptions())
+                    {
+                        bool bReadable = false;
+                        if (!PushEventsUntilReadable(bReadable))
+                        {
+                            break;
+                        }
+                        if (!bReadable)
+                        {
+                            continue;
+                        }
+                    }
+
+                    if (WireFormat == EMCPWireFormat::MessagePack)
+                    {
+                        if (!ProcessFrame())
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+
                     int32 BytesRead = 0;
                     if (ClientSocket->Recv(Buffer, sizeof(Buffer) - 1, BytesRead))
                     {
@@ -65,67 +94,42 @@ uint32 FMCPServerRunnable::Run()
                             break;
                         }
 
-                        // Convert received data to string
+                        // Convert received data to string (requests are summarized by FMCPRequestLog, not logged whole)
                         Buffer[BytesRead] = '\0';
                         FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
+                        UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Received %d bytes"), BytesRead);
 
                         // Parse JSON
                         TSharedPtr<FJsonObject> JsonObject;
                         TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
+                        bool bParsed = false;
+                        {
+                            TRACE_CPUPROFILER_EVENT_SCOPE(MCP_ParseRequest);
+                            bParsed = FJsonSerializer::Deserialize(Reader, JsonObject);
+                        }
                         
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
+                        if (bParsed)
                         {
                             // Get command type
                             FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
+                            JsonObject->TryGetStringField(TEXT("type"), CommandType);
+                            if (CommandType == TEXT("negotiate_protocol"))
                             {
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
-
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Command executed, response length: %d"), Response.Len());
-
-                                // Log response for debugging (truncated for large responses)
-                                FString LogResponse = Response.Len() > 200 ? Response.Left(200) + TEXT("...") : Response;
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
-                                       Response.Len(), *LogResponse);
-
-                                // Convert to UTF8 once
-                                FTCHARToUTF8 UTF8Response(*Response);
-                                const uint8* DataToSend = (const uint8*)UTF8Response.Get();
-                                int32 TotalDataSize = UTF8Response.Length();
-                                int32 TotalBytesSent = 0;
-                                bool bSuccess = true;
-
-                                // Send all data in a loop (TCP may not send everything at once)
-                                while (TotalBytesSent < TotalDataSize)
+                                // Handled here rather than by the bridge: it changes this connection's encoding
+                                const TSharedPtr<FJsonObject>* NegotiateParams = nullptr;
+                                JsonObject->TryGetObjectField(TEXT("params"), NegotiateParams);
+                                if (!NegotiateProtocol(NegotiateParams ? *NegotiateParams : MakeShared<FJsonObject>()))
                                 {
-                                    int32 BytesSent = 0;
-                                    bool bSendResult = ClientSocket->Send(DataToSend + TotalBytesSent,
-                                                                          TotalDataSize - TotalBytesSent,
-                                                                          BytesSent);
-
-                                    if (!bSendResult)
-                                    {
-                                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                                        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
-                                               TotalBytesSent, TotalDataSize, LastError);
-                                        bSuccess = false;
-                                        break;
-                                    }
-
-                                    TotalBytesSent += BytesSent;
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
-                                           BytesSent, TotalBytesSent, TotalDataSize);
+                                    break;
                                 }
+                            }
+                            else if (!CommandType.IsEmpty())
+                            {
+                                // Execute command; the response is written as UTF-8 straight into the
+                                // connection's buffer, whose allocation is kept between commands
+                                Bridge->ExecuteCommandUTF8(CommandType, JsonObject->GetObjectField(TEXT("params")), ResponseBuffer, BytesRead);
 
-                                if (bSuccess)
-                                {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
-                                           TotalBytesSent);
-                                }
+                                SendAll(ResponseBuffer.GetData(), ResponseBuffer.Num());
                             }
                             else
                             {
@@ -134,7 +138,8 @@ uint32 FMCPServerRunnable::Run()
                         }
                         else
                         {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
+                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON (%d bytes): %s%s"),
+                                   BytesRead, *ReceivedText.Left(200), ReceivedText.Len() > 200 ? TEXT("...") : TEXT(""));
                         }
                     }
                     else
@@ -168,6 +173,9 @@ uint32 FMCPServerRunnable::Run()
                         }
                     }
                 }
+
+                // Push subscriptions belong to the connection that made them
+                FMCPEventHub::OnConnectionClosed();
             }
             else
             {
@@ -183,6 +191,210 @@ uint32 FMCPServerRunnable::Run()
     return 0;
 }
 
+bool FMCPServerRunnable::SendAll(const uint8* Data, int32 Size)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(MCP_SendResponse);
+    int32 TotalBytesSent = 0;
+
+    // Send all data in a loop (TCP may not send everything at once)
+    while (TotalBytesSent < Size)
+    {
+        int32 BytesSent = 0;
+        if (!ClientSocket->Send(Data + TotalBytesSent, Size - TotalBytesSent, BytesSent))
+        {
+            int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+            UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
+                   TotalBytesSent, Size, LastError);
+            return false;
+        }
+
+        TotalBytesSent += BytesSent;
+    }
+    return true;
+}
+
+bool FMCPServerRunnable::PushEventsUntilReadable(bool& bOutReadable)
+{
+    // Events only go out between requests, so they never interleave with a response
+    ResponseBuffer.Reset();
+    while (FMCPEventHub::TakePushMessage(ResponseBuffer, WireFormat))
+    {
+        bool bSent = false;
+        if (WireFormat == EMCPWireFormat::MessagePack)
+        {
+            bSent = SendFramed();
+        }
+        else
+        {
+            // JSON has no framing; newline-terminate pushed messages for line-oriented readers
+            ResponseBuffer.Add('\n');
+            bSent = SendAll(ResponseBuffer.GetData(), ResponseBuffer.Num());
+        }
+        if (!bSent)
+        {
+            return false;
+        }
+        ResponseBuffer.Reset();
+    }
+
+    bOutReadable = ClientSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(PushIntervalMs));
+    return true;
+}
+
+bool FMCPServerRunnable::ReceiveExact(uint8* Data, int32 Size)
+{
+    int32 TotalBytesRead = 0;
+    while (TotalBytesRead < Size && bRunning)
+    {
+        int32 BytesRead = 0;
+        if (ClientSocket->Recv(Data + TotalBytesRead, Size - TotalBytesRead, BytesRead))
+        {
+            if (BytesRead == 0)
+            {
+                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
+                return false;
+            }
+            TotalBytesRead += BytesRead;
+            continue;
+        }
+
+        const int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+        if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+        {
+            FPlatformProcess::Sleep(0.01f);
+            continue;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
+        return false;
+    }
+    return TotalBytesRead == Size;
+}
+
+bool FMCPServerRunnable::SendFramed()
+{
+    const uint32 Size = static_cast<uint32>(ResponseBuffer.Num());
+    const uint8 Header[4] = {
+        static_cast<uint8>(Size >> 24), static_cast<uint8>(Size >> 16), static_cast<uint8>(Size >> 8), static_cast<uint8>(Size)
+    };
+    return SendAll(Header, sizeof(Header)) && SendAll(ResponseBuffer.GetData(), ResponseBuffer.Num());
+}
+
+bool FMCPServerRunnable::NegotiateProtocol(const TSharedPtr<FJsonObject>& Params)
+{
+    // Formats in the client's order of preference; the first one we support wins
+    TArray<FString> Requested;
+    FString Single;
+    const TArray<TSharedPtr<FJsonValue>>* Formats = nullptr;
+    if (Params->TryGetArrayField(TEXT("formats"), Formats))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Formats)
+        {
+            Requested.Add(Value->AsString());
+        }
+    }
+    else if (Params->TryGetStringField(TEXT("format"), Single))
+    {
+        Requested.Add(Single);
+    }
+
+    EMCPWireFormat Chosen = EMCPWireFormat::Json;
+    bool bFound = false;
+    for (const FString& Name : Requested)
+    {
+        if (FMCPMessagePack::ParseWireFormat(Name, Chosen))
+        {
+            bFound = true;
+            break;
+        }
+    }
+
+    // The reply is encoded in the format the client used to ask
+    ResponseBuffer.Reset();
+    FMCPResponseWriter Writer(ResponseBuffer, WireFormat);
+    if (!bFound)
+    {
+        Writer.ErrorEnvelope(FString::Printf(TEXT("No supported format in '%s' (supported: json, msgpack)"),
+            *FString::Join(Requested, TEXT(", "))));
+    }
+    else
+    {
+        Writer.BeginSuccessEnvelope();
+        Writer.BeginObject();
+        Writer.StringField(TEXT("protocol"), FMCPMessagePack::WireFormatName(Chosen));
+        if (Chosen == EMCPWireFormat::MessagePack)
+        {
+            Writer.StringField(TEXT("framing"), TEXT("u32_be_length"));
+            Writer.IntField(TEXT("max_frame_bytes"), FMCPMessagePack::MaxFrameSize);
+            Writer.Key(TEXT("packed_array_ext_types"));
+            Writer.BeginObject();
+            Writer.IntField(TEXT("float32"), FMCPMessagePack::ExtFloat32Array);
+            Writer.IntField(TEXT("int32"), FMCPMessagePack::ExtInt32Array);
+            Writer.IntField(TEXT("float64"), FMCPMessagePack::ExtFloat64Array);
+            Writer.EndObject();
+            Writer.IntField(TEXT("packed_array_min_length"), FMCPMessagePack::PackedArrayMinLength);
+        }
+        Writer.EndObject();
+        Writer.EndSuccessEnvelope();
+    }
+
+    const bool bSent = WireFormat == EMCPWireFormat::MessagePack ? SendFramed() : SendAll(ResponseBuffer.GetData(), ResponseBuffer.Num());
+    if (bFound)
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Connection switched to %s"), FMCPMessagePack::WireFormatName(Chosen));
+        WireFormat = Chosen;
+    }
+    return bSent;
+}
+
+bool FMCPServerRunnable::ProcessFrame()
+{
+    uint8 Header[4];
+    if (!ReceiveExact(Header, sizeof(Header)))
+    {
+        return false;
+    }
+    const uint32 Size = (uint32(Header[0]) << 24) | (uint32(Header[1]) << 16) | (uint32(Header[2]) << 8) | uint32(Header[3]);
+    if (Size == 0 || Size > FMCPMessagePack::MaxFrameSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Invalid frame size %u, closing connection"), Size);
+        return false;
+    }
+
+    RequestBuffer.SetNumUninitialized(Size, EAllowShrinking::No);
+    if (!ReceiveExact(RequestBuffer.GetData(), Size))
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Request;
+    FString Error;
+    FString CommandType;
+    bool bDecoded = false;
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(MCP_DecodeRequest);
+        bDecoded = FMCPMessagePack::DecodeObject(RequestBuffer.GetData(), Size, Request, Error);
+    }
+    if (!bDecoded || !Request->TryGetStringField(TEXT("type"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Bad MessagePack request (%u bytes): %s"),
+               Size, Error.IsEmpty() ? TEXT("missing 'type' field") : *Error);
+        ResponseBuffer.Reset();
+        FMCPResponseWriter(ResponseBuffer, WireFormat).ErrorEnvelope(Error.IsEmpty() ? TEXT("Missing 'type' field") : *Error);
+        return SendFramed();
+    }
+
+    const TSharedPtr<FJsonObject>* ParamsPtr = nullptr;
+    TSharedPtr<FJsonObject> Params = Request->TryGetObjectField(TEXT("params"), ParamsPtr) ? *ParamsPtr : MakeShared<FJsonObject>();
+
+    if (CommandType == TEXT("negotiate_protocol"))
+    {
+        return NegotiateProtocol(Params);
+    }
+
+    Bridge->ExecuteCommandEncoded(CommandType, Params, WireFormat, ResponseBuffer, Size);
+    return SendFramed();
+}
+
 void FMCPServerRunnable::Stop()
 {
     bRunning = false;
@@ -204,83 +416,38 @@ void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSock
     
     // Set socket options for better connection stability
     InClientSocket->SetNonBlocking(false);
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Set socket to blocking mode"));
     
     // Properly read full message with timeout
     const int32 MaxBufferSize = 4096;
     uint8 Buffer[MaxBufferSize];
     FString MessageBuffer;
     
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting message receive loop"));
-    
     while (bRunning && InClientSocket.IsValid())
     {
-        // Log socket state
-        bool bIsConnected = InClientSocket->GetConnectionState() == SCS_Connected;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Socket state - Connected: %s"), 
-               bIsConnected ? TEXT("true") : TEXT("false"));
-        
-        // Log pending data status before receive
-        uint32 PendingDataSize = 0;
-        bool HasPendingData = InClientSocket->HasPendingData(PendingDataSize);
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Before Recv - HasPendingData=%s, Size=%d"), 
-               HasPendingData ? TEXT("true") : TEXT("false"), PendingDataSize);
-        
         // Try to receive data with timeout
         int32 BytesRead = 0;
-        bool bReadSuccess = false;
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Attempting to receive data..."));
-        bReadSuccess = InClientSocket->Recv(Buffer, MaxBufferSize - 1, BytesRead, ESocketReceiveFlags::None);
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Recv attempt complete - Success=%s, BytesRead=%d"), 
-               bReadSuccess ? TEXT("true") : TEXT("false"), BytesRead);
+        const bool bReadSuccess = InClientSocket->Recv(Buffer, MaxBufferSize - 1, BytesRead, ESocketReceiveFlags::None);
         
         if (BytesRead > 0)
         {
-            // Log raw data for debugging
-            FString HexData;
-            for (int32 i = 0; i < FMath::Min(BytesRead, 50); ++i)
-            {
-                HexData += FString::Printf(TEXT("%02X "), Buffer[i]);
-            }
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Raw data (first 50 bytes hex): %s%s"), 
-                   *HexData, BytesRead > 50 ? TEXT("...") : TEXT(""));
-            
-            // Convert and log received data
-            Buffer[BytesRead] = 0; // Null terminate
-            FString ReceivedData = UTF8_TO_TCHAR(Buffer);
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received data as string: '%s'"), *ReceivedData);
-            
             // Append to message buffer
-            MessageBuffer.Append(ReceivedData);
+            Buffer[BytesRead] = 0; // Null terminate
+            MessageBuffer.Append(UTF8_TO_TCHAR(Buffer));
             
             // Process complete messages (messages are terminated with newline)
             if (MessageBuffer.Contains(TEXT("\n")))
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Newline detected in buffer, processing messages"));
-                
                 TArray<FString> Messages;
                 MessageBuffer.ParseIntoArray(Messages, TEXT("\n"), true);
                 
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Found %d message(s) in buffer"), Messages.Num());
-                
                 // Process all complete messages
                 for (int32 i = 0; i < Messages.Num() - 1; ++i)
                 {
-                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message %d: '%s'"), 
-                           i + 1, *Messages[i]);
                     ProcessMessage(InClientSocket, Messages[i]);
                 }
                 
                 // Keep any incomplete message in the buffer
                 MessageBuffer = Messages.Last();
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Remaining buffer after processing: %s"), 
-                       *MessageBuffer);
-            }
-            else
-            {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: No complete message yet (no newline detected)"));
             }
         }
         else if (!bReadSuccess)
@@ -299,8 +466,6 @@ void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSock
 
 void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message)
 {
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message: %s"), *Message);
-    
     // Parse message as JSON
     TSharedPtr<FJsonObject> JsonMessage;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
@@ -331,21 +496,14 @@ void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FStrin
         }
     }
     
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-    
     // Execute command
-    FString Response = Bridge->ExecuteCommand(CommandType, Params);
+    Bridge->ExecuteCommandUTF8(CommandType, Params, ResponseBuffer, Message.Len());
     
     // Send response with newline terminator
-    Response += TEXT("\n");
+    ResponseBuffer.Add('\n');
 
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
-           Response.Len(), *Response);
-
-    // Convert to UTF8 once
-    FTCHARToUTF8 UTF8Response(*Response);
-    const uint8* DataToSend = (const uint8*)UTF8Response.Get();
-    int32 TotalDataSize = UTF8Response.Length();
+    const uint8* DataToSend = ResponseBuffer.GetData();
+    int32 TotalDataSize = ResponseBuffer.Num();
     int32 TotalBytesSent = 0;
 
     // Send all data in a loop (TCP may not send everything at once)
@@ -360,10 +518,5 @@ void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FStrin
         }
 
         TotalBytesSent += BytesSent;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
-               BytesSent, TotalBytesSent, TotalDataSize);
     }
-
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
-           TotalBytesSent);
 } 
\ No newline at end of file
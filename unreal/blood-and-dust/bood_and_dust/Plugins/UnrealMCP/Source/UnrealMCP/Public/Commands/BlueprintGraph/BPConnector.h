@@ -5,10 +5,7 @@
 #include "Dom/JsonObject.h"
 
 // Forward declarations
-class UK2Node;
-class UEdGraph;
 class UEdGraphPin;
-enum EEdGraphPinDirection : int;
 
 /**
  * Utility class for connecting Blueprint nodes
@@ -24,16 +21,6 @@ public:
     static TSharedPtr<FJsonObject> ConnectNodes(const TSharedPtr<FJsonObject>& Params);
 
 private:
-    /**
-     * Finds a node by its ID in the graph
-     */
-    static UK2Node* FindNodeById(UEdGraph* Graph, const FString& NodeId);
-
-    /**
-     * Finds a pin by its name in a node
-     */
-    static UEdGraphPin* FindPinByName(UK2Node* Node, const FString& PinName, EEdGraphPinDirection Direction);
-
     /**
      * Checks compatibility between two pins
      */
@@ -0,0 +1,51 @@
+// Deferred Blueprint compilation for batched graph edits
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+
+/**
+ * Blueprint edit sessions
+ * While a session is open on a Blueprint, graph commands only mutate it in memory:
+ * CompileBlueprint / MarkBlueprintAs(Structurally)Modified are deferred and run exactly once on Commit.
+ * Sessions left idle past their timeout are auto-committed.
+ */
+class UNREALMCP_API FBPEditSession
+{
+public:
+	/**
+	 * Open (or refresh) a session on a Blueprint
+	 * @param Blueprint The Blueprint to hold open
+	 * @param TimeoutSeconds Idle time before auto-commit
+	 * @return true if a new session was opened, false if one was already open
+	 */
+	static bool Begin(UBlueprint* Blueprint, float TimeoutSeconds = 60.0f);
+
+	/**
+	 * Close the session and compile once
+	 * @return JSON with edit_count, compile_ms, error/warning counts and compiler messages
+	 */
+	static TSharedPtr<FJsonObject> Commit(UBlueprint* Blueprint);
+
+	static bool IsOpen(const UBlueprint* Blueprint);
+
+	/** Full Kismet compile, or recorded for Commit while a session is open */
+	static void CompileOrDefer(UBlueprint* Blueprint);
+
+	/** MarkBlueprintAsModified, or recorded for Commit while a session is open */
+	static void MarkModifiedOrDefer(UBlueprint* Blueprint);
+
+	/** MarkBlueprintAsStructurallyModified, or recorded for Commit while a session is open */
+	static void MarkStructurallyModifiedOrDefer(UBlueprint* Blueprint);
+
+	/** Compile with a results log and report timing, errors and warnings into Result */
+	static void CompileWithResults(UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& Result);
+
+	/** Remove the session ticker and drop open sessions without compiling (module shutdown) */
+	static void Reset();
+
+private:
+	static bool TickSessions(float DeltaTime);
+};
@@ -0,0 +1,48 @@
+// Shared Blueprint / graph / node / pin lookup cache for graph commands
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+enum EEdGraphPinDirection : int;
+
+/**
+ * Graph context cache
+ * Resolves Blueprint names, graph names, node ids and pin names once and keeps the result,
+ * so scripting a large graph does not rescan Graph->Nodes and node pins on every command.
+ * Node indices follow graph change notifications (add/remove are applied in place,
+ * anything else marks the index stale); every cached hit is re-validated before use.
+ */
+class UNREALMCP_API FBPGraphCache
+{
+public:
+	/**
+	 * Resolve a Blueprint by name or path
+	 * @param BlueprintName Bare name (assumed under /Game/Blueprints/) or full object/package path
+	 * @return The Blueprint, or nullptr if it does not exist
+	 */
+	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
+
+	/**
+	 * Find a graph by name
+	 * @param FunctionName Function graph name (graph or outer name, then partial match); empty for the EventGraph
+	 * @return The graph, or nullptr if not found
+	 */
+	static UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& FunctionName);
+
+	/**
+	 * Find a node by NodeGuid or object name (case-insensitive)
+	 */
+	static UEdGraphNode* FindNode(UEdGraph* Graph, const FString& NodeId);
+
+	/**
+	 * Find a pin by exact name and direction
+	 */
+	static UEdGraphPin* FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction);
+
+	/** Drop everything (module shutdown, or after bulk asset operations) */
+	static void Reset();
+};
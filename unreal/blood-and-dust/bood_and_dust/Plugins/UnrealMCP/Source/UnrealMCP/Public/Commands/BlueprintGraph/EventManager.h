@@ -48,13 +48,6 @@ private:
 	 */
 	static UK2Node_Event* FindExistingEventNode(UEdGraph* Graph, const FString& EventName);
 
-	/**
-	 * Load a Blueprint by name
-	 * @param BlueprintName Name or path of the Blueprint
-	 * @return Loaded Blueprint or nullptr
-	 */
-	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
-
 	// Helper functions
 	static TSharedPtr<FJsonObject> CreateSuccessResponse(const UK2Node_Event* EventNode);
 	static TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorMessage);
@@ -61,13 +61,6 @@ private:
 		bool bIsArray = false
 	);
 
-	/**
-	 * Load a Blueprint by name
-	 * @param BlueprintName Name or path of the Blueprint
-	 * @return Loaded Blueprint or nullptr
-	 */
-	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
-
 	/**
 	 * Convert string type name to UE FProperty type
 	 * @param TypeName Type name (bool, int, float, string, vector, etc.)
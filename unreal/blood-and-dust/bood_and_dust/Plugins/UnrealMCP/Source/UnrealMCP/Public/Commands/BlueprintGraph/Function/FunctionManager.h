@@ -45,12 +45,6 @@ public:
 	static TSharedPtr<FJsonObject> RenameFunction(const TSharedPtr<FJsonObject>& Params);
 
 private:
-	/**
-	 * Load a Blueprint by name
-	 * @param BlueprintName Name or path of the Blueprint
-	 * @return Loaded Blueprint or nullptr
-	 */
-	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
 
 	/**
 	 * Validate function name (no spaces, special chars, etc.)
@@ -26,21 +26,6 @@ public:
 	static TSharedPtr<FJsonObject> DeleteNode(const TSharedPtr<FJsonObject>& Params);
 
 private:
-	/**
-	 * Get the appropriate graph (EventGraph or Function Graph)
-	 * @param Blueprint The Blueprint containing the graph
-	 * @param FunctionName Name of function (empty = EventGraph)
-	 * @return The graph or nullptr
-	 */
-	static UEdGraph* GetGraph(UBlueprint* Blueprint, const FString& FunctionName);
-
-	/**
-	 * Find a node by its ID (tries NodeGuid and GetName())
-	 * @param Graph The graph to search
-	 * @param NodeID The node identifier
-	 * @return Found node or nullptr
-	 */
-	static UEdGraphNode* FindNodeByID(UEdGraph* Graph, const FString& NodeID);
 
 	/**
 	 * Remove a node from the graph
@@ -50,13 +35,6 @@ private:
 	 */
 	static bool RemoveNode(UEdGraph* Graph, UEdGraphNode* Node);
 
-	/**
-	 * Load a Blueprint by name
-	 * @param BlueprintName Name or path of the Blueprint
-	 * @return Loaded Blueprint or nullptr
-	 */
-	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
-
 	// Helper functions
 	static TSharedPtr<FJsonObject> CreateSuccessResponse(const FString& DeletedNodeID);
 	static TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorMessage);
@@ -88,14 +88,6 @@ class UNREALMCP_API FBlueprintNodeManager
 		 */
 		static class UK2Node* CreateBranchNode(class UEdGraph* Graph, const TSharedPtr<FJsonObject>& Params);
 
-
-		/**
-		 * Load a Blueprint by name
-		 * @param BlueprintName - Name or path of Blueprint
-		 * @return Blueprint object or nullptr
-		 */
-		static class UBlueprint* LoadBlueprint(const FString& BlueprintName);
-
 		/**
 		 * Create success response with node info
 		 */
@@ -43,15 +43,6 @@ public:
 	static TSharedPtr<FJsonObject> EditNode(const TSharedPtr<FJsonObject>& Params);
 
 private:
-	/**
-	 * Get the appropriate graph (EventGraph or Function Graph)
-	 */
-	static UEdGraph* GetGraph(UBlueprint* Blueprint, const FString& FunctionName);
-
-	/**
-	 * Find a node by its ID
-	 */
-	static UEdGraphNode* FindNodeByID(UEdGraph* Graph, const FString& NodeID);
 
 	/**
 	 * Set property on a Print (CallFunction) node
@@ -77,11 +68,6 @@ private:
 		const FString& PropertyName,
 		const TSharedPtr<FJsonValue>& Value);
 
-	/**
-	 * Load a Blueprint by name
-	 */
-	static UBlueprint* LoadBlueprint(const FString& BlueprintName);
-
 	// Routing dispatcher for edit actions
 	// Delegates to specialized editors (PinManagementEditor, TypeModificationEditor, ReferenceUpdateEditor)
 	static TSharedPtr<FJsonObject> DispatchEditAction(
@@ -64,4 +64,13 @@ private:
 
     // Add a key mapping to an Input Mapping Context
     TSharedPtr<FJsonObject> HandleAddInputMapping(const TSharedPtr<FJsonObject>& Params);
+
+    // Open a Blueprint edit session: graph commands defer compile until commit
+    TSharedPtr<FJsonObject> HandleBeginBlueprintEdit(const TSharedPtr<FJsonObject>& Params);
+
+    // Close the edit session and compile once, reporting compile time and errors
+    TSharedPtr<FJsonObject> HandleCommitBlueprintEdit(const TSharedPtr<FJsonObject>& Params);
+
+    // Apply a list of graph operations in memory and compile once at the end
+    TSharedPtr<FJsonObject> HandleBuildBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
 };
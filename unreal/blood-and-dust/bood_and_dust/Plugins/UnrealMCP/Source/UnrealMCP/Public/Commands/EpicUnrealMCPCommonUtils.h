@@ -16,6 +16,7 @@ class UK2Node_VariableSet;
 class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
+class FMCPResponseWriter;
 
 /**
  * Common utilities for EpicUnrealMCP commands
@@ -31,10 +32,19 @@ public:
     static FVector2D GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FVector GetVectorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FRotator GetRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
+
+    /**
+     * Result of a streaming writer (StreamCommand) as an FJsonObject, for callers that need the DOM.
+     * Streamed queries have no separate DOM handler; this reads the streamed JSON back instead.
+     */
+    static TSharedPtr<FJsonObject> StreamToJsonObject(TFunctionRef<bool(FMCPResponseWriter& Writer, FString& OutError)> Write);
     
     // Actor utilities
-    static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+    /** Streaming form of ActorToJsonObject: name, class and the actor transform */
+    static void WriteActor(FMCPResponseWriter& Writer, const AActor* Actor);
+    /** location, rotation and scale fields of an open object */
+    static void WriteActorTransform(FMCPResponseWriter& Writer, const AActor* Actor);
     static AActor* FindActorByName(UWorld* World, const FString& ActorName);
 
     // Blueprint utilities
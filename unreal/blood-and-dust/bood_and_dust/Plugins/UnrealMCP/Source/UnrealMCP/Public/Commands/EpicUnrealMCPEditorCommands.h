@@ -3,22 +3,28 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class FMCPResponseWriter;
+
 /**
  * Handler class for Editor-related MCP commands
  * Handles viewport control, actor manipulation, and level management
  */
-class UNREALMCP_API FEpicUnrealMCPEditorCommands
+class UNREALMCP_API FEpicUnrealMCPEditorCommands : public TSharedFromThis<FEpicUnrealMCPEditorCommands>
 {
 public:
     	FEpicUnrealMCPEditorCommands();
+    ~FEpicUnrealMCPEditorCommands();
 
     // Handle editor commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Large read-only queries that write their result straight into the response buffer
+    bool CanStreamCommand(const FString& CommandType) const;
+    bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError);
+
 private:
     // Actor manipulation commands
-    TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
+    bool StreamActorList(const FString& Pattern, FMCPResponseWriter& Writer);
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params);
@@ -36,7 +42,7 @@ private:
     TSharedPtr<FJsonObject> HandleSetMaterialInstanceParameter(const TSharedPtr<FJsonObject>& Params);
 
     // Texture commands
-    TSharedPtr<FJsonObject> HandleImportTexture(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleImportTexture(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash = FString());
     TSharedPtr<FJsonObject> HandleSetTextureProperties(const TSharedPtr<FJsonObject>& Params);
 
     // PBR Material creation
@@ -46,9 +52,10 @@ private:
     TSharedPtr<FJsonObject> HandleCreateLandscapeMaterial(const TSharedPtr<FJsonObject>& Params);
 
     // Asset import and management commands
-    TSharedPtr<FJsonObject> HandleImportMesh(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleImportSkeletalMesh(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleImportAnimation(const TSharedPtr<FJsonObject>& Params);
+    // KnownImportHash: import cache hash already computed by the caller (import_assets_batch workers)
+    TSharedPtr<FJsonObject> HandleImportMesh(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash = FString());
+    TSharedPtr<FJsonObject> HandleImportSkeletalMesh(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash = FString());
+    TSharedPtr<FJsonObject> HandleImportAnimation(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash = FString());
     TSharedPtr<FJsonObject> HandleListAssets(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDoesAssetExist(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetAssetInfo(const TSharedPtr<FJsonObject>& Params);
@@ -79,11 +86,30 @@ private:
     TSharedPtr<FJsonObject> HandleScatterFoliage(const TSharedPtr<FJsonObject>& Params);
 
     // Audio import
-    TSharedPtr<FJsonObject> HandleImportSound(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleImportSound(const TSharedPtr<FJsonObject>& Params, const FString& KnownImportHash = FString());
 
     // Animation notify
     TSharedPtr<FJsonObject> HandleAddAnimNotify(const TSharedPtr<FJsonObject>& Params);
 
     // Editor log reading
     TSharedPtr<FJsonObject> HandleGetEditorLog(const TSharedPtr<FJsonObject>& Params);
+
+    // Batch import: worker-thread decode, game-thread asset creation, one save pass at the end
+    TSharedPtr<FJsonObject> HandleImportAssetsBatch(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetImportBatchStatus(const TSharedPtr<FJsonObject>& Params);
+    bool TickImportBatch(const FString& BatchId);
+
+    // Save policy (immediate / deferred / on_flush) and batched saving of dirty packages
+    TSharedPtr<FJsonObject> HandleSetSavePolicy(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFlushDirtyPackages(const TSharedPtr<FJsonObject>& Params);
+
+    // Instanced spawning: (mesh, transform, material) items grouped into ISM/HISM components on one container actor
+    TSharedPtr<FJsonObject> HandleSpawnInstancedBatch(const TSharedPtr<FJsonObject>& Params);
+    // Replace matching StaticMeshActors with ISM/HISM instances (one undo transaction)
+    TSharedPtr<FJsonObject> HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params);
+
+    // Shared-memory bulk channel: scatter_foliage from a transforms segment, segment listing and release
+    TSharedPtr<FJsonObject> HandleScatterFoliageFromBulk(const TSharedPtr<FJsonObject>& Params, const TSharedPtr<FJsonObject>& Descriptor);
+    TSharedPtr<FJsonObject> HandleGetBulkChannelInfo(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleReleaseBulk(const TSharedPtr<FJsonObject>& Params);
 };
\ No newline at end of file
@@ -5,6 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Containers/Ticker.h"
+
+class FMCPResponseWriter;
 
 /**
  * Handles material graph manipulation commands for creating and connecting
@@ -21,7 +24,7 @@ class UNREALMCP_API FEpicUnrealMCPMaterialGraphCommands
 {
 public:
     FEpicUnrealMCPMaterialGraphCommands();
-    ~FEpicUnrealMCPMaterialGraphCommands() = default;
+    ~FEpicUnrealMCPMaterialGraphCommands();
 
     /**
      * Handle incoming material graph commands.
@@ -29,6 +32,13 @@ public:
      */
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Large read-only queries that write their result straight into the response buffer.
+     * StreamCommand returns false with OutError set (and nothing written) on failure.
+     */
+    bool CanStreamCommand(const FString& CommandType) const;
+    bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError);
+
 private:
     // ============================================
     // Material Creation/Loading
@@ -44,7 +54,20 @@ private:
      * Get material graph information - lists all expressions and connections.
      * Params: material_path
      */
-    TSharedPtr<FJsonObject> HandleGetMaterialGraph(const TSharedPtr<FJsonObject>& Params);
+    bool StreamGetMaterialGraph(const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError);
+
+    /**
+     * Build a whole material graph from one JSON document (the inverse of get_material_graph).
+     * Diffs against the existing graph: unchanged nodes/edges are left alone, one compile at the end.
+     * Params: material_path, nodes [{id, type, pos_x, pos_y, params}],
+     *         edges [{source, output_index, target, input}], outputs [{source, output_index, property}],
+     *         material (optional, e.g. {two_sided}), prune (optional, default false - delete nodes not in the document
+     *         and clear material outputs it leaves unwired), create_if_missing (optional, default true),
+     *         wait_for_compile (optional, default true)
+     * The whole document is validated first; any error returns before the graph (or a new material) is touched.
+     * A node whose type changed is recreated and links from outside the document move to the new expression.
+     */
+    TSharedPtr<FJsonObject> HandleBuildMaterialGraph(const TSharedPtr<FJsonObject>& Params);
 
     // ============================================
     // Expression Management
@@ -107,6 +130,23 @@ private:
      */
     TSharedPtr<FJsonObject> HandleConfigureLandscapeLayerBlend(const TSharedPtr<FJsonObject>& Params);
 
+    // ============================================
+    // Edit Sessions (deferred compile)
+    // ============================================
+
+    /**
+     * Open an edit session on a material. While it is open, graph commands on that material
+     * only mutate the graph; the PostEditChange + shader compile runs once on commit.
+     * Params: material_path, timeout_seconds (optional, default 60 - idle time before auto-commit)
+     */
+    TSharedPtr<FJsonObject> HandleBeginMaterialEdit(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Close the edit session and compile once.
+     * Params: material_path, wait_for_compile (optional, default true - block until shaders finish so compile_ms is real)
+     */
+    TSharedPtr<FJsonObject> HandleCommitMaterialEdit(const TSharedPtr<FJsonObject>& Params);
+
     // ============================================
     // Helper Functions
     // ============================================
@@ -114,21 +154,104 @@ private:
     /** Load a material by path */
     class UMaterial* LoadMaterial(const FString& MaterialPath);
 
-    /** Find an expression by ID in a material */
+    /**
+     * Find an expression by ID in a material: expression name, expression GUID, or exact Desc tag.
+     * Served from the per-material index; rebuilt only when the graph changed outside these commands.
+     */
     class UMaterialExpression* FindExpressionById(class UMaterial* Material, const FString& ExpressionId);
 
+    /** Keep an existing index in step with expressions added/removed by these commands */
+    void NoteExpressionAdded(class UMaterial* Material, class UMaterialExpression* Expression);
+    void NoteExpressionRemoved(class UMaterial* Material, class UMaterialExpression* Expression);
+
+    /** Stable id handed out in responses (MaterialExpressionGuid); empty if the expression has none. Never mutates. */
+    static FString GetExpressionGuid(const class UMaterialExpression* Expression);
+
+    /** GetExpressionGuid for write paths: assigns a GUID first if the expression has none */
+    static FString EnsureExpressionGuid(class UMaterialExpression* Expression);
+
+    /** Expression class for a CreateExpression type name (aliases included), or null if unknown */
+    static class UClass* FindExpressionClass(const FString& ExpressionType);
+
     /** Create expression of specified type */
     class UMaterialExpression* CreateExpression(class UMaterial* Material, const FString& ExpressionType, float PosX, float PosY);
 
+    /** Point every expression input and material output reading From at To (cleared if To is null). Returns links moved. */
+    int32 RedirectExpressionLinks(class UMaterial* Material, class UMaterialExpression* From, class UMaterialExpression* To);
+
+    /** Hash of an expression's serialized state, to detect edits made outside build_material_graph */
+    static uint32 HashExpressionState(class UMaterialExpression* Expression);
+
     /** Get an expression's input by name */
     struct FExpressionInput* GetExpressionInput(class UMaterialExpression* Expression, const FString& InputName);
 
+    /** Get a material output property input (BaseColor, Roughness, ...) by name */
+    struct FExpressionInput* GetMaterialOutputInput(class UMaterial* Material, const FString& MaterialProperty);
+
+    /** True if Expression is of the CreateExpression type name ExpressionType (aliases included) */
+    bool ExpressionMatchesType(class UMaterialExpression* Expression, const FString& ExpressionType) const;
+
     /** Convert expression to JSON for inspection */
     TSharedPtr<FJsonObject> ExpressionToJson(class UMaterialExpression* Expression);
 
     /** Apply expression-specific parameters */
     bool ApplyExpressionParams(class UMaterialExpression* Expression, const TSharedPtr<FJsonObject>& Params);
 
-    /** Expression counter for unique IDs */
+    /** Pre-edit notification; skipped while an edit session already holds the material open */
+    void BeginGraphEdit(class UMaterial* Material);
+
+    /** Post-edit notification + compile, deferred to commit while an edit session is open. Returns true if deferred. */
+    bool EndGraphEdit(class UMaterial* Material);
+
+    /** Ends the material's session with one PostEditChange and writes edit count / timings into ResultObj */
+    void CommitSession(class UMaterial* Material, bool bWaitForCompile, const TSharedPtr<FJsonObject>& ResultObj);
+
+    /** Auto-commits sessions idle past their timeout */
+    bool TickEditSessions(float DeltaTime);
+
+    /** Counter for the MCP_n ids add_material_expression writes into Desc */
     int32 ExpressionCounter;
+
+    /** Marks a material's index stale when it (or one of its expressions) is edited outside these commands */
+    void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+
+    struct FExpressionIndex
+    {
+        /** Expression name, GUID string and Desc tag -> expression */
+        TMap<FString, TWeakObjectPtr<class UMaterialExpression>> ById;
+        int32 ExpressionCount = 0;
+        bool bStale = true;
+    };
+
+    /** Per-material ID -> expression index, kept across commands */
+    TMap<TWeakObjectPtr<class UMaterial>, FExpressionIndex> ExpressionIndices;
+
+    FDelegateHandle ObjectPropertyChangedHandle;
+
+    /** Set while these commands run PostEditChange, so their own edits don't invalidate the index */
+    bool bApplyingOwnEdit = false;
+
+    struct FMaterialEditSession
+    {
+        double StartTime = 0.0;
+        double LastEditTime = 0.0;
+        float TimeoutSeconds = 60.0f;
+        int32 EditCount = 0;
+    };
+
+    struct FBuildNodeHash
+    {
+        /** Hash of the node's document entry */
+        uint32 Spec = 0;
+        /** HashExpressionState after that build */
+        uint32 State = 0;
+    };
+
+    /** Per-material node hashes from the last build_material_graph; a node is skipped only if both still match */
+    TMap<TWeakObjectPtr<class UMaterial>, TMap<FString, FBuildNodeHash>> BuildNodeHashes;
+
+    /** Open edit sessions, keyed by material */
+    TMap<TWeakObjectPtr<class UMaterial>, FMaterialEditSession> EditSessions;
+
+    FTSTicker::FDelegateHandle SessionTickerHandle;
 };
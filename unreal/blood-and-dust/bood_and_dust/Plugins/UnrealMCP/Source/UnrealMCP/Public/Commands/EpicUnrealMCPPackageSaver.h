@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UPackage;
+
+/** When command handlers write their packages to disk */
+enum class EMCPSavePolicy : uint8
+{
+    /** Save inside the command that changed the package (original behavior) */
+    Immediate,
+    /** Queue the package; queued packages are saved together once commands go idle or the queue fills up */
+    Deferred,
+    /** Queue the package; nothing is written until flush_dirty_packages */
+    OnFlush
+};
+
+/**
+ * Save policy for packages written by MCP commands
+ * Handlers call SavePackage() instead of UPackage::SavePackage. Under Deferred / OnFlush the package
+ * is only marked dirty and queued, and Flush() writes the whole queue in one pass with async file
+ * writes, so a script touching hundreds of assets does not stall on hundreds of synchronous saves.
+ */
+class UNREALMCP_API FEpicUnrealMCPPackageSaver
+{
+public:
+    /**
+     * Save or queue a package according to the current policy
+     * @param Asset The package's main asset (passed to SavePackage as the base object)
+     * @param TopLevelFlags Flags of objects that keep the package alive when saving
+     * @return true if saved (Immediate) or queued; false only if an immediate save failed
+     */
+    static bool SavePackage(UPackage* Package, UObject* Asset, EObjectFlags TopLevelFlags = RF_Public | RF_Standalone);
+
+    /**
+     * Save or queue the package that owns Asset with UEditorAssetLibrary::SaveLoadedAsset semantics:
+     * only if the package is dirty, checking it out from source control first
+     */
+    static bool SaveAsset(UObject* Asset);
+
+    /**
+     * Write queued packages (and optionally every other dirty content package) in one batch
+     * @param bIncludeUntracked Also save dirty /Game packages that were never queued (marked dirty only)
+     * @return JSON with packages_saved, packages_failed, bytes_written, save_ms and the saved package names
+     */
+    static TSharedPtr<FJsonObject> Flush(bool bIncludeUntracked = false);
+
+    /** Save a specific set of packages in one batch; same result shape as Flush */
+    static TSharedPtr<FJsonObject> SavePackages(const TArray<UPackage*>& Packages);
+
+    static EMCPSavePolicy GetPolicy();
+    /** Switching back to Immediate flushes whatever is still queued */
+    static void SetPolicy(EMCPSavePolicy NewPolicy);
+    static bool ParsePolicy(const FString& Name, EMCPSavePolicy& OutPolicy);
+    static FString PolicyToString(EMCPSavePolicy Policy);
+
+    /** Deferred policy: idle time before the queue is flushed, and queue size that forces a flush */
+    static void SetDeferredLimits(float IdleSeconds, int32 MaxQueued);
+
+    /** Current policy, limits and queue size */
+    static TSharedPtr<FJsonObject> GetStatus();
+
+    /** Remove the deferred ticker and drop the queue; queued packages stay dirty in the editor (module shutdown) */
+    static void Shutdown();
+
+private:
+    static void OnQueued();
+    static bool TickDeferred(float DeltaTime);
+};
@@ -16,6 +16,7 @@
 #include "Commands/EpicUnrealMCPGameplayCommands.h"
 #include "Commands/EpicUnrealMCPWidgetCommands.h"
 #include "Commands/EpicUnrealMCPAICommands.h"
+#include "MCPMessagePack.h"
 #include "EpicUnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -47,7 +48,32 @@ public:
 	// Command execution
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Execute a command and write the UTF-8 JSON response into OutResponse (reset first).
+	 * The server thread passes a per-connection buffer so its allocation is reused across commands.
+	 * RequestBytes is the size of the request on the wire, for get_mcp_stats.
+	 */
+	void ExecuteCommandUTF8(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutResponse,
+		int64 RequestBytes = 0);
+
+	/** As ExecuteCommandUTF8, encoding the response in the connection's negotiated wire format */
+	void ExecuteCommandEncoded(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, EMCPWireFormat Format,
+		TArray<uint8>& OutResponse, int64 RequestBytes = 0);
+
 private:
+	/**
+	 * Run a streaming-capable query straight into OutResponse; false if CommandType is not one
+	 * @param bOutSucceeded Set to whether the query wrote a success envelope (vs. an error)
+	 */
+	bool StreamCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, TArray<uint8>& OutResponse,
+		EMCPWireFormat Format = EMCPWireFormat::Json, bool* bOutSucceeded = nullptr);
+
+	/** benchmark_response_writer: time and size a streaming-capable query via the DOM path and the writer */
+	TSharedPtr<FJsonObject> BenchmarkResponseWriter(const TSharedPtr<FJsonObject>& Params);
+
+	/** get_mcp_stats: per-command latency/size table from FMCPCommandStats, optional CSV dump and reset */
+	TSharedPtr<FJsonObject> GetStats(const TSharedPtr<FJsonObject>& Params);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
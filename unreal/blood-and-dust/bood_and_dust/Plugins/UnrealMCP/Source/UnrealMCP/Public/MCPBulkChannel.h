@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Read-only view of a bulk segment written by the client */
+struct UNREALMCP_API FMCPBulkMapping
+{
+	FMCPBulkMapping();
+	~FMCPBulkMapping();
+	FMCPBulkMapping(FMCPBulkMapping&&);
+	FMCPBulkMapping& operator=(FMCPBulkMapping&&);
+
+	/** float32, int32, float64 or uint8 */
+	FString Type;
+	/** Elements (not bytes) */
+	int64 Count = 0;
+	const uint8* Data = nullptr;
+
+	template <typename T>
+	TConstArrayView64<T> As() const { return TConstArrayView64<T>(reinterpret_cast<const T*>(Data), Count); }
+
+private:
+	friend class FMCPBulkChannel;
+	TUniquePtr<IMappedFileHandle> File;
+	TUniquePtr<IMappedFileRegion> Region;
+};
+
+/**
+ * Shared-memory side channel for bulk payloads
+ * A segment is a file in Saved/MCP/Bulk/ that both processes memory-map, so multi-megabyte data
+ * (transforms, pixels, heights) skips the socket and the JSON/MessagePack encoding entirely; only
+ * a small descriptor travels in the command:
+ *
+ *   {"handle": "py_1a2b", "type": "float32", "count": 90000, "offset": 0}
+ *
+ * Segments are headerless little-endian arrays. Client segments are mapped read-only; segments
+ * the editor produces are written once and mapped by the client. Whoever is done with a segment
+ * deletes it (release_bulk); leftovers are removed when the module shuts down.
+ */
+class UNREALMCP_API FMCPBulkChannel
+{
+public:
+	static FString GetDirectory();
+
+	/** Letters, digits, '_' and '-' only, so a handle can never name a file outside the directory */
+	static bool IsValidHandle(const FString& Handle);
+
+	/** Size of one element of a descriptor type; 0 when unknown */
+	static int32 GetElementSize(const FString& Type);
+
+	/** Map the segment a descriptor points at, checking that it holds count elements past offset */
+	static bool Map(const TSharedPtr<FJsonObject>& Descriptor, FMCPBulkMapping& OutMapping, FString& OutError);
+
+	/** Map a numeric segment and convert it to floats */
+	static bool ReadFloats(const TSharedPtr<FJsonObject>& Descriptor, TArray<float>& OutValues, FString& OutError);
+
+	/**
+	 * Write a new editor-owned segment (any thread)
+	 * @return The descriptor for the client, or nullptr with OutError set
+	 */
+	static TSharedPtr<FJsonObject> Write(const void* Data, int64 Bytes, const FString& Type, FString& OutError);
+
+	static bool Release(const FString& Handle);
+
+	/** Delete every segment; returns how many were removed */
+	static int32 ReleaseAll();
+
+	/** handle + bytes of every segment currently on disk */
+	static TArray<TSharedPtr<FJsonValue>> ListSegments(int64& OutTotalBytes);
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Async/Future.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include <atomic>
+
+class UWorld;
+class IImageWrapperModule;
+class FRHIGPUTextureReadback;
+
+/** One viewpoint to render */
+struct FMCPCaptureView
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float FOV = 90.0f;
+};
+
+/** Resolution, encoding and output of a capture */
+struct FMCPCaptureOptions
+{
+	int32 Width = 960;
+	int32 Height = 540;
+	/** png, jpeg, bmp, or raw (BGRA8 pixels; bulk output only) */
+	FString Format = TEXT("png");
+	/** JPEG quality (1-100) */
+	int32 Quality = 90;
+	/** Where to write the encoded image; empty to skip the disk write */
+	FString FilePath;
+	/** Return the encoded image as base64 in the result */
+	bool bInline = false;
+	/** Write the image into a new FMCPBulkChannel segment and return its descriptor */
+	bool bBulk = false;
+	/** Manual exposure, to match an editor viewport with fixed exposure */
+	bool bFixedExposure = false;
+	float FixedEV100 = 0.0f;
+};
+
+/**
+ * One in-flight capture
+ * The scene capture and a GPU readback copy are enqueued together; the game thread only polls
+ * the readback fence, and PNG/JPEG encoding plus the file write run on a worker thread.
+ */
+class UNREALMCP_API FMCPCaptureJob : public TSharedFromThis<FMCPCaptureJob, ESPMode::ThreadSafe>
+{
+public:
+	/** Advance the job; call on the game thread once per tick. Returns true once finished. */
+	bool Tick();
+
+	bool IsDone() const { return Result.IsValid(); }
+
+	/** success, file_path / image_base64 / bulk, width, height, bytes, readback_ms, encode_ms (valid once done) */
+	TSharedPtr<FJsonObject> GetResult() const { return Result; }
+
+private:
+	friend class FMCPCaptureRig;
+
+	void PollReadback_RenderThread();
+	void Fail(const FString& Error);
+
+	FMCPCaptureOptions Options;
+	IImageWrapperModule* ImageWrapper = nullptr;
+	TSharedPtr<FRHIGPUTextureReadback> Readback;
+	TArray<FColor> Pixels;
+	std::atomic<bool> bPixelsReady{false};
+	std::atomic<bool> bPollInFlight{false};
+	TFuture<TSharedPtr<FJsonObject>> Encode;
+	bool bEncoding = false;
+	double StartTime = 0.0;
+	double ReadbackMs = 0.0;
+	TSharedPtr<FJsonObject> Result;
+};
+
+/**
+ * Persistent off-screen capture rig
+ * Keeps one transient SceneCapture2D per editor world and one render target per resolution,
+ * instead of spawning and destroying both for every screenshot. A render target can be reused
+ * as soon as its readback copy is enqueued, since render commands execute in order.
+ */
+class UNREALMCP_API FMCPCaptureRig
+{
+public:
+	/**
+	 * Render a view and start its GPU readback
+	 * @return The job to Tick() until done, or nullptr with OutError set
+	 */
+	static TSharedPtr<FMCPCaptureJob, ESPMode::ThreadSafe> Capture(UWorld* World, const FMCPCaptureView& View,
+		const FMCPCaptureOptions& Options, FString& OutError);
+
+	/**
+	 * Camera of the first perspective level viewport (any level viewport as fallback)
+	 * @param OutOptions If set, receives the viewport's fixed exposure
+	 */
+	static bool GetEditorViewportView(FMCPCaptureView& OutView, FMCPCaptureOptions* OutOptions = nullptr);
+
+	/**
+	 * Turntable ring of views looking at Center
+	 * @param Pitch Camera pitch in degrees (negative looks down on the target)
+	 * @param StartYaw Yaw of the first view; views are spread evenly over 360 degrees
+	 */
+	static void MakeOrbitViews(const FVector& Center, float Radius, float Pitch, int32 Count, float StartYaw, float FOV,
+		TArray<FMCPCaptureView>& OutViews);
+
+	/** Destroy the capture actor and release pooled render targets */
+	static void Reset();
+};
+
+/**
+ * Many views captured through the rig in one command
+ * Keeps up to MaxInFlight captures between CaptureScene and finished encode, so the GPU readback
+ * of one view overlaps the render of the next and the worker-thread encodes run in parallel.
+ */
+class UNREALMCP_API FMCPCaptureBatch
+{
+public:
+	/**
+	 * @param OutputDir Directory for <Prefix>_NNN.<ext> files; empty to skip the disk write
+	 * @param MaxInFlight Captures started but not yet finished
+	 */
+	FMCPCaptureBatch(UWorld* InWorld, const TArray<FMCPCaptureView>& InViews, const FMCPCaptureOptions& InOptions,
+		const FString& InOutputDir, const FString& InPrefix, int32 InMaxInFlight);
+
+	/** Start and advance captures; call on the game thread once per tick. Returns true once every view finished. */
+	bool Tick();
+
+	/** success, captured, failed, total_ms and one entry per view (valid once Tick returned true) */
+	TSharedPtr<FJsonObject> GetResult() const { return Result; }
+
+private:
+	TWeakObjectPtr<UWorld> World;
+	TArray<FMCPCaptureView> Views;
+	FMCPCaptureOptions Options;
+	FString OutputDir;
+	FString Prefix;
+	int32 MaxInFlight = 4;
+
+	int32 NextView = 0;
+	TArray<TSharedPtr<FMCPCaptureJob, ESPMode::ThreadSafe>> Jobs;
+	TArray<TSharedPtr<FJsonObject>> ViewResults;
+	double StartTime = 0.0;
+	TSharedPtr<FJsonObject> Result;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/** Timings and sizes of one executed command, filled in by the bridge */
+struct FMCPCommandSample
+{
+	/** Scheduled on the server thread until the game-thread ticker picked it up */
+	double QueueMs = 0.0;
+	/** Handler time on the game thread (for multi-tick jobs: first tick to done) */
+	double ExecMs = 0.0;
+	/** Writing the response envelope (0 for streamed queries, which serialize while they execute) */
+	double SerializeMs = 0.0;
+	/** Whole ExecuteCommandEncoded call as seen by the server thread */
+	double TotalMs = 0.0;
+	int64 BytesIn = 0;
+	int64 BytesOut = 0;
+	bool bSuccess = true;
+	bool bStreamed = false;
+	/** Error message of a failed command (not available for streamed queries) */
+	FString Error;
+};
+
+/**
+ * Log-scale latency histogram
+ * Buckets grow by 2^(1/4) from 1 µs, so percentiles are within ~10% of the true value at any scale
+ * up to several minutes, in a fixed 1 KB per metric.
+ */
+struct FMCPLatencyHistogram
+{
+	static constexpr int32 NumBuckets = 128;
+
+	void Add(double Ms);
+	/** Upper bound of the bucket holding the P-th percentile (P in 0-100); 0 when empty */
+	double Percentile(double P) const;
+	TSharedPtr<FJsonObject> ToJson() const;
+
+	uint32 Buckets[NumBuckets] = {};
+	int64 Count = 0;
+	double SumMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+/** Running totals of one command type */
+struct FMCPCommandStatsEntry
+{
+	int64 Count = 0;
+	int64 Errors = 0;
+	int64 Streamed = 0;
+	int64 BytesIn = 0;
+	int64 BytesOut = 0;
+	int64 MaxBytesOut = 0;
+	FMCPLatencyHistogram Queue;
+	FMCPLatencyHistogram Exec;
+	FMCPLatencyHistogram Serialize;
+	FMCPLatencyHistogram Total;
+};
+
+/**
+ * Per-command telemetry of the MCP bridge
+ * Every command executed by UEpicUnrealMCPBridge is recorded here (any thread). Exposed through the
+ * get_mcp_stats command, which can also dump the table as CSV for offline comparison.
+ */
+class UNREALMCP_API FMCPCommandStats
+{
+public:
+	static void Record(const FString& CommandType, const FMCPCommandSample& Sample);
+
+	/** Session totals plus one entry per command, slowest (by p95 total) first */
+	static TSharedPtr<FJsonObject> ToJson(const FString& CommandFilter = FString());
+
+	/**
+	 * Write one CSV row per command (counts, bytes, p50/p95/p99 per phase)
+	 * @param FilePath Destination; empty for Saved/MCP/Stats/mcp_stats_<timestamp>.csv
+	 * @return The absolute path written, or an empty string on failure
+	 */
+	static FString WriteCsv(const FString& FilePath = FString());
+
+	static void Reset();
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "MCPMessagePack.h"
+
+class FMCPResponseWriter;
+
+/** Event streams a subscription can ask for */
+enum class EMCPEventType : uint8
+{
+	ActorSpawned,
+	ActorDeleted,
+	ActorMoved,
+	AssetSaved,
+	BlueprintCompiled,
+	MaterialCompiled,
+	/** Remaining shader compile jobs, sent when the count changes */
+	ShaderQueue,
+	/** Lines from FMCPLogCapture, filtered by category and verbosity */
+	Log,
+	Num
+};
+
+/**
+ * Editor event subscriptions
+ * Replaces polling get_actors_in_level / get_editor_log / recompile_material with change events.
+ * Editor delegates (level actor added/deleted/moved, package saved, Blueprint and material compile)
+ * are bound on the game thread the first time anyone subscribes; each event is queued on every
+ * subscription that wants it, where repeats are coalesced: a dragged actor yields one move with its
+ * final transform, a recompiled asset one result, the shader queue its latest count.
+ *
+ * Queued events leave in batches, after batch_ms or max_batch events, in one of two ways:
+ * - push: written to the connection that subscribed whenever it is idle, as
+ *   {"type": "event", "subscription_id", "events", ...} messages (MessagePack frames once negotiated,
+ *   newline-terminated JSON otherwise). Push subscriptions end with their connection.
+ * - pull: poll_events, which returns the due batch at once, or waits up to timeout_ms (max 1 s) for
+ *   it. The wait blocks the server thread, so other commands queue behind it; keep it short.
+ *   Pull subscriptions expire after 10 minutes without a poll.
+ *
+ * Everything here except the delegate binding runs on the MCP server thread.
+ */
+class UNREALMCP_API FMCPEventHub
+{
+public:
+	/** Params: events (names, default all but log), log_categories, log_verbosity, batch_ms, max_batch, push */
+	static TSharedPtr<FJsonObject> Subscribe(const TSharedPtr<FJsonObject>& Params);
+
+	/** Params: subscription_id; reports what the subscription delivered */
+	static TSharedPtr<FJsonObject> Unsubscribe(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * poll_events: write the next batch of a pull subscription into an open success envelope
+	 * Params: subscription_id, timeout_ms (how long to wait for events, max 1000; default 0 returns at once)
+	 * @return false with OutError set if the subscription does not exist
+	 */
+	static bool Poll(const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError);
+
+	/** Whether the current connection has push subscriptions (server thread) */
+	static bool HasPushSubscriptions();
+
+	/**
+	 * Append the next due push message to OutMessage (server thread)
+	 * @return false when no push subscription has a batch ready
+	 */
+	static bool TakePushMessage(TArray<uint8>& OutMessage, EMCPWireFormat Format);
+
+	/** The current connection closed: end its push subscriptions (server thread) */
+	static void OnConnectionClosed();
+
+	/** Unbind editor delegates and drop every subscription (module shutdown) */
+	static void Shutdown();
+
+	static bool ParseEventType(const FString& Name, EMCPEventType& OutType);
+	static const TCHAR* EventTypeToString(EMCPEventType Type);
+};
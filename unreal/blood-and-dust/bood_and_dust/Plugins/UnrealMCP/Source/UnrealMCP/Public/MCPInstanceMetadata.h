@@ -0,0 +1,27 @@
+// Per-instance metadata stored on ISM/HISM components built by MCP instancing commands
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "MCPInstanceMetadata.generated.h"
+
+/**
+ * Names of what each instance came from, indexed like the component's instances.
+ * Attached as asset user data by spawn_instanced_batch and consolidate_to_instances
+ * so the labels of merged actors survive the merge (and saving the level).
+ */
+UCLASS()
+class UNREALMCP_API UMCPInstanceMetadata : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	/** Outliner label per instance (empty if none was given) */
+	UPROPERTY(VisibleAnywhere, Category="MCP")
+	TArray<FString> Labels;
+
+	/** Object name of the actor an instance replaced (empty for instances spawned directly) */
+	UPROPERTY(VisibleAnywhere, Category="MCP")
+	TArray<FString> SourceActors;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Misc/OutputDevice.h"
+
+/** One line captured from GLog */
+struct FMCPLogLine
+{
+	/** Cursor of this line; increases by one per captured line */
+	int64 Seq = 0;
+	FDateTime Timestamp;
+	FName Category;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	FString Message;
+};
+
+/**
+ * In-memory tail of the editor log
+ * Registered with GLog at module startup, so every log line lands in a fixed-size ring buffer as it is
+ * written. get_editor_log reads from here with a cursor instead of loading the whole log file, and it
+ * runs on the MCP server thread: the game thread is never involved.
+ *
+ * Lines written before the module loaded (or pushed out of the ring) are still available from the
+ * file itself through TailFile, which reads forward from a byte offset instead of re-reading everything.
+ */
+class UNREALMCP_API FMCPLogCapture : public FOutputDevice
+{
+public:
+	/** Lines kept in memory; older lines are dropped first */
+	static constexpr int32 Capacity = 20000;
+	/** Longer messages are truncated in the ring (the log file keeps them whole) */
+	static constexpr int32 MaxMessageLength = 4096;
+
+	static FMCPLogCapture& Get();
+
+	/** Attach to / detach from GLog */
+	static void Start();
+	static void Stop();
+
+	// FOutputDevice interface
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category, double Time) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+	/**
+	 * Read captured lines (any thread)
+	 * Params: cursor (only lines after it, oldest first; omit for the last num_lines), num_lines,
+	 * filter (substring), regex, category (comma separated), verbosity (most verbose level to include),
+	 * structured (return entries instead of one joined string)
+	 */
+	TSharedPtr<FJsonObject> Query(const TSharedPtr<FJsonObject>& Params) const;
+
+	/**
+	 * Copy lines after Cursor, oldest first (any thread)
+	 * @return The newest cursor, to pass back next time
+	 */
+	int64 CopySince(int64 Cursor, int32 MaxLines, TArray<FMCPLogLine>& OutLines) const;
+
+	/**
+	 * Read the project log file from a byte offset (any thread), with the same filters as Query
+	 * Params: offset (omit to read the last max_bytes), max_bytes, num_lines and the filters
+	 */
+	static TSharedPtr<FJsonObject> TailFile(const TSharedPtr<FJsonObject>& Params);
+
+	/** "[time]Category: Verbosity: Message", as in the log file */
+	static FString FormatLine(const FMCPLogLine& Line);
+
+private:
+	mutable FCriticalSection Lock;
+	TArray<FMCPLogLine> Lines;
+	/** Index of the oldest line once the ring is full */
+	int32 Head = 0;
+	int64 NextSeq = 1;
+	bool bRegistered = false;
+};
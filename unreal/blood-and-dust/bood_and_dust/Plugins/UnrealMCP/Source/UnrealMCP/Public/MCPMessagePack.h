@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/** Encoding of requests and responses on one MCP connection */
+enum class EMCPWireFormat : uint8
+{
+	/** Raw UTF-8 JSON, one object per message (the default; no framing) */
+	Json,
+	/** MessagePack, each message prefixed with its size as a big-endian uint32 */
+	MessagePack
+};
+
+/**
+ * MessagePack support for the MCP wire protocol
+ * A client switches a connection to MessagePack by sending negotiate_protocol as its first (JSON)
+ * message. Bulk numeric arrays then travel as ext blobs of packed little-endian values instead of
+ * one JSON number per element.
+ *
+ * Requests are decoded into the same FJsonObject tree the JSON path produces, so command handlers
+ * do not need to know which encoding the client used. Responses are encoded by FMCPResponseWriter.
+ */
+class UNREALMCP_API FMCPMessagePack
+{
+public:
+	/** Ext type codes of packed arrays (payload is the raw little-endian elements) */
+	static constexpr int8 ExtFloat32Array = 1;
+	static constexpr int8 ExtInt32Array = 2;
+	static constexpr int8 ExtFloat64Array = 3;
+
+	/** Numeric arrays shorter than this are written element by element */
+	static constexpr int32 PackedArrayMinLength = 16;
+
+	/** Largest frame accepted from a client */
+	static constexpr uint32 MaxFrameSize = 256u * 1024u * 1024u;
+
+	/**
+	 * Decode one MessagePack map into a JSON object
+	 * Packed arrays become arrays of numbers and bin values become base64 strings.
+	 */
+	static bool DecodeObject(const uint8* Data, int32 Size, TSharedPtr<FJsonObject>& OutObject, FString& OutError);
+
+	/** Parse a wire format name (json, msgpack / messagepack) */
+	static bool ParseWireFormat(const FString& Name, EMCPWireFormat& OutFormat);
+
+	static const TCHAR* WireFormatName(EMCPWireFormat Format);
+};
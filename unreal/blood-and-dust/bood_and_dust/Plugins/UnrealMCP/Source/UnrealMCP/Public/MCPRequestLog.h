@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "MCPCommandStats.h"
+#include "MCPMessagePack.h"
+
+/** Which requests get a one-line UE_LOG summary (every request always goes into the ring buffer) */
+enum class EMCPLogMode : uint8
+{
+	/** No per-request log lines */
+	Off,
+	/** Failed and slow requests only */
+	Errors,
+	/** Failed and slow requests, plus every Nth request */
+	Sampled,
+	/** Every request */
+	All
+};
+
+/** One executed command, as kept by FMCPRequestLog */
+struct FMCPRequestRecord
+{
+	int64 Id = 0;
+	FDateTime Timestamp;
+	FString Command;
+	EMCPWireFormat Format = EMCPWireFormat::Json;
+	FMCPCommandSample Sample;
+};
+
+/**
+ * Structured request log of the MCP server
+ * A fixed-capacity ring buffer of the most recent requests (id, command, sizes, phase timings, error),
+ * queryable through get_mcp_request_log. It replaces logging whole requests and responses: the
+ * output log only gets a one-line summary, sampled according to set_mcp_logging.
+ */
+class UNREALMCP_API FMCPRequestLog
+{
+public:
+	/**
+	 * Store a record and write its summary line if the log mode selects it (any thread)
+	 * @return The request id
+	 */
+	static int64 Add(const FString& Command, EMCPWireFormat Format, const FMCPCommandSample& Sample);
+
+	/**
+	 * Records matching the query, oldest first
+	 * Params: since_id (only newer records), command (substring), errors_only, min_total_ms, limit (default 100, newest kept)
+	 */
+	static TSharedPtr<FJsonObject> Query(const TSharedPtr<FJsonObject>& Params);
+
+	/** Params: mode, sample_every, slow_ms, capacity (shrinking drops the oldest records) */
+	static TSharedPtr<FJsonObject> Configure(const TSharedPtr<FJsonObject>& Params);
+
+	/** Mode, limits, ring occupancy and memory, and the CPU spent recording and logging */
+	static TSharedPtr<FJsonObject> GetStatus();
+
+	static bool ParseMode(const FString& Name, EMCPLogMode& OutMode);
+	static FString ModeToString(EMCPLogMode Mode);
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "MCPMessagePack.h"
+
+/**
+ * Streaming writer for MCP responses
+ * Appends straight to a byte buffer that the server thread reuses per connection, so a response
+ * is not built as an FJsonObject tree, re-wrapped in the status envelope, serialized to a UTF-16
+ * FString and then converted to UTF-8 again. Handlers that still return an FJsonObject go through
+ * Object(), which walks the tree once and writes the output directly.
+ *
+ * JSON output matches FJsonSerializer's condensed form (same escaping, numbers as %.17g).
+ * MessagePack output writes maps and arrays with 32-bit headers that are patched when the
+ * container closes, and packs long numeric arrays into FMCPMessagePack ext blobs.
+ */
+class UNREALMCP_API FMCPResponseWriter
+{
+public:
+	/** Appends to InBuffer; the caller owns (and may reuse) the buffer */
+	explicit FMCPResponseWriter(TArray<uint8>& InBuffer, EMCPWireFormat InFormat = EMCPWireFormat::Json);
+
+	void BeginObject();
+	void EndObject();
+	void BeginArray();
+	void EndArray();
+
+	/** Object key; the next call writes its value */
+	void Key(FStringView Name);
+
+	void String(FStringView Value);
+	void Number(double Value);
+	void Int(int64 Value);
+	void Bool(bool Value);
+	void Null();
+	void Vector(const FVector& Value);
+	void Rotator(const FRotator& Value);
+
+	/** Bulk numeric data: a JSON number array, or one packed ext blob in MessagePack */
+	void FloatArray(TConstArrayView<float> Values);
+	void IntArray(TConstArrayView<int32> Values);
+
+	/** Serialize an existing DOM value/object without going through an FString */
+	void Value(const TSharedPtr<FJsonValue>& Value);
+	void Object(const TSharedPtr<FJsonObject>& Object);
+
+	void StringField(FStringView Name, FStringView Value) { Key(Name); String(Value); }
+	void NumberField(FStringView Name, double Value) { Key(Name); Number(Value); }
+	void IntField(FStringView Name, int64 Value) { Key(Name); Int(Value); }
+	void BoolField(FStringView Name, bool Value) { Key(Name); Bool(Value); }
+	void VectorField(FStringView Name, const FVector& Value) { Key(Name); Vector(Value); }
+	void RotatorField(FStringView Name, const FRotator& Value) { Key(Name); Rotator(Value); }
+	void ObjectField(FStringView Name, const TSharedPtr<FJsonObject>& Value) { Key(Name); Object(Value); }
+
+	/** {"status":"success","result": ... } around a result written by the caller */
+	void BeginSuccessEnvelope();
+	void EndSuccessEnvelope();
+
+	/** Complete envelopes */
+	void SuccessEnvelope(const TSharedPtr<FJsonObject>& Result);
+	void ErrorEnvelope(FStringView Error);
+
+	/** Bytes written to the buffer so far (including anything it held before) */
+	int32 Num() const { return Buffer.Num(); }
+
+	EMCPWireFormat GetFormat() const { return Format; }
+
+private:
+	struct FContainer
+	{
+		/** MessagePack: offset of the 32-bit count to patch on close */
+		int32 HeaderOffset;
+		/** Members (objects) or elements (arrays) written so far */
+		uint32 Count;
+	};
+
+	void Separator();
+	void BeginContainer(uint8 PackTag, ANSICHAR JsonChar);
+	void EndContainer(ANSICHAR JsonChar);
+	void Raw(const ANSICHAR* Text);
+	void Escaped(FStringView Text);
+	void AppendUTF8(FStringView Text, bool bJsonEscape);
+	void PackString(FStringView Text);
+	void PackBigEndian(uint64 Value, int32 Bytes);
+	void PackExt(int8 Type, const void* Data, int32 Size);
+	void PackNumberArray(const TArray<TSharedPtr<FJsonValue>>& Values);
+
+	TArray<uint8>& Buffer;
+	EMCPWireFormat Format;
+	TArray<FContainer, TInlineAllocator<32>> Containers;
+	bool bAfterKey = false;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class FMCPResponseWriter;
+
+/**
+ * Versioned change journal of the editor level
+ * Keeps one entry per actor touched since the journal started, with the scene version at which it
+ * was added, removed, moved, had a component changed, or was otherwise modified. get_scene_delta
+ * then answers "what changed since version N" from these entries instead of re-sending the level.
+ *
+ * Versions only increase, also across map changes and editor sessions (they start from the current
+ * time in milliseconds), so a stale or foreign version is always detected. Undo/redo, a map change
+ * or an overfull journal truncate it; a delta request from before the truncation gets a full snapshot.
+ *
+ * Game thread only. The journal starts with the first get_scene_delta.
+ */
+class UNREALMCP_API FMCPSceneJournal
+{
+public:
+	/**
+	 * get_scene_delta: write the changes since Params.since, or the full actor list (game thread)
+	 * Params: since (version from a previous call; omit for a full snapshot), components (list component
+	 * names and classes of changed actors, default true)
+	 */
+	static bool WriteDelta(const TSharedPtr<FJsonObject>& Params, FMCPResponseWriter& Writer, FString& OutError);
+
+	/** Current scene version (0 before the journal started) */
+	static int64 GetVersion();
+
+	/** Unbind editor delegates and drop the journal (module shutdown) */
+	static void Stop();
+};
@@ -4,6 +4,7 @@
 #include "HAL/Runnable.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include "MCPMessagePack.h"
 
 class UEpicUnrealMCPBridge;
 
@@ -26,9 +27,36 @@ protected:
 	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
 	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
 
+	/** negotiate_protocol: reply in the current format, then switch the connection to the chosen one */
+	bool NegotiateProtocol(const TSharedPtr<FJsonObject>& Params);
+	/** Read and execute one length-prefixed MessagePack request; false once the connection is gone */
+	bool ProcessFrame();
+
+	/**
+	 * Send the event batches that are due to this connection's push subscriptions (FMCPEventHub),
+	 * then wait up to PushIntervalMs for the next request
+	 * @param bOutReadable Whether the client has sent something to read
+	 * @return false once the connection is gone
+	 */
+	bool PushEventsUntilReadable(bool& bOutReadable);
+
+	bool SendAll(const uint8* Data, int32 Size);
+	bool SendFramed();
+	bool ReceiveExact(uint8* Data, int32 Size);
+
 private:
 	UEpicUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
 	TSharedPtr<FSocket> ClientSocket;
 	bool bRunning;
+
+	/** Encoded response of the current command; reused so its allocation survives between commands */
+	TArray<uint8> ResponseBuffer;
+	/** Payload of the current MessagePack frame */
+	TArray<uint8> RequestBuffer;
+	/** How often an idle connection with push subscriptions checks for due event batches */
+	static constexpr int32 PushIntervalMs = 20;
+
+	/** Encoding negotiated for the current connection */
+	EMCPWireFormat WireFormat = EMCPWireFormat::Json;
 }; 
\ No newline at end of file
@@ -65,7 +65,9 @@ public class UnrealMCP : ModuleRules
 				"AssetRegistry",
 				"MaterialEditor",        // For material editing
 				"RenderCore",            // For material expressions
+				"RHI",                   // GPU readback for screenshot capture
 				"ImageWrapper",          // For PNG screenshot encoding
+				"ImageCore",             // FImage decode in import_assets_batch
 				"Landscape",             // For landscape/terrain editing
 				"LandscapeEditor",       // For landscape editing tools
 				"Foliage",               // For foliage editing
@@ -13,11 +13,18 @@ import struct
 import time
 import threading
 import base64
+import mmap
 import os
+import uuid
 from contextlib import asynccontextmanager
 from typing import AsyncIterator, Dict, Any, Optional, List
 from mcp.server.fastmcp import FastMCP
 
+try:
+    import msgpack  # Optional: binary wire format for bulk payloads
+except ImportError:
+    msgpack = None
+
 from helpers.infrastructure_creation import (
     _create_street_grid, _create_street_lights, _create_town_vehicles, _create_town_decorations,
     _create_traffic_lights, _create_street_signage, _create_sidewalks_crosswalks, _create_urban_furniture,
@@ -72,6 +79,118 @@ logger = logging.getLogger("UnrealMCP_Advanced")
 UNREAL_HOST = "127.0.0.1"
 UNREAL_PORT = 55557
 
+# Wire format: "json", "msgpack" (every command) or "auto" (msgpack for bulk commands when the
+# msgpack package is installed and the plugin supports it)
+UNREAL_WIRE_FORMAT = os.environ.get("UNREAL_MCP_WIRE_FORMAT", "auto").lower()
+
+# MessagePack ext codes for packed little-endian arrays (must match FMCPMessagePack)
+MSGPACK_EXT_FLOAT32_ARRAY = 1
+MSGPACK_EXT_INT32_ARRAY = 2
+MSGPACK_EXT_FLOAT64_ARRAY = 3
+MSGPACK_PACKED_ARRAY_MIN_LENGTH = 16
+
+
+class Float32Array(list):
+    """A list of floats sent as packed float32 over MessagePack (a plain list over JSON)."""
+
+
+def _msgpack_pack_arrays(value: Any) -> Any:
+    """Replace long numeric lists with packed ext blobs before msgpack encoding."""
+    if isinstance(value, dict):
+        return {k: _msgpack_pack_arrays(v) for k, v in value.items()}
+    if isinstance(value, (list, tuple)):
+        if isinstance(value, Float32Array):
+            return msgpack.ExtType(MSGPACK_EXT_FLOAT32_ARRAY, struct.pack(f"<{len(value)}f", *value))
+        if len(value) >= MSGPACK_PACKED_ARRAY_MIN_LENGTH and all(
+                isinstance(v, (int, float)) and not isinstance(v, bool) for v in value):
+            if all(isinstance(v, int) and -2**31 <= v < 2**31 for v in value):
+                return msgpack.ExtType(MSGPACK_EXT_INT32_ARRAY, struct.pack(f"<{len(value)}i", *value))
+            return msgpack.ExtType(MSGPACK_EXT_FLOAT64_ARRAY, struct.pack(f"<{len(value)}d", *value))
+        return [_msgpack_pack_arrays(v) for v in value]
+    return value
+
+
+def _msgpack_ext_hook(code: int, data: bytes) -> Any:
+    """Unpack the plugin's packed arrays into plain lists."""
+    if code == MSGPACK_EXT_FLOAT32_ARRAY:
+        return list(struct.unpack(f"<{len(data) // 4}f", data))
+    if code == MSGPACK_EXT_INT32_ARRAY:
+        return list(struct.unpack(f"<{len(data) // 4}i", data))
+    if code == MSGPACK_EXT_FLOAT64_ARRAY:
+        return list(struct.unpack(f"<{len(data) // 8}d", data))
+    return msgpack.ExtType(code, data)
+
+
+# Shared-memory bulk channel: segments are files in the editor's Saved/MCP/Bulk directory that
+# both sides memory-map, so large arrays skip the socket entirely (see FMCPBulkChannel)
+BULK_DTYPES = {"float32": "f", "int32": "i", "float64": "d", "uint8": "B"}
+_bulk_dir_cache: Optional[str] = None
+
+
+def _bulk_directory(unreal: "UnrealConnection") -> Optional[str]:
+    """Ask the editor where bulk segments live (cached; the editor and client share a machine)."""
+    global _bulk_dir_cache
+    if _bulk_dir_cache is None:
+        response = unreal.send_command("get_bulk_channel_info", {}) or {}
+        result = response.get("result", response)
+        if result.get("success"):
+            directory = result.get("directory")
+            if directory:
+                os.makedirs(directory, exist_ok=True)
+                _bulk_dir_cache = directory
+    return _bulk_dir_cache
+
+
+def bulk_write(unreal: "UnrealConnection", values: List[float], dtype: str = "float32") -> Dict[str, Any]:
+    """Write values into a new bulk segment and return the descriptor to pass in a command."""
+    directory = _bulk_directory(unreal)
+    if not directory:
+        raise RuntimeError("Bulk channel unavailable (plugin does not support get_bulk_channel_info)")
+    handle = f"py_{uuid.uuid4().hex}"
+    path = os.path.join(directory, f"{handle}.bin")
+    data = struct.pack(f"<{len(values)}{BULK_DTYPES[dtype]}", *values)
+    # Publish under the final name only once the data is complete
+    tmp_path = path + ".tmp"
+    with open(tmp_path, "wb") as f:
+        f.write(data)
+    os.replace(tmp_path, path)
+    return {"handle": handle, "type": dtype, "count": len(values), "offset": 0}
+
+
+def bulk_discard(descriptor: Optional[Dict[str, Any]]) -> None:
+    """Delete a segment this client wrote when the command that should consume it never ran."""
+    if descriptor and _bulk_dir_cache:
+        try:
+            os.remove(os.path.join(_bulk_dir_cache, f"{descriptor['handle']}.bin"))
+        except OSError:
+            pass
+
+
+def bulk_read(descriptor: Dict[str, Any], release: bool = True) -> Any:
+    """Map a segment the editor wrote; uint8 segments come back as bytes, others as lists."""
+    dtype = descriptor.get("type", "float32")
+    count = int(descriptor.get("count", 0))
+    offset = int(descriptor.get("offset", 0))
+    path = descriptor.get("path")
+    if not path and _bulk_dir_cache:
+        path = os.path.join(_bulk_dir_cache, f"{descriptor['handle']}.bin")
+    size = struct.calcsize(f"<{BULK_DTYPES[dtype]}") * count
+    with open(path, "rb") as f:
+        if size == 0:
+            data = b""
+        else:
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mapped:
+                data = bytes(mapped[offset:offset + size])
+    if release:
+        try:
+            os.remove(path)
+        except OSError:
+            pass
+    if dtype == "uint8":
+        return data
+    return list(struct.unpack(f"<{count}{BULK_DTYPES[dtype]}", data))
+
+
 class UnrealConnection:
     """
     Robust connection to Unreal Engine with automatic retry and reconnection.
@@ -111,9 +230,12 @@ class UnrealConnection:
         "create_landscape_material",
         "scatter_meshes_on_landscape",
         "scatter_foliage",
+        "spawn_instanced_batch",
+        "consolidate_to_instances",
         "create_widget_blueprint",
         "create_behavior_tree",
         "take_screenshot",
+        "capture_views",
         "create_niagara_system",
         "create_atmospheric_fx",
     }
@@ -128,6 +250,7 @@ class UnrealConnection:
         "import_skeletal_mesh": 5.0, # FBX parsing + skeleton + skin weights + physics asset
         "import_animation": 3.0,    # FBX parsing + animation curve processing
         "import_sound": 2.0,         # Sound decompression + asset creation
+        "flush_dirty_packages": 1.0, # Batched package saves (disk flush)
         "create_pbr_material": 1.0,  # Material compilation + shader compile
         "create_landscape_material": 2.0,  # Full material graph + shader compile
         "scatter_meshes_on_landscape": 2.0,  # Multiple spawns + line traces
@@ -136,17 +259,33 @@ class UnrealConnection:
         "create_widget_blueprint": 1.5,   # Widget BP creation + compile + save
         "create_behavior_tree": 1.0,      # BT asset creation + save
         "create_blackboard": 1.0,         # BB asset creation + save
-        "take_screenshot": 1.0,          # SceneCapture2D render + ReadPixels + PNG encode
+        "take_screenshot": 1.0,          # SceneCapture2D render + GPU readback + encode
+        "capture_views": 1.0,            # Many SceneCapture2D renders + readbacks + encodes
         "create_niagara_system": 2.0,    # Niagara system creation + compile + save
         "create_atmospheric_fx": 3.0,   # Niagara system with module stack + compile
     }
     
+    # Commands whose requests or responses carry bulk arrays; sent as MessagePack in "auto" mode
+    BINARY_WIRE_COMMANDS = {
+        "get_actors_in_level",
+        "get_scene_delta",
+        "find_actors_by_name",
+        "get_material_graph",
+        "build_material_graph",
+        "spawn_instanced_batch",
+        "consolidate_to_instances",
+        "scatter_meshes_on_landscape",
+        "scatter_foliage",
+        "capture_views",
+    }
+
     def __init__(self):
         """Initialize the connection."""
         self.socket = None
         self.connected = False
         self._lock = threading.RLock()  # RLock allows reentrant acquisition for retry logic
         self._last_error = None
+        self._msgpack_supported = None  # Unknown until the first negotiation
     
     def _create_socket(self) -> socket.socket:
         """Create and configure a new socket."""
@@ -332,6 +471,54 @@ class UnrealConnection:
         
         raise ConnectionError("Connection closed without response")
 
+    def _wants_msgpack(self, command: str) -> bool:
+        """Whether this command should use the MessagePack wire format."""
+        if msgpack is None or self._msgpack_supported is False or UNREAL_WIRE_FORMAT == "json":
+            return False
+        return UNREAL_WIRE_FORMAT == "msgpack" or command in self.BINARY_WIRE_COMMANDS
+
+    def _negotiate_msgpack(self) -> bool:
+        """
+        Ask the plugin to switch this connection to length-prefixed MessagePack.
+
+        Older plugins answer with an unknown-command error; the connection stays JSON and
+        MessagePack is not tried again.
+        """
+        request = {"type": "negotiate_protocol", "params": {"formats": ["msgpack", "json"]}}
+        self.socket.sendall(json.dumps(request).encode('utf-8'))
+        try:
+            reply = json.loads(self._receive_response("negotiate_protocol").decode('utf-8'))
+        except (ValueError, UnicodeDecodeError):
+            reply = {}
+        result = reply.get("result") or {}
+        self._msgpack_supported = reply.get("status") == "success" and result.get("protocol") == "msgpack"
+        if not self._msgpack_supported:
+            logger.info("Unreal plugin does not support MessagePack - using JSON")
+        return self._msgpack_supported
+
+    def _receive_exact(self, size: int) -> bytes:
+        """Read exactly size bytes (socket timeout applies per recv)."""
+        chunks = []
+        remaining = size
+        while remaining > 0:
+            chunk = self.socket.recv(min(remaining, 1 << 20))
+            if not chunk:
+                raise ConnectionError(f"Connection closed with {size - remaining}/{size} bytes of frame received")
+            chunks.append(chunk)
+            remaining -= len(chunk)
+        return b''.join(chunks)
+
+    def _send_msgpack(self, command: str, params: Dict[str, Any]) -> Dict[str, Any]:
+        """Send one length-prefixed MessagePack request and decode the framed reply."""
+        payload = msgpack.packb({"type": command, "params": _msgpack_pack_arrays(params)}, use_bin_type=True)
+        self.socket.sendall(struct.pack(">I", len(payload)) + payload)
+
+        self.socket.settimeout(self._get_timeout_for_command(command))
+        size = struct.unpack(">I", self._receive_exact(4))[0]
+        data = self._receive_exact(size)
+        logger.info(f"Received complete msgpack response ({size} bytes) for {command}")
+        return msgpack.unpackb(data, raw=False, ext_hook=_msgpack_ext_hook, strict_map_key=False)
+
     def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
         """
         Send a command to Unreal Engine with automatic retry.
@@ -401,30 +588,37 @@ class UnrealConnection:
                 raise ConnectionError(f"Failed to connect to Unreal Engine: {self._last_error}")
             
             try:
-                # Build and send command
-                command_obj = {
-                    "type": command,
-                    "params": params or {}
-                }
-                command_json = json.dumps(command_obj)
-                
-                logger.info(f"Sending command (attempt {attempt + 1}): {command}")
-                logger.debug(f"Command payload: {command_json[:500]}...")
-                
                 # Send with timeout
                 self.socket.settimeout(10)  # 10 second send timeout
-                self.socket.sendall(command_json.encode('utf-8'))
-                
-                # Receive response
-                response_data = self._receive_response(command)
-                
-                # Parse response
-                try:
-                    response = json.loads(response_data.decode('utf-8'))
-                except json.JSONDecodeError as e:
-                    logger.error(f"JSON decode error: {e}")
-                    logger.debug(f"Raw response: {response_data[:500]}")
-                    raise ValueError(f"Invalid JSON response: {e}")
+
+                if self._wants_msgpack(command) and self._negotiate_msgpack():
+                    logger.info(f"Sending command (attempt {attempt + 1}, msgpack): {command}")
+                    self.socket.settimeout(10)
+                    response = self._send_msgpack(command, params or {})
+                else:
+                    # Build and send command
+                    command_obj = {
+                        "type": command,
+                        "params": params or {}
+                    }
+                    command_json = json.dumps(command_obj)
+
+                    logger.info(f"Sending command (attempt {attempt + 1}): {command}")
+                    logger.debug(f"Command payload: {command_json[:500]}...")
+
+                    self.socket.settimeout(10)
+                    self.socket.sendall(command_json.encode('utf-8'))
+
+                    # Receive response
+                    response_data = self._receive_response(command)
+
+                    # Parse response
+                    try:
+                        response = json.loads(response_data.decode('utf-8'))
+                    except json.JSONDecodeError as e:
+                        logger.error(f"JSON decode error: {e}")
+                        logger.debug(f"Raw response: {response_data[:500]}")
+                        raise ValueError(f"Invalid JSON response: {e}")
                 
                 logger.info(f"Command {command} completed successfully")
                 
@@ -526,6 +720,42 @@ def find_actors_by_name(pattern: str) -> Dict[str, Any]:
 
 
 
+@mcp.tool()
+def get_scene_delta(since: int = -1, components: bool = True) -> Dict[str, Any]:
+    """
+    Get what changed in the level since a previous call, instead of re-reading every actor.
+
+    The first call (no since) returns the full actor list and the scene version; pass that
+    version back as since to get only the actors added, removed or changed after it. When the
+    editor cannot answer from its change journal (undo/redo, map change, editor restart) the
+    response is a full snapshot again, with "full": true and the reason.
+
+    Parameters:
+    - since: Scene version from a previous get_scene_delta (omit for a full snapshot)
+    - components: Include the component list of actors whose components changed (default: True)
+
+    Returns:
+        Dictionary with version (pass it as since next time) and either
+        full=True + actors (same shape as get_actors_in_level), or
+        full=False + removed (actor names, apply first), added (actor objects) and
+        changed (name, changes: transform/components/properties, new transform, components).
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {"components": components}
+    if since >= 0:
+        params["since"] = since
+
+    try:
+        response = unreal.send_command("get_scene_delta", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_scene_delta error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def delete_actor(name: str) -> Dict[str, Any]:
     """Delete an actor by name."""
@@ -950,7 +1180,8 @@ def import_texture(
     destination_path: str = "/Game/Textures/",
     compression_type: str = "",
     srgb: bool = None,
-    flip_green_channel: bool = None
+    flip_green_channel: bool = None,
+    force: bool = False
 ) -> Dict[str, Any]:
     """
     Import a texture file from disk into the Unreal project.
@@ -970,6 +1201,7 @@ def import_texture(
         "EditorIcon" (TC_EditorIcon) - UI textures (no compression, no streaming, no mipmaps)
     - srgb: Whether texture uses sRGB color space (True for diffuse, False for normal/ARM/data)
     - flip_green_channel: Flip green channel for OpenGL→DirectX normal map conversion
+    - force: Re-import even if the source file and options are unchanged since the last import (default: False)
 
     Returns:
         Dictionary with success status, texture path, and dimensions.
@@ -1008,6 +1240,9 @@ def import_texture(
         if flip_green_channel is not None:
             params["flip_green_channel"] = flip_green_channel
 
+        if force:
+            params["force"] = True
+
         response = unreal.send_command("import_texture", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -1021,7 +1256,8 @@ def import_sound(
     sound_name: str = "",
     destination_path: str = "/Game/Audio/",
     looping: bool = False,
-    volume: float = 1.0
+    volume: float = 1.0,
+    force: bool = False
 ) -> Dict[str, Any]:
     """
     Import a sound file from disk into the Unreal project.
@@ -1034,6 +1270,7 @@ def import_sound(
     - destination_path: Content browser path for the sound (default: "/Game/Audio/")
     - looping: Whether the sound should loop (default: False)
     - volume: Volume multiplier (default: 1.0)
+    - force: Re-import even if the source file and options are unchanged since the last import (default: False)
 
     Returns:
         Dictionary with success status, sound path, duration, sample rate, and channel count.
@@ -1062,10 +1299,460 @@ def import_sound(
         if volume != 1.0:
             params["volume"] = volume
 
-        response = unreal.send_command("import_sound", params)
-        return response or {"success": False, "message": "No response from Unreal"}
+        if force:
+            params["force"] = True
+
+        response = unreal.send_command("import_sound", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"import_sound error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def import_assets_batch(
+    files: List[Dict[str, Any]],
+    defaults: Optional[Dict[str, Dict[str, Any]]] = None,
+    max_in_flight: int = 8,
+    save: bool = True,
+    wait: bool = True,
+    poll_interval: float = 1.0
+) -> Dict[str, Any]:
+    """
+    Import many textures, sounds and FBX files in one pipelined batch.
+
+    Files are read and decoded on worker threads; the editor only creates assets in
+    short game-thread slices, so it stays responsive. All packages are saved once at the end.
+
+    Parameters:
+    - files: List of {"source_path": ..., "type"?: "texture"|"sound"|"mesh"|"skeletal_mesh"|"animation",
+             plus the options of the matching single-file import command}. Type is inferred
+             from the extension when omitted (FBX defaults to "mesh").
+    - defaults: Per-type options merged under each file, e.g. {"texture": {"destination_path": "/Game/Textures/Env/"}}
+    - max_in_flight: How many files are decoded ahead of asset creation (default: 8)
+    - save: Save all imported packages at the end (default: True)
+    - wait: Poll until the batch finishes and return the final status (default: True)
+    - poll_interval: Seconds between status polls when waiting (default: 1.0)
+
+    Returns:
+        Batch status with per-file results and decode/create/save timings.
+        With wait=False, returns immediately with batch_id for get_import_batch_status.
+
+    Example usage:
+        import_assets_batch([
+            {"source_path": "/home/user/tex/rock_albedo.png"},
+            {"source_path": "/home/user/tex/rock_normal.png", "srgb": False},
+            {"source_path": "/home/user/audio/wind.wav", "looping": True},
+            {"source_path": "/home/user/meshes/rock.fbx", "asset_name": "SM_Rock"},
+        ], defaults={"texture": {"destination_path": "/Game/Textures/Rocks/"}})
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {
+            "files": files,
+            "max_in_flight": max_in_flight,
+            "save": save
+        }
+        if defaults:
+            params["defaults"] = defaults
+
+        response = unreal.send_command("import_assets_batch", params)
+        if not response or not wait or not response.get("success") or "batch_id" not in response:
+            return response or {"success": False, "message": "No response from Unreal"}
+
+        batch_id = response["batch_id"]
+        results = list(response.get("results", []))
+        since = response.get("next_since", len(results))
+        while True:
+            time.sleep(poll_interval)
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "batch_id": batch_id, "message": "Lost connection while waiting for batch"}
+
+            status = unreal.send_command("get_import_batch_status", {"batch_id": batch_id, "since": since})
+            if not status or not status.get("success"):
+                return status or {"success": False, "batch_id": batch_id, "message": "No response from Unreal"}
+
+            results.extend(status.get("results", []))
+            since = status.get("next_since", since)
+            logger.info(f"import_assets_batch {batch_id}: {status.get('completed')}/{status.get('total')} "
+                        f"({status.get('failed', 0)} failed)")
+            if status.get("state") == "finished":
+                status["results"] = results
+                return status
+    except Exception as e:
+        logger.error(f"import_assets_batch error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_import_batch_status(batch_id: str, since: int = 0) -> Dict[str, Any]:
+    """
+    Get progress of an import_assets_batch run.
+
+    Parameters:
+    - batch_id: ID returned by import_assets_batch
+    - since: Only return per-file results from this index on (use next_since from the previous call)
+
+    Returns:
+        Dictionary with state (running/finished), completed/total counts, new results and timings.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("get_import_batch_status", {"batch_id": batch_id, "since": since})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_import_batch_status error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_save_policy(
+    policy: str = "",
+    deferred_idle_seconds: float = None,
+    deferred_max_queued: int = None
+) -> Dict[str, Any]:
+    """
+    Control when MCP commands write changed packages to disk.
+
+    Parameters:
+    - policy: One of:
+        "immediate" - each command saves its own package (default, original behavior)
+        "deferred"  - packages are queued and saved together once commands go idle or the queue fills up
+        "on_flush"  - packages are queued and only saved by flush_dirty_packages
+      Leave empty to just report the current policy.
+    - deferred_idle_seconds: Idle time before a deferred queue is flushed (default: 2.0)
+    - deferred_max_queued: Queue size that forces a deferred flush, bounding unsaved memory (default: 64)
+
+    Returns:
+        Dictionary with the active policy, limits and number of queued packages.
+
+    Example usage:
+        set_save_policy("on_flush")
+        # ... hundreds of imports / edits ...
+        flush_dirty_packages()
+        set_save_policy("immediate")
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {}
+        if policy:
+            params["policy"] = policy
+        if deferred_idle_seconds is not None:
+            params["deferred_idle_seconds"] = deferred_idle_seconds
+        if deferred_max_queued is not None:
+            params["deferred_max_queued"] = deferred_max_queued
+
+        response = unreal.send_command("set_save_policy", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_save_policy error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def flush_dirty_packages(include_untracked: bool = False) -> Dict[str, Any]:
+    """
+    Save all queued and dirty packages in one batch.
+
+    Parameters:
+    - include_untracked: Also save dirty /Game packages that were only marked dirty, not queued (default: False)
+
+    Returns:
+        Dictionary with packages_saved, packages_failed, bytes_written, save_ms and the saved package names.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("flush_dirty_packages", {"include_untracked": include_untracked})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"flush_dirty_packages error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def benchmark_response_writer(
+    command: str = "get_actors_in_level",
+    params: Optional[Dict[str, Any]] = None,
+    iterations: int = 10,
+    format: str = "json"
+) -> Dict[str, Any]:
+    """
+    Compare the DOM response path against the streaming UTF-8 writer for one query.
+
+    Runs the command both ways inside the editor: FJsonObject tree + FString serialization +
+    UTF-8 conversion, versus writing UTF-8 straight into a reused buffer. The DOM timing excludes
+    building the tree (it is read back once from the streamed result), so speedup is a lower bound.
+
+    Parameters:
+    - command: get_actors_in_level, find_actors_by_name or get_material_graph
+    - params: Parameters for that command (e.g. {"material_path": "/Game/M_Rock"})
+    - iterations: Runs per path, 1-1000 (default: 10)
+    - format: Encoding of the streaming path, "json" or "msgpack" (default: "json")
+
+    Returns:
+        Dictionary with dom {ms_per_iteration, tree_bytes_estimate, utf16_string_bytes, utf8_bytes},
+        streaming {ms_per_iteration, buffer_bytes, buffer_capacity_bytes}, speedup and bytes_saved.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("benchmark_response_writer", {
+            "command": command,
+            "params": params or {},
+            "iterations": iterations,
+            "format": format,
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"benchmark_response_writer error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_mcp_stats(
+    command: str = "",
+    csv: bool = False,
+    csv_path: str = "",
+    reset: bool = False
+) -> Dict[str, Any]:
+    """
+    Per-command latency and throughput telemetry of the MCP bridge.
+
+    Every command is timed in the editor: queue wait (until the game-thread tick picks it up),
+    execution, response serialization and total, each with mean/p50/p95/p99/max, plus bytes
+    in/out and error counts. Commands are listed slowest (p95 total) first.
+
+    Parameters:
+    - command: Only report commands whose name contains this substring
+    - csv: Also write the table as CSV to Saved/MCP/Stats/mcp_stats_<timestamp>.csv
+    - csv_path: Write the CSV to this file instead
+    - reset: Clear all counters after reporting
+
+    Returns:
+        Dictionary with uptime_s, total_commands, total_errors, total_bytes_in/out,
+        commands_per_minute, commands [...] and csv_path when a CSV was written.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {"csv": csv, "reset": reset}
+    if command:
+        params["command"] = command
+    if csv_path:
+        params["csv_path"] = csv_path
+
+    try:
+        response = unreal.send_command("get_mcp_stats", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_mcp_stats error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_mcp_request_log(
+    since_id: int = 0,
+    command: str = "",
+    errors_only: bool = False,
+    min_total_ms: float = 0.0,
+    limit: int = 100
+) -> Dict[str, Any]:
+    """
+    Query the editor's in-memory log of recent MCP requests.
+
+    Each record has id, time, command, wire format, success/error, bytes in/out and the
+    queue/exec/serialize/total timings. The editor keeps the most recent requests in a
+    ring buffer (see set_mcp_logging for its capacity).
+
+    Parameters:
+    - since_id: Only records newer than this id (pass the previous last_id to poll)
+    - command: Only commands whose name contains this substring
+    - errors_only: Only failed requests
+    - min_total_ms: Only requests that took at least this long
+    - limit: Maximum records returned, newest kept (default: 100)
+
+    Returns:
+        Dictionary with records (oldest first), matched, truncated, last_id and oldest_id.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {"since_id": since_id, "errors_only": errors_only, "min_total_ms": min_total_ms, "limit": limit}
+    if command:
+        params["command"] = command
+
+    try:
+        response = unreal.send_command("get_mcp_request_log", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_mcp_request_log error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def set_mcp_logging(
+    mode: str = "",
+    sample_every: int = 0,
+    slow_ms: float = -1.0,
+    capacity: int = 0
+) -> Dict[str, Any]:
+    """
+    Configure how MCP requests are logged in the editor (call with no arguments to read the settings).
+
+    Every request goes into the request-log ring buffer; the output log only gets a one-line
+    summary for the requests the mode selects.
+
+    Parameters:
+    - mode: "off", "errors" (failed + slow), "sampled" (default: failed + slow + every Nth) or "all"
+    - sample_every: N for the sampled mode (default: 50)
+    - slow_ms: Requests at least this slow count as notable (default: 500)
+    - capacity: Ring buffer size in requests, 16-100000 (default: 1024)
+
+    Returns:
+        Current settings plus memory_bytes, memory_bytes_at_capacity, record_us_mean,
+        log_lines_written/suppressed and log_us_per_line (the memory/CPU cost of the log).
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {}
+    if mode:
+        params["mode"] = mode
+    if sample_every > 0:
+        params["sample_every"] = sample_every
+    if slow_ms >= 0:
+        params["slow_ms"] = slow_ms
+    if capacity > 0:
+        params["capacity"] = capacity
+
+    try:
+        response = unreal.send_command("set_mcp_logging", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_mcp_logging error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def subscribe_events(
+    events: List[str] = None,
+    log_categories: str = "",
+    log_verbosity: str = "",
+    batch_ms: float = 100.0,
+    max_batch: int = 500
+) -> Dict[str, Any]:
+    """
+    Subscribe to editor change events instead of polling get_actors_in_level / get_editor_log.
+
+    Events are queued in the editor and coalesced (a dragged actor becomes one actor_moved with
+    its final transform, a recompiled asset one result, the shader queue its latest size), then
+    collected with poll_events.
+
+    Parameters:
+    - events: Any of "actor_spawned", "actor_deleted", "actor_moved", "asset_saved",
+      "blueprint_compiled", "material_compiled", "shader_queue", "log", or "all"
+      (default: everything but log)
+    - log_categories: Comma-separated log categories to stream (implies "log"), e.g. "LogBlueprint,LogTemp"
+    - log_verbosity: Most verbose log level to stream (default: Log)
+    - batch_ms: How long events are gathered before a batch is due (default: 100)
+    - max_batch: Events per batch (default: 500)
+
+    Returns:
+        Dictionary with subscription_id (for poll_events / unsubscribe_events) and the event types.
+        Subscriptions expire after 10 minutes without a poll.
+
+    Example usage:
+        subscribe_events(events=["material_compiled", "shader_queue"])
+        subscribe_events(events=["blueprint_compiled"], log_categories="LogBlueprint", log_verbosity="Warning")
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    # This client opens a connection per command, so it collects with poll_events; push
+    # delivery is for clients that keep their connection open
+    params = {"push": False, "batch_ms": batch_ms, "max_batch": max_batch}
+    if events:
+        params["events"] = events
+    if log_categories:
+        params["log_categories"] = log_categories
+    if log_verbosity:
+        params["log_verbosity"] = log_verbosity
+
+    try:
+        response = unreal.send_command("subscribe", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"subscribe_events error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def poll_events(subscription_id: int, timeout_ms: int = 0) -> Dict[str, Any]:
+    """
+    Collect the next batch of a subscribe_events subscription.
+
+    Returns whatever is queued at once, or waits up to timeout_ms for a batch to become due.
+    Costs nothing in the editor while nothing happens, unlike re-running a query. The wait
+    holds the editor's single MCP server thread (and this client's connection lock), so every
+    other command queues behind it: poll again instead of waiting long.
+
+    Parameters:
+    - subscription_id: From subscribe_events
+    - timeout_ms: How long to wait for events (default: 0, returns at once; max: 1000)
+
+    Returns:
+        Dictionary with events (each with "event", "time" and type-specific fields such as
+        path, location/rotation/scale, success/errors, jobs, category/message), coalesced
+        (events folded into others), dropped (queue overflow) and pending (left for the next poll).
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("poll_events", {"subscription_id": subscription_id, "timeout_ms": timeout_ms})
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"poll_events error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def unsubscribe_events(subscription_id: int) -> Dict[str, Any]:
+    """
+    End a subscribe_events subscription.
+
+    Returns:
+        Dictionary with delivered, batches, coalesced, dropped and undelivered event counts.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("unsubscribe", {"subscription_id": subscription_id})
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
     except Exception as e:
-        logger.error(f"import_sound error: {e}")
+        logger.error(f"unsubscribe_events error: {e}")
         return {"success": False, "message": str(e)}
 
 
@@ -1120,26 +1807,50 @@ def add_anim_notify(
 @mcp.tool()
 def get_editor_log(
     num_lines: int = 200,
-    filter: str = ""
+    filter: str = "",
+    cursor: int = -1,
+    regex: str = "",
+    category: str = "",
+    verbosity: str = "",
+    structured: bool = False,
+    source: str = "memory",
+    offset: int = -1,
+    max_bytes: int = 0
 ) -> Dict[str, Any]:
     """
-    Read lines from the Unreal Editor log file.
+    Read lines from the Unreal Editor log.
 
-    Reads the current session's log file and returns the last N lines,
-    optionally filtered by a substring match. Useful for verifying plugin
+    By default lines come from an in-memory ring of the last 20000 log lines,
+    captured as they are written, and the call is answered without waiting for
+    the game thread. Pass back next_cursor to get only the lines written since
+    the previous call instead of re-reading the tail. Useful for verifying plugin
     load messages, checking for errors, and debugging runtime issues.
 
     Parameters:
     - num_lines: Number of lines to return (default: 200, max: 5000)
     - filter: Optional substring filter — only lines containing this string are returned
+    - cursor: next_cursor from a previous call; returns the lines after it, oldest first
+    - regex: Optional regular expression the line must match
+    - category: Comma-separated log categories (e.g. "LogTemp,LogBlueprint")
+    - verbosity: Most verbose level to include: Fatal, Error, Warning, Display, Log, Verbose
+    - structured: Return an "entries" list (cursor, time, category, verbosity, message)
+      instead of one joined "lines" string
+    - source: "memory" (default) or "file" to read the project log file, for lines
+      older than the ring or logged before the plugin loaded
+    - offset: With source="file", byte offset to continue from (next_offset of a previous call);
+      omit to read the end of the file
+    - max_bytes: With source="file", bytes to read per call (default 1 MB, max 16 MB)
 
     Returns:
-        Dictionary with log_file path, total_lines, returned_lines count, and lines (newline-joined string).
+        Dictionary with returned_lines, lines (newline-joined string) or entries, has_more, and
+        next_cursor (memory) or next_offset (file). lines_dropped is set when the ring wrapped
+        past the cursor.
 
     Example usage:
         get_editor_log(filter="BELL SKELETON FIX")
-        get_editor_log(filter="BUILD_ID", num_lines=50)
-        get_editor_log(filter="Error", num_lines=500)
+        get_editor_log(category="LogTemp", verbosity="Warning")
+        get_editor_log(cursor=15230)
+        get_editor_log(source="file", offset=0, regex="BUILD_ID=.*v2[0-9]")
     """
     unreal = get_unreal_connection()
     if not unreal:
@@ -1151,6 +1862,22 @@ def get_editor_log(
         }
         if filter:
             params["filter"] = filter
+        if regex:
+            params["regex"] = regex
+        if category:
+            params["category"] = category
+        if verbosity:
+            params["verbosity"] = verbosity
+        if structured:
+            params["structured"] = True
+        if source != "memory":
+            params["source"] = source
+        if cursor >= 0:
+            params["cursor"] = cursor
+        if offset >= 0:
+            params["offset"] = offset
+        if max_bytes > 0:
+            params["max_bytes"] = max_bytes
         response = unreal.send_command("get_editor_log", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -1438,19 +2165,28 @@ def create_landscape_material(
 def take_screenshot(
     file_path: str = "",
     width: int = 960,
-    height: int = 540
+    height: int = 540,
+    format: str = "png",
+    quality: int = 90,
+    output: str = "both"
 ) -> list:
     """
     Take a screenshot of the active Unreal Editor viewport.
 
-    Uses SceneCapture2D to render the scene off-screen — works even when
-    the editor viewport is minimized or has no visible render target.
+    Uses a persistent SceneCapture2D rig to render the scene off-screen — works even when
+    the editor viewport is minimized or has no visible render target. The GPU readback and
+    image encoding run without stalling the editor, and the encoded image comes back in the
+    response instead of being re-read from disk.
     Returns the screenshot as an inline image (visible to Claude) plus metadata.
 
     Parameters:
-    - file_path: Where to save the PNG (default: project's Saved/Screenshots/MCP_Screenshot.png)
+    - file_path: Where to save the image (default: project's Saved/Screenshots/MCP_Screenshot.<ext>)
     - width: Screenshot width in pixels (default: 960, range: 320-3840)
     - height: Screenshot height in pixels (default: 540, range: 240-2160)
+    - format: "png" (default), "jpeg", "bmp", or "raw" (BGRA8 pixels, bulk output only)
+    - quality: JPEG quality 1-100 (default: 90, ignored for png/bmp)
+    - output: "both" (default: save to disk and return inline), "inline" (no disk write), "file",
+      or "bulk" (image travels through a shared-memory segment instead of base64 on the socket)
 
     Returns:
         List of MCP content items: TextContent with metadata + ImageContent with the screenshot.
@@ -1462,7 +2198,7 @@ def take_screenshot(
         return [TextContent(type="text", text=json.dumps({"success": False, "message": "Failed to connect to Unreal Engine"}))]
 
     try:
-        params = {"width": width, "height": height}
+        params = {"width": width, "height": height, "format": format, "quality": quality, "output": output}
         if file_path:
             params["file_path"] = file_path
 
@@ -1481,17 +2217,28 @@ def take_screenshot(
             "file_path": result.get("file_path", ""),
             "width": result.get("width", 0),
             "height": result.get("height", 0),
+            "format": result.get("format", "png"),
+            "bytes": result.get("bytes", 0),
+            "readback_ms": result.get("readback_ms", 0),
+            "encode_ms": result.get("encode_ms", 0),
             "message": result.get("message", ""),
         }
+        if meta["format"] == "raw":
+            # Raw pixels are for scripted consumers; leave the segment for them to map
+            meta["bulk"] = result.get("bulk")
         content_items.append(TextContent(type="text", text=json.dumps(meta)))
 
         # Inline image so Claude can see the screenshot
+        mime_type = {"jpeg": "image/jpeg", "bmp": "image/bmp"}.get(meta["format"], "image/png")
+        b64_data = result.get("image_base64", "")
+        if result.get("bulk") and meta["format"] != "raw":
+            b64_data = base64.standard_b64encode(bulk_read(result["bulk"])).decode("ascii")
         screenshot_path = result.get("file_path", "")
-        if screenshot_path and os.path.isfile(screenshot_path):
+        if not b64_data and screenshot_path and os.path.isfile(screenshot_path):
             with open(screenshot_path, "rb") as f:
-                png_bytes = f.read()
-            b64_data = base64.standard_b64encode(png_bytes).decode("ascii")
-            content_items.append(ImageContent(type="image", data=b64_data, mimeType="image/png"))
+                b64_data = base64.standard_b64encode(f.read()).decode("ascii")
+        if b64_data:
+            content_items.append(ImageContent(type="image", data=b64_data, mimeType=mime_type))
 
         return content_items
     except Exception as e:
@@ -1499,6 +2246,84 @@ def take_screenshot(
         return [TextContent(type="text", text=json.dumps({"success": False, "message": str(e)}))]
 
 
+@mcp.tool()
+def capture_views(
+    views: List[Dict[str, Any]] = None,
+    orbit: Dict[str, Any] = None,
+    width: int = 640,
+    height: int = 360,
+    format: str = "png",
+    quality: int = 90,
+    output: str = "both",
+    output_dir: str = "",
+    prefix: str = "view",
+    max_in_flight: int = 4
+) -> list:
+    """
+    Capture many camera views in one command (visual regression, turntables).
+
+    All views go through the same persistent capture rig as take_screenshot; captures are
+    pipelined across frames, so N views cost far less than N take_screenshot calls.
+
+    Parameters:
+    - views: List of cameras, each {"location": [x, y, z], "rotation": [pitch, yaw, roll], "fov": 90}
+    - orbit: Turntable spec instead of views: {"actor": "Name"} or {"center": [x, y, z], "radius": 1500},
+      plus optional "count" (default 36, max 360), "pitch" (default -20), "start_yaw" (default 0), "fov" (default 60).
+      With an actor, center and radius come from its bounds unless given.
+    - width / height: Image size in pixels (default: 640x360)
+    - format: "png" (default), "jpeg" or "bmp"
+    - quality: JPEG quality 1-100 (default: 90)
+    - output: "both" (default: save files and return images inline), "inline" (no disk write) or "file"
+    - output_dir: Directory for <prefix>_NNN.<ext> files (default: Saved/Screenshots/MCP_Views)
+    - prefix: File name prefix (default: "view")
+    - max_in_flight: Captures kept in flight at once (default: 4, range 1-16)
+
+    Returns:
+        List of MCP content items: TextContent with per-view metadata + one ImageContent per captured view.
+    """
+    from mcp.types import ImageContent, TextContent
+
+    unreal = get_unreal_connection()
+    if not unreal:
+        return [TextContent(type="text", text=json.dumps({"success": False, "message": "Failed to connect to Unreal Engine"}))]
+
+    try:
+        params = {
+            "width": width,
+            "height": height,
+            "format": format,
+            "quality": quality,
+            "output": output,
+            "prefix": prefix,
+            "max_in_flight": max_in_flight,
+        }
+        if views:
+            params["views"] = views
+        if orbit:
+            params["orbit"] = orbit
+        if output_dir:
+            params["output_dir"] = output_dir
+
+        response = unreal.send_command("capture_views", params)
+        result = response.get("result", response)
+
+        if "views" not in result:
+            return [TextContent(type="text", text=json.dumps(result))]
+
+        # Strip the image payloads out of the metadata; they are returned as ImageContent
+        mime_type = {"jpeg": "image/jpeg", "bmp": "image/bmp"}.get(result.get("format", "png"), "image/png")
+        images = []
+        for view in result["views"]:
+            b64_data = view.pop("image_base64", "")
+            if b64_data:
+                images.append(ImageContent(type="image", data=b64_data, mimeType=mime_type))
+
+        return [TextContent(type="text", text=json.dumps(result))] + images
+    except Exception as e:
+        logger.error(f"capture_views error: {e}")
+        return [TextContent(type="text", text=json.dumps({"success": False, "message": str(e)}))]
+
+
 @mcp.tool()
 def get_material_info(
     material_path: str
@@ -1597,7 +2422,8 @@ def import_mesh(
     import_textures: bool = False,
     generate_collision: bool = True,
     enable_nanite: bool = True,
-    combine_meshes: bool = True
+    combine_meshes: bool = True,
+    force: bool = False
 ) -> Dict[str, Any]:
     """
     Import a mesh file (FBX, OBJ) from disk into the Unreal project as a Static Mesh.
@@ -1611,6 +2437,7 @@ def import_mesh(
     - generate_collision: Auto-generate collision mesh (default: True)
     - enable_nanite: Enable Nanite virtualized geometry (default: True - recommended for high-poly meshes)
     - combine_meshes: Combine all meshes in FBX into one (default: True)
+    - force: Re-import even if the source file and options are unchanged since the last import (default: False)
 
     Returns:
         Dictionary with success status, asset path, vertex/triangle counts, and material slot info.
@@ -1639,6 +2466,9 @@ def import_mesh(
         if asset_name:
             params["asset_name"] = asset_name
 
+        if force:
+            params["force"] = True
+
         response = unreal.send_command("import_mesh", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -1656,7 +2486,8 @@ def import_skeletal_mesh(
     import_morph_targets: bool = True,
     import_materials: bool = False,
     import_textures: bool = False,
-    skeleton_path: str = ""
+    skeleton_path: str = "",
+    force: bool = False
 ) -> Dict[str, Any]:
     """
     Import an FBX file as a Skeletal Mesh (character/animated mesh with bones).
@@ -1673,6 +2504,7 @@ def import_skeletal_mesh(
     - import_materials: Import embedded materials (default: False - create manually)
     - import_textures: Import embedded textures (default: False - import separately)
     - skeleton_path: Reuse an existing skeleton asset path (optional, creates new if empty)
+    - force: Re-import even if the source file and options are unchanged since the last import (default: False)
 
     Returns:
         Dictionary with skeletal_mesh_path, skeleton_path, bone_count, bone_names,
@@ -1704,6 +2536,9 @@ def import_skeletal_mesh(
         if skeleton_path:
             params["skeleton_path"] = skeleton_path
 
+        if force:
+            params["force"] = True
+
         response = unreal.send_command("import_skeletal_mesh", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -1716,7 +2551,8 @@ def import_animation(
     source_path: str,
     skeleton_path: str,
     animation_name: str = "",
-    destination_path: str = "/Game/Characters/Animations/"
+    destination_path: str = "/Game/Characters/Animations/",
+    force: bool = False
 ) -> Dict[str, Any]:
     """
     Import animation(s) from an FBX file onto an existing skeleton.
@@ -1729,6 +2565,7 @@ def import_animation(
     - skeleton_path: Content path to an existing USkeleton asset (REQUIRED)
     - animation_name: Override name for the imported animation (defaults to filename)
     - destination_path: Content browser path (default: "/Game/Characters/Animations/")
+    - force: Re-import even if the source file and options are unchanged since the last import (default: False)
 
     Returns:
         Dictionary with list of imported animations, each containing name, path,
@@ -1754,6 +2591,9 @@ def import_animation(
         if animation_name:
             params["animation_name"] = animation_name
 
+        if force:
+            params["force"] = True
+
         response = unreal.send_command("import_animation", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -5071,6 +5911,117 @@ def rename_function(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def begin_blueprint_edit(
+    blueprint_name: str,
+    timeout_seconds: float = 60.0
+) -> Dict[str, Any]:
+    """
+    Open an edit session on a Blueprint so graph commands skip compilation.
+
+    While the session is open, add_node / connect_nodes / create_variable / set_node_property
+    and the function commands only change the graph in memory. Call commit_blueprint_edit to
+    compile once. A session idle for longer than timeout_seconds is committed automatically.
+
+    Args:
+        blueprint_name: Name of the Blueprint to edit
+        timeout_seconds: Idle time before the session auto-commits (default 60)
+
+    Returns:
+        Dictionary with success status and whether a session was already open
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("begin_blueprint_edit", {
+            "blueprint_name": blueprint_name,
+            "timeout_seconds": timeout_seconds
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"begin_blueprint_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+@mcp.tool()
+def commit_blueprint_edit(
+    blueprint_name: str
+) -> Dict[str, Any]:
+    """
+    Close a Blueprint edit session and compile the Blueprint once.
+
+    Args:
+        blueprint_name: Name of the Blueprint
+
+    Returns:
+        Dictionary with edit_count, compile_ms, num_errors, num_warnings and compiler messages
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("commit_blueprint_edit", {
+            "blueprint_name": blueprint_name
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"commit_blueprint_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+@mcp.tool()
+def build_blueprint_graph(
+    blueprint_name: str,
+    operations: List[Dict[str, Any]],
+    stop_on_error: bool = True
+) -> Dict[str, Any]:
+    """
+    Apply a batch of Blueprint graph edits in one round trip and compile once at the end.
+
+    Each operation is {"command": <graph command>, "params": {...}, "ref": <optional name>}.
+    Allowed commands: add_blueprint_node, connect_nodes, create_variable,
+    set_blueprint_variable_properties, add_event_node, delete_node, set_node_property,
+    create_function, add_function_input, add_function_output, delete_function,
+    rename_function, add_enhanced_input_action_event.
+
+    blueprint_name is filled into each operation's params when missing. A value written as
+    {"$ref": "<ref>"} is replaced with the node_id returned by the operation tagged with that
+    ref, and {"$ref": "<ref>.<field>"} with another field of that result. Plain strings are
+    never rewritten, so values that start with "$" pass through unchanged.
+
+    Example:
+        operations=[
+            {"command": "add_event_node", "params": {"event_name": "ReceiveBeginPlay"}, "ref": "begin"},
+            {"command": "add_blueprint_node", "params": {"node_type": "Print", "node_params": {"message": "Hi"}}, "ref": "print"},
+            {"command": "connect_nodes", "params": {"source_node_id": {"$ref": "begin"}, "source_pin_name": "then",
+                                                    "target_node_id": {"$ref": "print"}, "target_pin_name": "execute"}}
+        ]
+
+    Args:
+        blueprint_name: Name of the Blueprint to modify
+        operations: Ordered list of operations
+        stop_on_error: Stop at the first failing operation (default True)
+
+    Returns:
+        Dictionary with per-operation results, errors, apply_ms, compile_ms and compiler messages
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("build_blueprint_graph", {
+            "blueprint_name": blueprint_name,
+            "operations": operations,
+            "stop_on_error": stop_on_error
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"build_blueprint_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 # ============================================================================
 # Material Graph Expression Tools
 # ============================================================================
@@ -5144,7 +6095,8 @@ def add_material_expression(
         - For Power: {"const_exponent": 2.0}
 
     Returns:
-        Dictionary with expression_id (for use in connections) and success status.
+        Dictionary with expression_id, mcp_id ("MCP_n", stored in the node's Desc) and guid
+        (any of them works in later commands; guid is stable across renames) and success status.
 
     Example:
         # Add a WorldPosition node
@@ -5290,6 +6242,8 @@ def get_material_graph(
         Dictionary with:
         - expressions: List of all expressions with id, type, position
         - expression_count: Total number of expressions
+        - edges: Expression connections ({source, output_index, target, input})
+        - outputs: Material output connections ({source, output_index, property})
 
     Example:
         get_material_graph("/Game/Materials/M_EarthTone")
@@ -5308,6 +6262,68 @@ def get_material_graph(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def build_material_graph(
+    material_path: str,
+    nodes: List[Dict[str, Any]],
+    edges: List[Dict[str, Any]] = None,
+    outputs: List[Dict[str, Any]] = None,
+    material: Dict[str, Any] = None,
+    prune: bool = False,
+    create_if_missing: bool = True,
+    wait_for_compile: bool = True
+) -> Dict[str, Any]:
+    """
+    Build or update a whole material graph from one document, with a single compile.
+
+    The document has the same shape get_material_graph returns, so a graph can be read,
+    edited and uploaded back. Nodes are matched by id (expression name or the id used in a
+    previous build); unchanged nodes and connections are left alone, so iterating on a
+    large material is one round trip and one compile.
+
+    Parameters:
+    - material_path: Path to the material (created if missing unless create_if_missing=False)
+    - nodes: [{"id": "tex", "type": "TextureSample", "pos_x": -400, "pos_y": 0, "params": {...}}]
+        type/params are the same as add_material_expression's expression_type/expression_params
+    - edges: [{"source": "uv", "output_index": 0, "target": "tex", "input": "uv"}]
+    - outputs: [{"source": "tex", "output_index": 0, "property": "BaseColor"}]
+    - material: Material-level properties, e.g. {"two_sided": True}
+    - prune: Also delete nodes, and clear material outputs, that the document doesn't mention
+        (default False, which leaves the rest of the graph alone)
+    - create_if_missing: Create the material asset if it doesn't exist (default True)
+    - wait_for_compile: Block until shader compilation finishes (default True)
+
+    The document is validated in full first; if any node, edge or output is invalid the
+    call fails with an errors list and the material is not touched.
+
+    Returns:
+        Dictionary with node/connection change counts, id_map (document id -> expression guid),
+        compile_ms and errors.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {
+            "material_path": material_path,
+            "nodes": nodes,
+            "edges": edges or [],
+            "outputs": outputs or [],
+            "prune": prune,
+            "create_if_missing": create_if_missing,
+            "wait_for_compile": wait_for_compile
+        }
+        if material:
+            params["material"] = material
+
+        response = unreal.send_command("build_material_graph", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"build_material_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def set_material_expression_property(
     material_path: str,
@@ -5390,6 +6406,75 @@ def delete_material_expression(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def begin_material_edit(
+    material_path: str,
+    timeout_seconds: float = 60.0
+) -> Dict[str, Any]:
+    """
+    Open an edit session on a material so graph edits skip the per-command shader compile.
+
+    While the session is open, add/connect/set/delete expression commands on this material
+    only mutate the graph (responses report compile_deferred=true). Call commit_material_edit
+    once at the end to compile a single time. A session idle for timeout_seconds auto-commits.
+
+    Parameters:
+    - material_path: Path to the material
+    - timeout_seconds: Idle time before the session auto-commits (default 60)
+
+    Returns:
+        Dictionary with already_open, edit_count and success status.
+
+    Example:
+        begin_material_edit("/Game/Materials/M_Landscape")
+        # ... add_material_expression / connect_material_expressions ...
+        commit_material_edit("/Game/Materials/M_Landscape")
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("begin_material_edit", {
+            "material_path": material_path,
+            "timeout_seconds": timeout_seconds
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"begin_material_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def commit_material_edit(
+    material_path: str,
+    wait_for_compile: bool = True
+) -> Dict[str, Any]:
+    """
+    Close a material edit session and compile the material once.
+
+    Parameters:
+    - material_path: Path to the material
+    - wait_for_compile: Block until shader compilation finishes (default True)
+
+    Returns:
+        Dictionary with edit_count, post_edit_ms, compile_ms and success status.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("commit_material_edit", {
+            "material_path": material_path,
+            "wait_for_compile": wait_for_compile
+        })
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"commit_material_edit error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def recompile_material(
     material_path: str
@@ -5794,7 +6879,8 @@ def scatter_foliage(
     cull_distance: float = 0.0,
     material_path: str = "",
     materials: List[str] = None,
-    bounds: List[float] = None
+    bounds: List[float] = None,
+    transforms: List[List[float]] = None
 ) -> Dict[str, Any]:
     """
     Scatter vegetation/foliage using HISM (HierarchicalInstancedStaticMesh) with
@@ -5822,6 +6908,9 @@ def scatter_foliage(
       Empty strings skip that slot (use mesh default). Overrides material_path if provided.
     - bounds: Optional rectangular bounds [min_x, max_x, min_y, max_y]. When provided,
       overrides center+radius for uniform rectangular coverage. Ideal for full-landscape scatter.
+    - transforms: Optional precomputed placements, each [x, y, z, pitch, yaw, roll, sx, sy, sz].
+      Skips sampling and traces entirely; the list is handed to the editor through a shared-memory
+      bulk segment instead of the socket, so 100k+ instances cost no JSON encoding.
 
     Returns:
         Dictionary with instance_count, candidates_generated, rejected_slope,
@@ -5856,9 +6945,30 @@ def scatter_foliage(
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
 
+    if transforms:
+        params = {"mesh_path": mesh_path, "actor_name": actor_name, "cull_distance": cull_distance}
+        if materials:
+            params["materials"] = materials
+        elif material_path:
+            params["material_path"] = material_path
+        try:
+            if any(len(t) != 9 for t in transforms):
+                return {"success": False, "message": "Each transform needs 9 values: x, y, z, pitch, yaw, roll, sx, sy, sz"}
+            params["transforms_bulk"] = bulk_write(unreal, [v for t in transforms for v in t])
+            response = unreal.send_command("scatter_foliage", params)
+            if not response:
+                # No reply: the editor may never have seen the segment
+                bulk_discard(params["transforms_bulk"])
+                return {"success": False, "message": "No response from Unreal"}
+            return response.get("result", response)
+        except Exception as e:
+            bulk_discard(params.get("transforms_bulk"))
+            logger.error(f"scatter_foliage (bulk) error: {e}")
+            return {"success": False, "message": str(e)}
+
     # Validate: need either bounds or center+radius
     if bounds is None and center is None:
-        return {"success": False, "message": "Must provide either 'bounds' or 'center'+'radius'"}
+        return {"success": False, "message": "Must provide either 'bounds', 'center'+'radius' or 'transforms'"}
 
     params = {
         "mesh_path": mesh_path,
@@ -5901,6 +7011,180 @@ def scatter_foliage(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def spawn_instanced_batch(
+    name: str,
+    items: List[Dict[str, Any]],
+    component_type: str = "hism",
+    folder: str = "Instanced"
+) -> Dict[str, Any]:
+    """
+    Spawn many static meshes in one call as instances instead of individual StaticMeshActors.
+
+    Items are grouped by mesh + materials into one ISM/HISM component per group on a single
+    container actor, so a whole structure is one round trip and renders with one draw call per
+    group instead of one actor (draw calls, tick registration, OFPA package) per piece.
+    Calling again with the same name appends to the existing container. Undoable in one step.
+
+    Parameters:
+    - name: Container actor name (an existing container with this name is appended to)
+    - items: List of {"mesh": "/Engine/BasicShapes/Cube", "location": [x, y, z],
+      "rotation": [pitch, yaw, roll], "scale": [x, y, z], "material": "/Game/..."}.
+      "materials": [slot0, slot1, ...] sets slots individually; empty strings keep the mesh default.
+      An optional "label" per item is kept in the component's per-instance metadata.
+    - component_type: "hism" (default, per-instance culling/LOD) or "ism" (cheaper for small groups)
+    - folder: World Outliner folder for a new container (default: "Instanced")
+
+    Returns:
+        Dictionary with actor_name, instance_count, component_count, per-group details,
+        skipped item count and errors.
+
+    Example:
+        spawn_instanced_batch(
+            name="Castle_Walls",
+            items=[
+                {"mesh": "/Engine/BasicShapes/Cube", "location": [0, 0, 150], "scale": [1, 4, 3]},
+                {"mesh": "/Engine/BasicShapes/Cube", "location": [0, 400, 150], "scale": [1, 4, 3]},
+            ]
+        )
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {
+        "name": name,
+        "items": items,
+        "component_type": component_type,
+        "folder": folder,
+    }
+
+    try:
+        response = unreal.send_command("spawn_instanced_batch", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"spawn_instanced_batch error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def consolidate_to_instances(
+    pattern: str = "",
+    actor_class: str = "",
+    region_min: List[float] = None,
+    region_max: List[float] = None,
+    center: List[float] = None,
+    radius: float = 0.0,
+    name: str = "Consolidated_Instances",
+    component_type: str = "hism",
+    min_group_size: int = 2,
+    folder: str = "Instanced",
+    dry_run: bool = False
+) -> Dict[str, Any]:
+    """
+    Replace existing StaticMeshActors with ISM/HISM instances on one container actor.
+
+    Matching actors are grouped by mesh + material overrides + collision profile + mobility; each
+    group becomes one instanced component with that collision profile and mobility, and the original
+    actors are deleted. Transforms, outliner labels and original actor names are preserved
+    (labels/names in the component's per-instance metadata).
+    The whole operation is a single undo transaction (Ctrl+Z restores the actors).
+
+    Only actors with exactly one StaticMeshComponent and no attachment parent/children are merged.
+    Without actor_class only StaticMeshActors are considered.
+
+    Parameters:
+    - pattern: Substring of the actor name or label (e.g. "Rock_", "Castle_Wall")
+    - actor_class: Exact class name filter (e.g. "BP_Rock_C"); default: StaticMeshActor and subclasses
+    - region_min / region_max: World-space box [x, y, z] actors must be inside
+    - center / radius: World-space sphere actors must be inside
+    - name: Container actor name (default: "Consolidated_Instances", must not exist yet)
+    - component_type: "hism" (default) or "ism"
+    - min_group_size: Groups with fewer actors are left alone (default: 2)
+    - folder: World Outliner folder for the container (default: "Instanced")
+    - dry_run: Only report what would be merged
+
+    At least one filter (pattern, actor_class, region or center+radius) is required.
+
+    Returns:
+        Dictionary with actors_replaced, actor_count_reduction, draw_calls_before_estimate,
+        draw_calls_after_estimate, per-group details and the container actor name.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {
+        "name": name,
+        "component_type": component_type,
+        "min_group_size": min_group_size,
+        "folder": folder,
+        "dry_run": dry_run,
+    }
+    if pattern:
+        params["pattern"] = pattern
+    if actor_class:
+        params["class"] = actor_class
+    if region_min is not None and region_max is not None:
+        params["region_min"] = region_min
+        params["region_max"] = region_max
+    if center is not None and radius > 0:
+        params["center"] = center
+        params["radius"] = radius
+
+    try:
+        response = unreal.send_command("consolidate_to_instances", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"consolidate_to_instances error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_bulk_channel_info() -> Dict[str, Any]:
+    """
+    Describe the shared-memory bulk channel used for large payloads.
+
+    Returns:
+        Dictionary with the segment directory, layout, live segments (handle + bytes) and total_bytes.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        response = unreal.send_command("get_bulk_channel_info", {})
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_bulk_channel_info error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def release_bulk(handle: str = "", all: bool = False) -> Dict[str, Any]:
+    """
+    Delete a bulk segment (or every segment with all=True).
+
+    Segments consumed by a command (e.g. scatter_foliage transforms) are released automatically;
+    this is for raw screenshots and other segments the editor hands back.
+
+    Parameters:
+    - handle: Segment handle from a bulk descriptor
+    - all: Delete every segment in the bulk directory
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    params = {"all": True} if all else {"handle": handle}
+    try:
+        response = unreal.send_command("release_bulk", params)
+        return response.get("result", response) if response else {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"release_bulk error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 
 # ============================================================================
 # Gameplay Commands (FEATURE-017, 018, 020, 022, 023)